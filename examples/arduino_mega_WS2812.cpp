@@ -2,11 +2,14 @@
 #include <utfast_addr.h>
 #include <utcolor.h>
 #include <utcolors.h>
+#include <utcolor_buffer.h>
 
 // AVR Register-Adressen
+#define PIND_ADDR  0x29
 #define DDRD_ADDR  0x2A
 #define PORTD_ADDR 0x2B
 #define LED_BIT    6   // PD6
+#define LED_COUNT  60
 
 
 
@@ -14,6 +17,9 @@
 static utb::fast_addr_t<uint8_t>* ddrd  = nullptr;
 static utb::fast_addr_t<uint8_t>* portd = nullptr;
 
+// Eine 1 in PIND kippt PORTD: jede Flanke ist ein einzelner Store statt Read-Modify-Write
+static const utb::toggle_register<uint8_t> pind(PIND_ADDR);
+
 
 
 // Timer-basierte Wartefunktion
@@ -27,15 +33,15 @@ static inline void waitTicks(uint16_t ticks) {
 static inline void sendBit(bool bit) {
     if (bit) {
         // ---- Bit 1 ----
-        portd->set(LED_BIT, true);   // HIGH
+        pind.toggle(1 << LED_BIT);   // HIGH
         waitTicks(11);               // ~700 ns
-        portd->set(LED_BIT, false);  // LOW
+        pind.toggle(1 << LED_BIT);   // LOW
         waitTicks(9);                // ~600 ns
     } else {
         // ---- Bit 0 ----
-        portd->set(LED_BIT, true);   // HIGH
+        pind.toggle(1 << LED_BIT);   // HIGH
         waitTicks(5);                // ~350 ns
-        portd->set(LED_BIT, false);  // LOW
+        pind.toggle(1 << LED_BIT);   // LOW
         waitTicks(14);               // ~900 ns
     }
 }
@@ -54,13 +60,23 @@ static inline void sendColor(const utb::graphic::color& c) {
     sendByte((uint8_t)(c.b * 255));
 }
 
+// Der ganze Streifen als GRB-Frame, ohne Float-Rechnung pro LED
+static utb::graphic::grb888_buffer<LED_COUNT> frame;
+
+static inline void sendFrame() {
+    const uint8_t* data = frame.data();
+    for (size_t i = 0; i < frame.bytes(); i++)
+        sendByte(data[i]);
+}
+
 void setup() {
     // Fast-Views erzeugen
     ddrd  = utb::create_fast_view<uint8_t>(DDRD_ADDR);
     portd = utb::create_fast_view<uint8_t>(PORTD_ADDR);
 
-    // Pin als Output setzen
-    ddrd->set(LED_BIT, true);
+    // Pin als Output setzen und LOW starten, je ein Store
+    ddrd->set_mask(1 << LED_BIT);
+    portd->clear_mask(1 << LED_BIT);
 
     // Timer1: no prescaler → 16 MHz
     TCCR1A = 0;
@@ -73,21 +89,13 @@ void setup() {
 }
 
 void loop() {
-    static float t = 0.0f;
-
-    // t läuft langsam durch den Farbkreis
-    t += 0.02f;
-    if (t > 1.0f)
-        t -= 1.0f;
-
-    // Regenbogen über drei Sinusphasen
-    float r = fabsf(sinf(6.28318f * t + 0.0f));     // 0°
-    float g = fabsf(sinf(6.28318f * t + 2.094f));   // +120°
-    float b = fabsf(sinf(6.28318f * t + 4.188f));   // +240°
+    static uint8_t hue = 0;
 
-    utb::graphic::color c(r, g, b);
+    // Regenbogen über den Streifen, läuft pro Frame eine Stufe weiter
+    frame.fill_rainbow(hue++, 256 / LED_COUNT);
+    frame.scale(64);    // 25% Helligkeit
 
-    sendColor(c);
+    sendFrame();
 
     // WS2812 Reset-Latch
     delayMicroseconds(60);
@@ -0,0 +1,38 @@
+#include <Arduino.h>
+#include <utbenchmark.h>
+#include <utmap.h>
+#include <uthistory.h>
+#include <utcolor_buffer.h>
+
+// Läuft auf jedem Arduino-Target: ESP32 zählt mit ccount, Cortex-M mit DWT, AVR mit micros()
+static utb::bench::runner<8> bench;
+static utb::light_map<int, int, 64> map;
+static utb::history<int16_t, 32> hist;
+static utb::graphic::grb888_buffer<60> frame;
+
+void setup() {
+    Serial.begin(115200);
+
+    for (int i = 0; i < 48; ++i) map.insert(i * 3, i);
+
+    bench.run("light_map.find", 1000, []() {
+        static int key = 0;
+        const int* p = map.find(key);
+        key = (key + 3) % 144;
+        utb::bench::do_not_optimize(p);
+    });
+    bench.run("history.push+avg", 1000, []() {
+        static int16_t v = 0;
+        hist.push(v++);
+        int16_t a = hist.average();
+        utb::bench::do_not_optimize(a);
+    });
+    bench.run("grb888_buffer<60>.rainbow", 100, []() {
+        frame.fill_rainbow(0, 4);
+    });
+
+    auto out = [](const char* s) { Serial.print(s); };
+    bench.write_json(out);
+}
+
+void loop() {}
@@ -3,6 +3,8 @@
 
 #define GPIO_OUT_REG 0x3FF44004  // Adresse des GPIO-Ausgangsregisters auf dem ESP32
 #define GPIO2_BIT    2           // Bit-Position für GPIO2
+#define GPIO_OUT_W1TS_REG 0x3FF44008  // Write-1-to-Set
+#define GPIO_OUT_W1TC_REG 0x3FF4400C  // Write-1-to-Clear
 
 void setup() {
     Serial.begin(115200);
@@ -20,6 +22,16 @@ void setup() {
     }   
 
     Serial.println("GPIO2 set HIGH");
+
+    // Ohne Read-Modify-Write: ein Store pro Flanke, atomar gegenüber Interrupts
+    utb::set_clear_register<uint32_t> gpio(GPIO_OUT_W1TS_REG, GPIO_OUT_W1TC_REG);
+    gpio.clear(1u << GPIO2_BIT);
+    gpio.set(1u << GPIO2_BIT);
+
+    // Mehrere Änderungen gesammelt, ein einziger Store beim commit()
+    utb::register_transaction<uint32_t> tx(GPIO_OUT_REG);
+    tx.clear(GPIO2_BIT).set(4).set(5);
+    tx.commit();
 }
 
 void loop() {}
@@ -0,0 +1,46 @@
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <utalgorithm.h>
+
+static uint32_t src[8192];
+static uint32_t dst[8192 + 8];
+
+// Keeps the optimizer from dropping the loops.
+static volatile uint32_t sink;
+
+template <class TFn>
+static double ns_per_call(TFn fn, uint32_t rounds) {
+    fn();
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t r = 0; r < rounds; ++r) { fn(); sink = dst[r & 7]; }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / rounds;
+}
+
+// The element loops utb used before the size-class kernels.
+static void loop_fill(uint32_t* d, size_t n, uint32_t v)               { for (size_t i = 0; i < n; ++i) d[i] = v; }
+static void loop_copy(const uint32_t* s, size_t n, uint32_t* d)        { for (size_t i = 0; i < n; ++i) d[i] = s[i]; }
+static void loop_move(const uint32_t* s, size_t n, uint32_t* d)        { for (size_t i = n; i > 0; --i) d[i - 1] = s[i - 1]; }
+
+int main() {
+    const size_t sizes[] = { 3, 12, 48, 200, 1024, 8192 };
+
+    for (size_t i = 0; i < 8192; ++i) src[i] = uint32_t(i * 2654435761u);
+
+    std::cout << "elements  fill loop/utb ns   copy loop/utb ns   move loop/utb ns\n";
+    for (size_t n : sizes) {
+        const uint32_t rounds = uint32_t(20000000 / (n + 16));
+
+        const double fl = ns_per_call([n]() { loop_fill(dst + 1, n, 0x5A5A5A5Au); }, rounds);
+        const double fu = ns_per_call([n]() { utb::fill_n(dst + 1, n, 0x5A5A5A5Au); }, rounds);
+        const double cl = ns_per_call([n]() { loop_copy(src, n, dst + 1); }, rounds);
+        const double cu = ns_per_call([n]() { utb::copy_n(src, n, dst + 1); }, rounds);
+        const double ml = ns_per_call([n]() { loop_move(dst, n, dst + 3); }, rounds);
+        const double mu = ns_per_call([n]() { utb::move_n(dst, n, dst + 3); }, rounds);
+
+        std::cout << n << "\t  " << fl << " / " << fu << "\t     " << cl << " / " << cu
+                  << "\t        " << ml << " / " << mu << "\n";
+    }
+    return 0;
+}
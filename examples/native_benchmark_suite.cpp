@@ -0,0 +1,159 @@
+// µTBits benchmark suite for the native build.
+//
+//   native_benchmark_suite                 > baseline.json     store a baseline
+//   native_benchmark_suite baseline.json   > results.json      compare, exit code 1 on regression
+//
+// The suite runs three times and keeps the min-of-N per benchmark. The results are written as
+// JSON to stdout, regressions (min more than 10% plus the recorded spread above the baseline)
+// are listed on stderr.
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <utbenchmark.h>
+#include <utvector.h>
+#include <utmap.h>
+#include <utbuffer.h>
+#include <uthistory.h>
+#include <uthash.h>
+#include <utalgorithm.h>
+#include <utcolor_buffer.h>
+
+static int raw[256];
+static utb::ring_buffer<int, raw, 256> ring;
+
+static uint32_t data[1024];
+static uint32_t target[1024];
+static uint32_t sorted[1024];
+
+// Reads the "name", "min" and "mean" of every result line written by write_json().
+static std::vector<utb::bench::baseline_entry> load_baseline(const char* path, std::vector<std::string>& names) {
+    std::vector<utb::bench::baseline_entry> entries;
+    std::ifstream in(path);
+    std::string line;
+
+    while (std::getline(in, line)) {
+        const size_t n = line.find("\"name\": \"");
+        const size_t m = line.find("\"min\": ");
+        const size_t a = line.find("\"mean\": ");
+        if (n == std::string::npos || m == std::string::npos) continue;
+
+        const size_t start = n + 9;
+        const double min = std::stod(line.substr(m + 7));
+        const double mean = a == std::string::npos ? min : std::stod(line.substr(a + 8));
+        names.push_back(line.substr(start, line.find('"', start) - start));
+        entries.push_back({ nullptr, min, mean - min });
+    }
+    for (size_t i = 0; i < entries.size(); ++i) entries[i].name = names[i].c_str();
+    return entries;
+}
+
+static void run_suite(utb::bench::runner<32>& bench) {
+    uint32_t seed = 1;
+
+    // containers
+    bench.run("vector.push_back+clear", 1000, []() {
+        utb::vector<uint32_t, 64> v;
+        for (uint32_t i = 0; i < 64; ++i) v.push_back(i);
+        utb::bench::do_not_optimize(v);
+    });
+    bench.run("vector.insert_front", 1000, []() {
+        utb::vector<uint32_t, 32> v;
+        for (uint32_t i = 0; i < 32; ++i) v.insert(v.begin(), i);
+        utb::bench::do_not_optimize(v);
+    });
+
+    static utb::light_map<int, int, 128> map;
+    for (int i = 0; i < 96; ++i) map.insert(i * 7, i);   // no-op after the first round
+    bench.run("light_map.find", 10000, [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        const int* p = map.find(int((seed >> 16) % 96) * 7);
+        utb::bench::do_not_optimize(p);
+    });
+    bench.run("light_map.insert+erase", 10000, [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        const int key = int(seed >> 8) | 1;
+        map.insert(key, 1);
+        map.erase(key);
+    });
+
+    bench.run("ring_buffer.write+read", 10000, []() {
+        ring.write(42);
+        int v = ring.read();
+        utb::bench::do_not_optimize(v);
+    });
+
+    static utb::history<int32_t, 64> hist;
+    bench.run("history.push+min+avg", 10000, [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        hist.push(int32_t(seed >> 20));
+        int32_t v = hist.min() + hist.average();
+        utb::bench::do_not_optimize(v);
+    });
+
+    // hashing
+    bench.run("hash<uint32_t>", 10000, [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        utb::hash_type h = utb::hash<uint32_t>()(seed);
+        utb::bench::do_not_optimize(h);
+    });
+    bench.run("hash<const char*>.16", 10000, []() {
+        static const char* key = "temperature/0001";
+        utb::hash_type h = utb::hash<const char*>()(key);
+        utb::bench::do_not_optimize(h);
+    });
+
+    // algorithms
+    bench.run("fill_n.1024", 1000, []() { utb::fill_n(target, 1024, 0xA5A5A5A5u); });
+    bench.run("copy_n.1024", 1000, []() { utb::copy_n(data, 1024, target); });
+    bench.run("move_n.1024", 1000, []() { utb::move_n(target, 1000, target + 7); });
+    bench.run("fill_n.7", 10000, []() { utb::fill_n(target + 1, 7, 3u); });
+    bench.run("lower_bound.1024", 10000, [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        const uint32_t* p = utb::lower_bound(sorted, sorted + 1024, seed >> 10);
+        utb::bench::do_not_optimize(p);
+    });
+
+    // colors
+    bench.run("from_hsv<float>", 10000, [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        utb::graphic::color c = utb::graphic::from_hsv<float>(float(seed % 360), 0.8f, 0.9f);
+        utb::bench::do_not_optimize(c);
+    });
+    bench.run("from_hsv<float,lut>", 10000, [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        utb::graphic::color c = utb::graphic::from_hsv<float, true>(float(seed % 360), 0.8f, 0.9f);
+        utb::bench::do_not_optimize(c);
+    });
+    bench.run("from_hsv_fixed<grb888>", 10000, [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        utb::graphic::grb888 c = utb::graphic::from_hsv_fixed<utb::graphic::grb888>(uint8_t(seed >> 8), 200, 230);
+        utb::bench::do_not_optimize(c);
+    });
+    static utb::graphic::grb888_buffer<300> frame;
+    bench.run("grb888_buffer<300>.rainbow+scale", 100, []() {
+        frame.fill_rainbow(0, 1);
+        frame.scale(64);
+    });
+}
+
+int main(int argc, char** argv) {
+    utb::bench::runner<32> bench;
+
+    for (uint32_t i = 0; i < 1024; ++i) { data[i] = i * 2654435761u; sorted[i] = i * 4096u; }
+    for (int round = 0; round < 3; ++round) run_suite(bench);
+
+    auto out = [](const char* s) { std::cout << s; };
+    auto err = [](const char* s) { std::cerr << s; };
+
+    size_t regressions = 0;
+    if (argc > 1) {
+        std::vector<std::string> names;
+        std::vector<utb::bench::baseline_entry> baseline = load_baseline(argv[1], names);
+        regressions = bench.compare(baseline.data(), baseline.size(), 10, err);
+    }
+    bench.write_json(out);
+
+    return regressions ? 1 : 0;
+}
@@ -0,0 +1,72 @@
+#include <chrono>
+#include <iostream>
+#include <math.h>
+#include <utcolor_buffer.h>
+
+using namespace utb::graphic;
+
+// Keeps the optimizer from dropping the loops.
+static volatile float sinkf;
+static volatile uint8_t sink8;
+
+template <class TFn>
+static double ns_per_pixel(TFn fn, uint32_t pixels) {
+    fn(64);
+    auto start = std::chrono::steady_clock::now();
+    fn(pixels);
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / pixels;
+}
+
+int main() {
+    const uint32_t pixels = 4000000;
+
+    const double hsvFloat = ns_per_pixel([](uint32_t n) {
+        float acc = 0;
+        for (uint32_t i = 0; i < n; ++i) acc += from_hsv<float>(float(i % 360), 0.8f, 0.9f).g;
+        sinkf = acc;
+    }, pixels);
+    const double hsvLut = ns_per_pixel([](uint32_t n) {
+        float acc = 0;
+        for (uint32_t i = 0; i < n; ++i) acc += from_hsv<float, true>(float(i % 360), 0.8f, 0.9f).g;
+        sinkf = acc;
+    }, pixels);
+    const double hsvFixed = ns_per_pixel([](uint32_t n) {
+        uint8_t acc = 0;
+        for (uint32_t i = 0; i < n; ++i) acc += from_hsv_fixed<grb888>(uint8_t(i), 200, 230).g;
+        sink8 = acc;
+    }, pixels);
+    const double hsvFixedLut = ns_per_pixel([](uint32_t n) {
+        uint8_t acc = 0;
+        for (uint32_t i = 0; i < n; ++i) acc += from_hsv_fixed<grb888, true>(uint8_t(i), 200, 230).g;
+        sink8 = acc;
+    }, pixels);
+    const double yuvFloat = ns_per_pixel([](uint32_t n) {
+        float acc = 0;
+        for (uint32_t i = 0; i < n; ++i) acc += from_yuv<float>(float(i & 0xFF), float((i >> 3) & 0xFF), 100.0f).g;
+        sinkf = acc;
+    }, pixels);
+    const double yuvLut = ns_per_pixel([](uint32_t n) {
+        float acc = 0;
+        for (uint32_t i = 0; i < n; ++i) acc += from_yuv<float, true>(float(i & 0xFF), float((i >> 3) & 0xFF), 100.0f).g;
+        sinkf = acc;
+    }, pixels);
+    const double gammaPow = ns_per_pixel([](uint32_t n) {
+        uint8_t acc = 0;
+        for (uint32_t i = 0; i < n; ++i) acc += uint8_t(255.0f * powf((i & 0xFF) / 255.0f, 2.2f) + 0.5f);
+        sink8 = acc;
+    }, pixels);
+    const double gammaLut = ns_per_pixel([](uint32_t n) {
+        const gamma_lut<22>& lut = gamma_lut<22>::instance();
+        uint8_t acc = 0;
+        for (uint32_t i = 0; i < n; ++i) acc += lut[uint8_t(i)];
+        sink8 = acc;
+    }, pixels);
+
+    std::cout << "ns/pixel          float/exact   lut\n";
+    std::cout << "from_hsv          " << hsvFloat << "\t" << hsvLut << "\n";
+    std::cout << "from_hsv_fixed    " << hsvFixed << "\t" << hsvFixedLut << "\n";
+    std::cout << "from_yuv          " << yuvFloat << "\t" << yuvLut << "\n";
+    std::cout << "gamma 2.2         " << gammaPow << "\t" << gammaLut << "\n";
+    return 0;
+}
@@ -0,0 +1,57 @@
+// Fan-out of one sensor sample to many callbacks: multicast_delegate (one indirect call per callback
+// type, direct calls inside a type) against a loop over a basic_vector of utb::function.
+#include <iostream>
+#include <utbenchmark.h>
+#include <utdelegate.h>
+#include <utfunction.h>
+#include <utvector.h>
+
+using namespace utb;
+
+struct sample { int32_t value; };
+
+struct low_pass {
+    int32_t* state;
+    void operator()(const sample& s) const { *state += (s.value - *state) >> 3; }
+};
+struct threshold {
+    int32_t* hits;
+    int32_t limit;
+    void operator()(const sample& s) const { *hits += s.value > limit; }
+};
+
+static int32_t states[64], hits[64];
+
+template <int TCallbacks>
+static void measure() {
+    static basic_multicast_delegate<void(const sample&), TCallbacks, 2, sizeof(void*) * 2> delegate;
+    static basic_vector<function<void(const sample&)>, TCallbacks> vector;
+    bench::runner<2> runner;
+
+    for (int i = 0; i < TCallbacks; ++i) {
+        if (i % 2) { delegate.add(threshold{ &hits[i], 100 }); vector.push_back(threshold{ &hits[i], 100 }); }
+        else       { delegate.add(low_pass{ &states[i] });     vector.push_back(low_pass{ &states[i] }); }
+    }
+
+    int32_t _v = 0;
+    const bench::result* _vector = runner.run("vector<function>", 10000, [&_v]() {
+        const sample _s = { _v++ & 255 };
+        for (auto& f : vector) f(_s);
+    });
+    const bench::result* _delegate = runner.run("multicast_delegate", 10000, [&_v]() {
+        delegate(sample{ _v++ & 255 });
+    });
+
+    std::cout << TCallbacks << " callbacks   vector<function> " << _vector->min << "  multicast_delegate "
+              << _delegate->min << "  (" << _vector->min / _delegate->min << "x)\n";
+}
+
+int main() {
+    std::cout << "per sample, in " << bench::cycle_counter::unit() << "\n\n";
+    measure<4>();
+    measure<16>();
+    measure<64>();
+    bench::do_not_optimize(states);
+    bench::do_not_optimize(hits);
+    return 0;
+}
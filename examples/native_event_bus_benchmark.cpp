@@ -0,0 +1,49 @@
+// Event bus dispatch latency: publish() to 1, 4 and 16 subscribers, compared with calling the same
+// handlers directly, and the deferred path post() + dispatch().
+#include <iostream>
+#include <utbenchmark.h>
+#include <utevent_bus.h>
+
+using namespace utb;
+
+struct sample { uint32_t value; };
+struct other { uint8_t x; };
+
+static uint32_t sink;
+
+template <utb::size_t TSubscribers>
+static void measure() {
+    static basic_event_bus<TSubscribers, 64, sample, other> bus;
+    static function<void(const sample&)> direct[TSubscribers];
+    bench::runner<3> runner;
+
+    for (utb::size_t i = 0; i < TSubscribers; ++i) {
+        bus.template subscribe<sample>([](const sample& e) { sink += e.value; });
+        direct[i] = [](const sample& e) { sink += e.value; };
+    }
+
+    uint32_t _v = 0;
+    const bench::result* _direct = runner.run("direct", 10000, [&_v]() {
+        const sample _e = { ++_v };
+        for (utb::size_t i = 0; i < TSubscribers; ++i) direct[i](_e);
+    });
+    const bench::result* _publish = runner.run("publish", 10000, [&_v]() {
+        bus.publish(sample{ ++_v });
+    });
+    const bench::result* _deferred = runner.run("post+dispatch", 10000, [&_v]() {
+        bus.post(sample{ ++_v });
+        bus.dispatch();
+    });
+
+    std::cout << TSubscribers << " subscribers   direct " << _direct->min << "  publish " << _publish->min
+              << "  post+dispatch " << _deferred->min << "  (" << _publish->min / TSubscribers << " per handler)\n";
+}
+
+int main() {
+    std::cout << "per event, in " << bench::cycle_counter::unit() << "\n\n";
+    measure<1>();
+    measure<4>();
+    measure<16>();
+    bench::do_not_optimize(sink);
+    return 0;
+}
@@ -0,0 +1,142 @@
+// 1024 values through the fast functions of utfastmath.h at each precision against the C library:
+// the maximal error, max(1, |exact|) scaled, and the cycles per batch, for float and fixed16_16.
+#include <iostream>
+#include <math.h>
+#include <utbenchmark.h>
+#include <utfastmath.h>
+
+using namespace utb;
+using namespace utb::math;
+
+static const utb::size_t count = 1024;
+enum { fn_sin, fn_atan2, fn_exp, fn_log, fn_sqrt, fn_count };
+static const char* const fn_names[fn_count] = { "sin  ", "atan2", "exp  ", "log  ", "sqrt " };
+
+static float x[count], y[count], positive[count], out[count];
+static fixed16_16 fx[count], fy[count], fpositive[count], fout[count];
+static double exact[fn_count][count];
+
+static double max_error(const double* pExact, const float* pOut) {
+    double _max = 0;
+    for (utb::size_t i = 0; i < count; ++i) {
+        const double _scale = ::fabs(pExact[i]) > 1.0 ? ::fabs(pExact[i]) : 1.0;
+        const double _err = ::fabs(double(pOut[i]) - pExact[i]) / _scale;
+        if (_err > _max) _max = _err;
+    }
+    return _max;
+}
+static double max_error(const double* pExact, const fixed16_16* pOut) {
+    static float _out[count];
+    for (utb::size_t i = 0; i < count; ++i) _out[i] = float(pOut[i]);
+    return max_error(pExact, _out);
+}
+
+struct row { double cycles[fn_count]; double error[fn_count]; };
+
+template <class TPolicy>
+static row run_float(bench::runner<48>& runner, const char* name) {
+    row _r;
+    _r.cycles[fn_sin] = runner.run(name, 100, []() { sin_n<TPolicy>(x, out, count); })->min;
+    _r.error[fn_sin] = max_error(exact[fn_sin], out);
+    _r.cycles[fn_atan2] = runner.run(name, 100, []() { atan2_n<TPolicy>(y, x, out, count); })->min;
+    _r.error[fn_atan2] = max_error(exact[fn_atan2], out);
+    _r.cycles[fn_exp] = runner.run(name, 100, []() { exp_n<TPolicy>(x, out, count); })->min;
+    _r.error[fn_exp] = max_error(exact[fn_exp], out);
+    _r.cycles[fn_log] = runner.run(name, 100, []() { log_n<TPolicy>(positive, out, count); })->min;
+    _r.error[fn_log] = max_error(exact[fn_log], out);
+    _r.cycles[fn_sqrt] = runner.run(name, 100, []() { sqrt_n<TPolicy>(positive, out, count); })->min;
+    _r.error[fn_sqrt] = max_error(exact[fn_sqrt], out);
+    return _r;
+}
+
+template <class TPolicy>
+static row run_fixed(bench::runner<48>& runner, const char* name) {
+    row _r;
+    _r.cycles[fn_sin] = runner.run(name, 100, []() { sin_n<TPolicy>(fx, fout, count); })->min;
+    _r.error[fn_sin] = max_error(exact[fn_sin], fout);
+    _r.cycles[fn_atan2] = runner.run(name, 100, []() { atan2_n<TPolicy>(fy, fx, fout, count); })->min;
+    _r.error[fn_atan2] = max_error(exact[fn_atan2], fout);
+    _r.cycles[fn_exp] = runner.run(name, 100, []() { exp_n<TPolicy>(fx, fout, count); })->min;
+    _r.error[fn_exp] = max_error(exact[fn_exp], fout);
+    _r.cycles[fn_log] = runner.run(name, 100, []() { log_n<TPolicy>(fpositive, fout, count); })->min;
+    _r.error[fn_log] = max_error(exact[fn_log], fout);
+    _r.cycles[fn_sqrt] = runner.run(name, 100, []() { sqrt_n<TPolicy>(fpositive, fout, count); })->min;
+    _r.error[fn_sqrt] = max_error(exact[fn_sqrt], fout);
+    return _r;
+}
+
+static void print(const char* title, const row* rows, const char* const* names, utb::size_t n) {
+    std::cout << "\n" << title << "\n";
+    for (int f = 0; f < fn_count; ++f) {
+        std::cout << "  " << fn_names[f];
+        for (utb::size_t k = 0; k < n; ++k)
+            std::cout << "  " << names[k] << " " << rows[k].cycles[f] << " (" << rows[k].error[f] << ")";
+        std::cout << "\n";
+    }
+}
+
+int main() {
+    // angles in [-8, 8], exp arguments in the same range, log and sqrt over [0.01, 1000]
+    for (utb::size_t i = 0; i < count; ++i) {
+        x[i] = float(fixed16_16(16.0 * double(i) / count - 8.0));
+        y[i] = float(fixed16_16(5.0 - 9.0 * double((i * 7) % count) / count));
+        positive[i] = float(fixed16_16(0.01 * ::pow(1e5, double(i) / count)));
+        fx[i] = fixed16_16(x[i]); fy[i] = fixed16_16(y[i]); fpositive[i] = fixed16_16(positive[i]);
+
+        exact[fn_sin][i] = ::sin(double(x[i]));
+        exact[fn_atan2][i] = ::atan2(double(y[i]), double(x[i]));
+        exact[fn_exp][i] = ::exp(double(x[i]));
+        exact[fn_log][i] = ::log(double(positive[i]));
+        exact[fn_sqrt][i] = ::sqrt(double(positive[i]));
+    }
+
+    bench::runner<48> runner;
+
+    row _libm;
+    _libm.cycles[fn_sin] = runner.run("sinf", 100, []() { for (utb::size_t i = 0; i < count; ++i) out[i] = ::sinf(x[i]); })->min;
+    _libm.error[fn_sin] = max_error(exact[fn_sin], out);
+    _libm.cycles[fn_atan2] = runner.run("atan2f", 100, []() { for (utb::size_t i = 0; i < count; ++i) out[i] = ::atan2f(y[i], x[i]); })->min;
+    _libm.error[fn_atan2] = max_error(exact[fn_atan2], out);
+    _libm.cycles[fn_exp] = runner.run("expf", 100, []() { for (utb::size_t i = 0; i < count; ++i) out[i] = ::expf(x[i]); })->min;
+    _libm.error[fn_exp] = max_error(exact[fn_exp], out);
+    _libm.cycles[fn_log] = runner.run("logf", 100, []() { for (utb::size_t i = 0; i < count; ++i) out[i] = ::logf(positive[i]); })->min;
+    _libm.error[fn_log] = max_error(exact[fn_log], out);
+    _libm.cycles[fn_sqrt] = runner.run("sqrtf", 100, []() { for (utb::size_t i = 0; i < count; ++i) out[i] = ::sqrtf(positive[i]); })->min;
+    _libm.error[fn_sqrt] = max_error(exact[fn_sqrt], out);
+
+    const row _float[4] = { _libm, run_float<approx_fast>(runner, "float fast"),
+                            run_float<approx_precise>(runner, "float precise"), run_float<approx_full>(runner, "float full") };
+
+    // fixed16_16 without the fast functions: the CORDIC of utfixed.h for sin, libm through double for the rest
+    row _plain;
+    _plain.cycles[fn_sin] = runner.run("fixed sin", 100, []() { for (utb::size_t i = 0; i < count; ++i) fout[i] = fixed_point::sin(fx[i]); })->min;
+    _plain.error[fn_sin] = max_error(exact[fn_sin], fout);
+    _plain.cycles[fn_atan2] = runner.run("fixed atan2 double", 100, []() {
+        for (utb::size_t i = 0; i < count; ++i) fout[i] = fixed16_16(::atan2(double(fy[i]), double(fx[i])));
+    })->min;
+    _plain.error[fn_atan2] = max_error(exact[fn_atan2], fout);
+    _plain.cycles[fn_exp] = runner.run("fixed exp double", 100, []() {
+        for (utb::size_t i = 0; i < count; ++i) fout[i] = fixed16_16(::exp(double(fx[i])));
+    })->min;
+    _plain.error[fn_exp] = max_error(exact[fn_exp], fout);
+    _plain.cycles[fn_log] = runner.run("fixed log double", 100, []() {
+        for (utb::size_t i = 0; i < count; ++i) fout[i] = fixed16_16(::log(double(fpositive[i])));
+    })->min;
+    _plain.error[fn_log] = max_error(exact[fn_log], fout);
+    _plain.cycles[fn_sqrt] = runner.run("fixed sqrt", 100, []() { for (utb::size_t i = 0; i < count; ++i) fout[i] = fixed_point::sqrt(fpositive[i]); })->min;
+    _plain.error[fn_sqrt] = max_error(exact[fn_sqrt], fout);
+
+    const row _fixed[4] = { _plain, run_fixed<approx_fast>(runner, "fixed fast"),
+                            run_fixed<approx_precise>(runner, "fixed precise"), run_fixed<approx_full>(runner, "fixed full") };
+
+    static const char* const _float_names[4] = { "libm", "fast", "precise", "full" };
+    static const char* const _fixed_names[4] = { "utfixed/double", "fast", "precise", "full" };
+
+    std::cout << count << " values, " << bench::cycle_counter::unit() << " per batch (max error)\n";
+    print("float", _float, _float_names, 4);
+    print("fixed16_16", _fixed, _fixed_names, 4);
+
+    bench::do_not_optimize(out);
+    bench::do_not_optimize(fout);
+    return 0;
+}
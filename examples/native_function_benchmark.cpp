@@ -0,0 +1,62 @@
+// Call overhead of the callable wrappers against a plain function pointer.
+//
+// The callers are noinline and take the wrapper by reference, as in a driver callback, so the
+// compiler cannot see through the call. "copy" measures copying the wrapper, the cost a queue or
+// timer pays per stored callback.
+#include <iostream>
+#include <functional>
+#include <utbenchmark.h>
+#include <utfunction.h>
+
+using namespace utb;
+
+static uint32_t state;
+static void add(uint32_t x) { state += x; }
+
+using fn_ptr = void (*)(uint32_t);
+
+__attribute__((noinline)) static void call(fn_ptr f, uint32_t x)                             { f(x); }
+__attribute__((noinline)) static void call(const function<void(uint32_t)>& f, uint32_t x)    { f(x); }
+__attribute__((noinline)) static void call(function_ref<void(uint32_t)> f, uint32_t x)       { f(x); }
+__attribute__((noinline)) static void call(const std::function<void(uint32_t)>& f, uint32_t x) { f(x); }
+
+struct accumulator {
+    uint32_t* target;
+    uint32_t scale;
+    void operator()(uint32_t x) const { *target += x * scale; }
+};
+
+int main() {
+    bench::runner<8> runner;
+    uint32_t _x = 0;
+
+    fn_ptr _ptr = &add;
+    function<void(uint32_t)> _light = accumulator{ &state, 3 };
+    accumulator _object = { &state, 3 };
+    function_ref<void(uint32_t)> _ref = _object;
+    std::function<void(uint32_t)> _std = accumulator{ &state, 3 };
+
+    const bench::result* _rPtr = runner.run("function pointer", 100000, [&]() { call(_ptr, ++_x); });
+    const bench::result* _rLight = runner.run("utb::function", 100000, [&]() { call(_light, ++_x); });
+    const bench::result* _rRef = runner.run("utb::function_ref", 100000, [&]() { call(_ref, ++_x); });
+    const bench::result* _rStd = runner.run("std::function", 100000, [&]() { call(_std, ++_x); });
+
+    const bench::result* _cLight = runner.run("copy utb::function", 100000, [&]() {
+        function<void(uint32_t)> _copy = _light;
+        bench::do_not_optimize(_copy);
+    });
+    const bench::result* _cStd = runner.run("copy std::function", 100000, [&]() {
+        std::function<void(uint32_t)> _copy = _std;
+        bench::do_not_optimize(_copy);
+    });
+
+    std::cout << "per call, in " << bench::cycle_counter::unit() << "\n\n";
+    std::cout << "function pointer      " << _rPtr->min << "\n";
+    std::cout << "utb::function         " << _rLight->min << "\n";
+    std::cout << "utb::function_ref     " << _rRef->min << "\n";
+    std::cout << "std::function         " << _rStd->min << "\n\n";
+    std::cout << "copy utb::function    " << _cLight->min << "\n";
+    std::cout << "copy std::function    " << _cStd->min << "\n";
+    bench::do_not_optimize(state);
+    return 0;
+}
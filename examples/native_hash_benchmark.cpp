@@ -0,0 +1,68 @@
+// Throughput and distribution of the uthash.h algorithms.
+//
+// The first table lists counter units per byte for key lengths 4 - 1024, the second the
+// chi-square of 64 buckets over sequential integer keys and generated string keys. A good hash
+// stays close to the bucket count (63 degrees of freedom), a bad one is far above it.
+#include <iostream>
+#include <stdio.h>
+#include <utbenchmark.h>
+#include <uthash.h>
+
+using namespace utb;
+
+static uint8_t key[1024];
+
+template <class TAlgorithm>
+static double units_per_byte(bench::runner<1>& runner, utb::size_t len) {
+    const bench::result* r = runner.run("hash", 2000, [len]() {
+        typename TAlgorithm::result_type h = hash_bytes<TAlgorithm>(key, len, 0);
+        bench::do_not_optimize(h);
+    });
+    return r->min / len;
+}
+
+template <class TFn>
+static double chi_square(TFn bucketOf, uint32_t keys) {
+    uint32_t buckets[64] = { 0 };
+    for (uint32_t i = 0; i < keys; ++i) ++buckets[bucketOf(i) & 63];
+
+    const double expected = keys / 64.0;
+    double chi = 0;
+    for (int b = 0; b < 64; ++b) chi += (buckets[b] - expected) * (buckets[b] - expected) / expected;
+    return chi;
+}
+
+template <class TAlgorithm>
+static uint64_t hash_name(uint32_t i) {
+    char name[24];
+    const int n = snprintf(name, sizeof(name), "sensor/%u", unsigned(i));
+    return uint64_t(hash_bytes<TAlgorithm>(name, utb::size_t(n), 0));
+}
+
+int main() {
+    for (unsigned i = 0; i < sizeof(key); ++i) key[i] = uint8_t(i * 31 + 7);
+
+    std::cout << "bytes   fnv1a32  murmur3_32  murmur3_128  xxh64   (" << bench::cycle_counter::unit() << "/byte)\n";
+    for (utb::size_t len = 4; len <= 1024; len *= 4) {
+        bench::runner<1> a, b, c, d;
+        printf("%5u   %7.2f  %10.2f  %11.2f  %5.2f\n", unsigned(len),
+               units_per_byte<hash_algorithm::fnv1a32>(a, len),
+               units_per_byte<hash_algorithm::murmur3_32>(b, len),
+               units_per_byte<hash_algorithm::murmur3_128>(c, len),
+               units_per_byte<hash_algorithm::xxh64>(d, len));
+    }
+
+    const uint32_t keys = 64000;
+    std::cout << "\nchi-square over 64 buckets, " << keys << " keys\n";
+    printf("ints  * 16, multiply (old hash<uint32_t>)  %10.1f\n",
+           chi_square([](uint32_t i) { return uint32_t(i * 16 * UTB_CONFIG_BASIC_HASHMUL_VAL); }, keys));
+    printf("ints  * 16, mix32                          %10.1f\n",
+           chi_square([](uint32_t i) { return mix32(i * 16); }, keys));
+    printf("ints  * 16, mix64                          %10.1f\n",
+           chi_square([](uint32_t i) { return mix64(uint64_t(i) * 16); }, keys));
+    printf("names, fnv1a32                             %10.1f\n", chi_square(hash_name<hash_algorithm::fnv1a32>, keys));
+    printf("names, murmur3_32                          %10.1f\n", chi_square(hash_name<hash_algorithm::murmur3_32>, keys));
+    printf("names, murmur3_128                         %10.1f\n", chi_square(hash_name<hash_algorithm::murmur3_128>, keys));
+    printf("names, xxh64                               %10.1f\n", chi_square(hash_name<hash_algorithm::xxh64>, keys));
+    return 0;
+}
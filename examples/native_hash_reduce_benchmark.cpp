@@ -0,0 +1,69 @@
+// Cost of reducing a hash to a bucket index, modulo vs. mask vs. fastrange.
+//
+// "reduce" hides the table size from the compiler, as on a target where the division is a library
+// call (AVR, Cortex-M0). "light_map.find" uses the constant capacity of the map, there the compiler
+// may already turn the modulo into a multiply, the difference left is the reduction itself.
+#include <iostream>
+#include <utbenchmark.h>
+#include <utmap.h>
+
+using namespace utb;
+
+static volatile utb::size_t opaque_size;
+
+template <class TReduce>
+static double reduce_cost(utb::size_t n) {
+    bench::runner<1> runner;
+    uint32_t seed = 1;
+
+    opaque_size = n;
+    const bench::result* r = runner.run("reduce", 10000, [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        hash_type b = TReduce::reduce(hash_type(mix32(seed)), opaque_size);
+        bench::do_not_optimize(b);
+    });
+    return r->min;
+}
+
+template <utb::size_t TCapacity, class TReduce>
+static double find_cost() {
+    using backend = basic_hash_table<uint32_t, uint32_t, TCapacity, hash_function<uint32_t, TReduce> >;
+    static light_map<uint32_t, uint32_t, TCapacity, backend> map;
+    bench::runner<1> runner;
+    uint32_t seed = 1;
+
+    for (uint32_t i = 0; i < TCapacity * 3 / 4; ++i) map.insert(i * 7, i);
+    const bench::result* r = runner.run("find", 10000, [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        const uint32_t* p = map.find(((seed >> 16) % (TCapacity * 3 / 4)) * 7);
+        bench::do_not_optimize(p);
+    });
+    return r->min;
+}
+
+template <utb::size_t TCapacity>
+static void print_find() {
+    std::cout << "light_map<" << TCapacity << ">.find   modulo " << find_cost<TCapacity, hash_reduce::modulo>()
+              << "  automatic " << find_cost<TCapacity, hash_reduce::automatic>()
+              << "  fastrange " << find_cost<TCapacity, hash_reduce::fastrange>() << "\n";
+}
+
+int main() {
+    std::cout << "per operation, in " << bench::cycle_counter::unit() << "\n\n";
+
+    static const utb::size_t sizes[] = { 16, 64, 100, 128, 250, 256 };
+    for (utb::size_t n : sizes) {
+        std::cout << "reduce n=" << n << "   modulo " << reduce_cost<hash_reduce::modulo>(n)
+                  << "  fastrange " << reduce_cost<hash_reduce::fastrange>(n);
+        if ((n & (n - 1)) == 0) std::cout << "  mask " << reduce_cost<hash_reduce::mask>(n);
+        std::cout << "\n";
+    }
+    std::cout << "\n";
+
+    print_find<16>();
+    print_find<64>();
+    print_find<100>();
+    print_find<128>();
+    print_find<250>();
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include <utmpmc_queue.h>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+static utb::mpmc_queue<uint32_t, 1024> queue;
+
+// Runs 'threads' producers and 'threads' consumers over one queue and returns million ops/s.
+static double run(unsigned threads, uint32_t perProducer) {
+    std::atomic<uint64_t> sum(0);
+    std::vector<std::thread> workers;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([perProducer]() {
+            for (uint32_t i = 1; i <= perProducer; ) {
+                if (queue.try_push(i)) ++i;
+                else std::this_thread::yield();
+            }
+        });
+        workers.emplace_back([perProducer, &sum]() {
+            uint64_t local = 0;
+            uint32_t v;
+            for (uint32_t i = 0; i < perProducer; ) {
+                if (queue.try_pop(v)) { local += v; ++i; }
+                else std::this_thread::yield();
+            }
+            sum += local;
+        });
+    }
+    for (auto& w : workers) w.join();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    const uint64_t expected = uint64_t(threads) * (uint64_t(perProducer) * (perProducer + 1) / 2);
+    if (sum != expected) std::cout << "  checksum mismatch!\n";
+
+    return (2.0 * threads * perProducer) / elapsed.count() / 1e6;
+}
+
+int main() {
+    unsigned maxThreads = std::thread::hardware_concurrency();
+    if (maxThreads < 2) maxThreads = 2;
+
+    std::cout << "producers+consumers  Mops/s\n";
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2)
+        std::cout << threads << "+" << threads << "                  " << run(threads, 500000) << "\n";
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+// Scheduler overhead: dispatch throughput and the latency from post_from_isr() to the start of the task.
+//
+// "dispatch" posts one task and runs it, the whole cost of a scheduled call. "dispatch, 64 tasks"
+// keeps 64 tasks over 8 priorities ready, the pick stays O(1). The latency test posts from a
+// second thread, standing in for an interrupt, and measures until the task starts.
+#include <iostream>
+#include <thread>
+#include <atomic>
+#include <utbenchmark.h>
+#include <utscheduler.h>
+
+using namespace utb;
+
+using clock_type = bench::cycle_counter;
+static scheduler<64, 8> sched;
+static uint32_t work;
+
+static std::atomic<clock_type::value_type> posted_at;
+static std::atomic<uint32_t> latency_samples;
+static clock_type::value_type latency_min = ~clock_type::value_type(0), latency_max, latency_sum;
+static const uint32_t latency_rounds = 10000;
+
+int main() {
+    bench::runner<4> runner;
+
+    for (uint8_t i = 0; i < 64; ++i) sched.create(i % 8, []() { ++work; });
+
+    const bench::result* _single = runner.run("dispatch", 100000, []() {
+        sched.post(0);
+        sched.run_once();
+    });
+
+    const bench::result* _many = runner.run("dispatch, 64 tasks", 10000, []() {
+        for (task_id i = 0; i < 64; ++i) sched.post(i);
+        bench::do_not_optimize(work);
+        while (sched.run_once()) { }
+    });
+
+    // a separate scheduler for the latency: one task that reads the clock when it starts
+    static scheduler<1, 1> _latency;
+    _latency.create(0, []() {
+        const clock_type::value_type _d = clock_type::now() - posted_at.load(std::memory_order_acquire);
+        if (_d < latency_min) latency_min = _d;
+        if (_d > latency_max) latency_max = _d;
+        latency_sum += _d;
+        latency_samples.fetch_add(1, std::memory_order_release);
+    });
+
+    std::thread _isr([]() {
+        for (uint32_t i = 0; i < latency_rounds; ++i) {
+            posted_at.store(clock_type::now(), std::memory_order_release);
+            _latency.post_from_isr(0);
+            while (latency_samples.load(std::memory_order_acquire) == i) std::this_thread::yield();
+        }
+    });
+    while (latency_samples.load(std::memory_order_acquire) < latency_rounds) _latency.run_once();
+    _isr.join();
+
+    std::cout << "per operation, in " << clock_type::unit() << "\n\n";
+    std::cout << "dispatch (post + run)      " << _single->min << "\n";
+    std::cout << "dispatch, 64 tasks         " << _many->min / 64 << " per task\n";
+    std::cout << "post_from_isr -> run       min " << latency_min << "  avg " << latency_sum / latency_samples
+              << "  max " << latency_max << " (" << latency_rounds << " samples)\n";
+    return 0;
+}
@@ -0,0 +1,71 @@
+// Cost of one tick with many pending periodic timers, timer wheel vs. a naive scan over all timers.
+//
+// Every timer restarts itself with a pseudo random period when it fires, so the number of pending
+// timers stays constant. The naive scan touches every timer on every tick, the wheel only the due
+// slot (and one slot of an upper level every 64 ticks).
+#include <iostream>
+#include <utbenchmark.h>
+#include <uttimer_wheel.h>
+
+using namespace utb;
+
+static const uint32_t timer_count = 10000;
+static uint32_t period_seed = 1;
+
+static uint32_t next_period() {
+    period_seed = period_seed * 1103515245u + 12345u;
+    return 1 + ((period_seed >> 8) & 4095);
+}
+
+using wheel_type = basic_timer_wheel<timer_count>;
+static wheel_type wheel;
+static uint32_t fired;
+
+struct periodic {
+    void operator()() const {
+        ++fired;
+        wheel.schedule(next_period(), periodic());
+    }
+};
+
+struct naive_timer {
+    uint32_t due;
+    function<void()> callback;
+};
+static naive_timer naive[timer_count];
+static uint32_t naive_now;
+
+static void naive_tick() {
+    ++naive_now;
+    for (uint32_t i = 0; i < timer_count; ++i) {
+        if (naive[i].due != naive_now) continue;
+        naive[i].callback();
+        naive[i].due = naive_now + next_period();
+    }
+}
+
+int main() {
+    bench::runner<4> runner;
+
+    for (uint32_t i = 0; i < timer_count; ++i) {
+        naive[i].due = next_period();
+        naive[i].callback = []() { ++fired; };
+        wheel.schedule(next_period(), periodic());
+    }
+
+    const bench::result* _naive = runner.run("naive scan tick", 1000, []() { naive_tick(); });
+    const bench::result* _wheel = runner.run("timer wheel tick", 1000, []() { utb::size_t n = wheel.tick(); bench::do_not_optimize(n); });
+
+    const bench::result* _churn = runner.run("timer wheel schedule+cancel", 10000, []() {
+        timer_id _id = wheel.schedule(next_period(), []() { });
+        bool _cancelled = wheel.cancel(_id);
+        bench::do_not_optimize(_cancelled);
+    });
+
+    std::cout << timer_count << " pending timers, per operation, in " << bench::cycle_counter::unit() << "\n\n";
+    std::cout << "tick      naive scan " << _naive->min << "  timer wheel " << _wheel->min
+              << "  (" << _naive->min / _wheel->min << "x)\n";
+    std::cout << "schedule + cancel      " << _churn->min << "\n";
+    std::cout << fired << " callbacks\n";
+    return 0;
+}
@@ -0,0 +1,64 @@
+// IMU-style batch of 1024 vector3<float>: the scalar per-vector functions of utvector3.h against
+// the batch kernels of utvector_batch.h, on AoS arrays and on SoA columns.
+#include <iostream>
+#include <utbenchmark.h>
+#include <utvector_batch.h>
+
+using namespace utb;
+using namespace utb::math;
+
+static const utb::size_t count = 1024;
+
+static vector3<float> input[count], output[count];
+static soa_array3<float, count> columns;
+
+int main() {
+    for (utb::size_t i = 0; i < count; ++i)
+        input[i] = vector3<float>(float(i % 17) - 8.0f, float(i % 5) + 0.5f, 3.0f - float(i % 11));
+    columns.assign(input, count);
+
+    const vector4<float> _q(0.0f, 0.38268343f, 0.0f, 0.92387953f);     // 45 degrees about y
+    bench::runner<8> runner;
+
+    const bench::result* _scalar = runner.run("normalize (scalar)", 200, []() {
+        for (utb::size_t i = 0; i < count; ++i) output[i] = normalize(input[i]);
+    });
+    const bench::result* _exact = runner.run("normalize_n exact", 200, []() {
+        normalize_n(input, output, count);
+    });
+    const bench::result* _precise = runner.run("normalize_n precise", 200, []() {
+        normalize_n<rsqrt_precise>(input, output, count);
+    });
+    const bench::result* _fast = runner.run("normalize_n fast", 200, []() {
+        normalize_n<rsqrt_fast>(input, output, count);
+    });
+    const bench::result* _soa = runner.run("normalize_n fast, SoA", 200, []() {
+        soa_view3<float> _v = columns.view();
+        normalize_n<rsqrt_fast>(_v, _v);
+    });
+
+    const bench::result* _rotate_scalar = runner.run("rotate (scalar)", 200, [&_q]() {
+        const vector3<float> _u(_q.x, _q.y, _q.z);
+        for (utb::size_t i = 0; i < count; ++i) {
+            vector3<float> _t = cross(_u, input[i]) * 2.0f;
+            output[i] = input[i] + _t * _q.w + cross(_u, _t);
+        }
+    });
+    const bench::result* _rotate = runner.run("rotate_n", 200, [&_q]() {
+        rotate_n(_q, input, output, count);
+    });
+    const bench::result* _rotate_soa = runner.run("rotate_n, SoA", 200, [&_q]() {
+        soa_view3<float> _v = columns.view();
+        rotate_n(_q, _v, _v);
+    });
+
+    std::cout << count << " vectors, in " << bench::cycle_counter::unit() << "\n\n"
+              << "normalize  scalar " << _scalar->min << "  exact " << _exact->min << "  precise " << _precise->min
+              << "  fast " << _fast->min << "  fast SoA " << _soa->min << "\n"
+              << "rotate     scalar " << _rotate_scalar->min << "  batch " << _rotate->min
+              << "  batch SoA " << _rotate_soa->min << "\n";
+
+    bench::do_not_optimize(output);
+    bench::do_not_optimize(columns);
+    return 0;
+}
@@ -58,7 +58,7 @@ namespace utb {
             static void store (volatile_pointer obj, value_type v, memory_order order = memory_order::SeqCst)
                 { __atomic_store_n (obj, v, static_cast<int>(order)); }
 
-            static value_type load (volatile_pointer obj, memory_order order = memory_order::SeqCst)
+            static value_type load (const volatile T* obj, memory_order order = memory_order::SeqCst)
                 { return __atomic_load_n (obj, static_cast<int>(order)); }
 
             static value_type exchange (volatile_pointer obj, value_type v, memory_order order = memory_order::SeqCst)
@@ -67,10 +67,17 @@ namespace utb {
             static bool compare_exchange_n (volatile_pointer obj,value_type& expected, value_type& desired, bool b,
                                     memory_order order = memory_order::SeqCst)
                 { return __atomic_compare_exchange_n (obj, &expected, desired, b,
-                                                    order, static_cast<int>(order)); }
+                                                    static_cast<int>(order), static_cast<int>(failure_order(order))); }
 
             static bool compare_exchange(volatile_pointer obj,value_type& expected, value_type& desired, int i, memory_order order = memory_order::SeqCst)
-                { return _atomic_compare_exchange (obj, &expected, &desired, i, order, static_cast<int>(order)); }
+                { return __atomic_compare_exchange (obj, &expected, &desired, i,
+                                                    static_cast<int>(order), static_cast<int>(failure_order(order))); }
+
+            /// The failure order of a compare-exchange may not contain a release part.
+            static constexpr memory_order failure_order(memory_order order) {
+                return order == memory_order::AcqRel ? memory_order::Acquire
+                     : order == memory_order::Release ? memory_order::Relaxed : order;
+            }
 
             
 
@@ -12,8 +12,13 @@
 #include "uttypes.h"
 #include "uttypetraits.h"
 #include "utiterator.h"
+#include "utfunctional.h"
+#include "utsimd.h"
 
 #include <climits>
+#include <new>
+#include <string.h>
+#include <assert.h>
 
 namespace utb {
 
@@ -48,22 +53,22 @@ namespace utb {
 
         template<typename T>
         void copy_n(const T* first, utb::size_t n, T* result, utb::int_to_type<false>) {
-            const T* last = first + n;
-
-            while (first != last) {
-                switch (n & 0x3) {
-                    case 0: *result++ = *first++;
-                    case 3: *result++ = *first++;
-                    case 2: *result++ = *first++;
-                    case 1: *result++ = *first++;
-                }
+            for (utb::size_t rest = n >> 2; rest > 0; --rest) {
+                *result++ = *first++; *result++ = *first++;
+                *result++ = *first++; *result++ = *first++;
             }
+            for (utb::size_t rest = n & 0x3; rest > 0; --rest) *result++ = *first++;
         }
 
         template<typename T>
         void copy_n(const T* first, utb::size_t n, T* result, utb::int_to_type<true>) {
             assert(result >= first + n || result < first);
-            memcpy(result, first, n * sizeof(T));
+            // tiny ranges: element stores beat the byte kernels
+            if (n * sizeof(T) < simd::tiny_limit) {
+                for (utb::size_t i = 0; i < n; ++i) result[i] = first[i];
+                return;
+            }
+            simd::copy_bytes(result, first, n * sizeof(T));
         }
 
         template<typename T>
@@ -75,7 +80,7 @@ namespace utb {
         template<typename T>
         void copy(const T* first, const T* last, T* result, utb::int_to_type<true>) {
             const utb::size_t n = reinterpret_cast<const char*>(last) - reinterpret_cast<const char*>(first);
-            memcpy(result, first, n);
+            simd::copy_bytes(result, first, n);
         }
 
         template<typename T>
@@ -86,7 +91,12 @@ namespace utb {
 
         template<typename T>
         inline void move_n(const T* first, utb::size_t n, T* result, utb::int_to_type<true>) {
-            memmove(result, first, n * sizeof(T));
+            if (n * sizeof(T) < simd::tiny_limit) {
+                if (result < first) for (utb::size_t i = 0; i < n; ++i) result[i] = first[i];
+                else for (utb::size_t i = n; i > 0; --i) result[i - 1] = first[i - 1];
+                return;
+            }
+            simd::move_bytes(result, first, n * sizeof(T));
         }
 
         template<typename T>
@@ -98,7 +108,7 @@ namespace utb {
         template<typename T>
         inline  void move(const T* first, const T* last, T* result, utb::int_to_type<true>) {
             const utb::size_t n = reinterpret_cast<uintptr_t>(last) - reinterpret_cast<uintptr_t>(first);
-            memmove(result, first, n);
+            simd::move_bytes(result, first, n);
         }
 
 
@@ -111,7 +121,7 @@ namespace utb {
         template<typename T>
         void copy_construct_n(const T* first, utb::size_t n, T* result, utb::int_to_type<true>) {
             assert(result >= first + n || result < first);
-            memcpy(result, first, n * sizeof(T));
+            simd::copy_bytes(result, first, n * sizeof(T));
         }
 
         template<typename T>
@@ -179,6 +189,29 @@ namespace utb {
          	return pred(a, b);
         }
 
+        template<typename T>
+        inline void fill_n(T* src, utb::size_t n, const T& val, utb::int_to_type<false>) {
+            for (utb::size_t rest = n >> 2; rest > 0; --rest) {
+                *src++ = val; *src++ = val;
+                *src++ = val; *src++ = val;
+            }
+            for (utb::size_t rest = n & 0x3; rest > 0; --rest) *src++ = val;
+        }
+
+        template<typename T>
+        inline void fill_n(T* src, utb::size_t n, const T& val, utb::int_to_type<true>) {
+            if (n * sizeof(T) < simd::tiny_limit) {
+                for (utb::size_t i = 0; i < n; ++i) src[i] = val;
+                return;
+            }
+            simd::fill_pattern(src, n * sizeof(T), simd::widen_pattern(&val, sizeof(T)));
+        }
+
+        /// Pattern fill for trivially copyable 1, 2, 4 and 8 byte types, element loop otherwise.
+        template<typename T>
+        struct is_pattern_fillable : public integral_constant<bool, utb::has_trivial_copy<T>::value &&
+            (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)> { };
+
 		struct in_place_type_tag {};
 		struct in_place_index_tag {};
 
@@ -388,28 +421,14 @@ namespace utb {
     void destruct_n(T* src, utb::size_t n) {
 	    internal::destruct_n(src, n, utb::int_to_type<utb::has_trivial_destructor<T>::value>());
 	}
-    template<typename T>
-    inline void fill(T* src, T* last, const T& val) {
-        while (src != last) {
-            *src = val; src = src + 1;
-        }
-	}
-
 	template<typename T>
     inline void fill_n(T* src, utb::size_t n, const T& val) {
-        T* last = src + n;
-        while (src != last) {
-            switch (n & 0x7) {
-                case 0: *src = val; ++src;
-                case 7: *src = val; ++src;
-                case 6: *src = val; ++src;
-                case 5: *src = val; ++src;
-                case 4: *src = val; ++src;
-                case 3: *src = val; ++src;
-                case 2: *src = val; ++src;
-                case 1: *src = val; ++src;
-            }
-        }
+        internal::fill_n(src, n, val, utb::int_to_type<internal::is_pattern_fillable<T>::value>());
+	}
+
+    template<typename T>
+    inline void fill(T* src, T* last, const T& val) {
+        utb::fill_n(src, utb::size_t(last - src), val);
 	}
 
 
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_ARENA_H__
+#define __UT_ARENA_H__
+
+#include "utconfig.h"
+#include "utalignment.h"
+
+namespace utb {
+
+    /**
+     * @brief Monotonic (bump) allocator over a user-provided memory region.
+     *
+     * An allocation aligns the top and moves it up, nothing is freed one by one. mark() and
+     * rewind() give everything back that was allocated after the mark in O(1), reset() gives
+     * back everything. Destructors are not run, use it for trivially destructible data or
+     * destroy objects yourself before the rewind.
+     * @code
+     * static utb::static_arena<4096> scratch;
+     *
+     * void frame() {
+     *     utb::arena_scope _frame(scratch);   // rewinds at the end of the frame
+     *     uint8_t* line = scratch.allocate_array<uint8_t>(256);
+     *     ...
+     * }
+     * @endcode
+     *
+     * An allocation that does not fit returns nullptr and is counted, see overflow_count().
+     */
+    class basic_arena {
+    public:
+        using size_type = utb::size_t;
+        using self_type = basic_arena;
+
+        /// A position in the arena, see mark() and rewind().
+        struct marker {
+            size_type offset;
+        };
+
+        basic_arena(void* region, size_type bytes) noexcept
+            : m_pBegin(static_cast<unsigned char*>(region)), m_sCapacity(bytes),
+              m_sTop(0), m_sHighWatermark(0), m_sOverflows(0) { }
+
+        basic_arena(const self_type&) = delete;
+        self_type& operator=(const self_type&) = delete;
+
+        /**
+         * @brief Get n bytes aligned to alignment (a power of two).
+         * @return The memory, nullptr when the arena has no room left.
+         */
+        void* allocate(size_type n, size_type alignment = default_alignment) noexcept {
+            const uintptr_t _base = reinterpret_cast<uintptr_t>(m_pBegin);
+            const size_type _offset = size_type(align_up<uintptr_t>(_base + m_sTop, alignment) - _base);
+
+            if (_offset > m_sCapacity || n > m_sCapacity - _offset) {
+                ++m_sOverflows;
+                return nullptr;
+            }
+            m_sTop = _offset + n;
+            if (m_sTop > m_sHighWatermark) m_sHighWatermark = m_sTop;
+            return m_pBegin + _offset;
+        }
+
+        /**
+         * @brief Get uninitialized, correctly aligned memory for n objects of type T.
+         */
+        template <typename T>
+        T* allocate_array(size_type n) noexcept {
+            if (n > m_sCapacity / sizeof(T)) { ++m_sOverflows; return nullptr; }
+            return static_cast<T*>(allocate(n * sizeof(T), alignment_of<T>::res));
+        }
+
+        /**
+         * @brief Construct a T in the arena.
+         * @return The object, nullptr when the arena has no room left.
+         */
+        template <typename T, typename... TArgs>
+        T* create(TArgs&&... args) {
+            void* _p = allocate(sizeof(T), alignment_of<T>::res);
+            return _p ? new (_p) T(utb::forward<TArgs>(args)...) : nullptr;
+        }
+
+        /// The current top, pass it to rewind() later.
+        marker mark() const noexcept                            { return marker{ m_sTop }; }
+
+        /**
+         * @brief Free everything allocated after m.
+         */
+        void rewind(marker m) noexcept {
+            assert(m.offset <= m_sTop);
+            m_sTop = m.offset;
+        }
+
+        /// Free everything.
+        void reset() noexcept                                   { m_sTop = 0; }
+
+        /// True when p lies in the used part of the arena.
+        bool owns(const void* p) const noexcept {
+            const unsigned char* _p = static_cast<const unsigned char*>(p);
+            return _p >= m_pBegin && _p < m_pBegin + m_sTop;
+        }
+
+        /// The bytes in use, including alignment padding.
+        size_type used() const noexcept                         { return m_sTop; }
+        size_type available() const noexcept                    { return m_sCapacity - m_sTop; }
+        size_type capacity() const noexcept                     { return m_sCapacity; }
+        /// The most bytes that were in use at the same time.
+        size_type high_watermark() const noexcept               { return m_sHighWatermark; }
+        /// The number of allocations that did not fit.
+        size_type overflow_count() const noexcept               { return m_sOverflows; }
+        bool overflowed() const noexcept                        { return m_sOverflows != 0; }
+        void reset_statistics() noexcept                        { m_sHighWatermark = m_sTop; m_sOverflows = 0; }
+
+    private:
+        unsigned char* m_pBegin;
+        size_type m_sCapacity;
+        size_type m_sTop;
+        size_type m_sHighWatermark;
+        size_type m_sOverflows;
+    };
+
+    /**
+     * @brief An arena with its own storage of TBytes, aligned to TAlignment.
+     */
+    template <utb::size_t TBytes, utb::size_t TAlignment = 8>
+    class static_arena : public basic_arena {
+        static_assert(is_aligvalid(TAlignment), "The alignment must be a power of two.");
+    public:
+        static_arena() noexcept : basic_arena(m_storage.bytes, TBytes) { }
+
+    private:
+        union storage_type {
+            detail::type_with_alignment<TAlignment> align;
+            unsigned char bytes[TBytes];
+        } m_storage;
+    };
+
+    /**
+     * @brief Rewinds an arena to the position at construction when it goes out of scope.
+     */
+    class arena_scope {
+    public:
+        explicit arena_scope(basic_arena& arena) noexcept
+            : m_arena(arena), m_marker(arena.mark()) { }
+
+        ~arena_scope()                                          { m_arena.rewind(m_marker); }
+
+        arena_scope(const arena_scope&) = delete;
+        arena_scope& operator=(const arena_scope&) = delete;
+
+    private:
+        basic_arena& m_arena;
+        basic_arena::marker m_marker;
+    };
+
+    /**
+     * @brief Vector with a capacity fixed at construction, its elements live in an arena.
+     *
+     * The storage is one arena allocation, so it costs a pointer bump and is given back with the
+     * arena's rewind()/reset(). The vector must be destroyed before that. When the arena has no
+     * room, the vector has capacity 0 and the arena counts the overflow.
+     *
+     * @tparam T The element type.
+     */
+    template <typename T>
+    class arena_vector {
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = pointer;
+        using const_iterator = const_pointer;
+        using size_type = utb::size_t;
+        using self_type = arena_vector<T>;
+
+        arena_vector(basic_arena& arena, size_type capacity) noexcept
+            : m_pData(arena.allocate_array<T>(capacity)), m_sSize(0),
+              m_sCapacity(m_pData ? capacity : 0) { }
+
+        ~arena_vector()                                         { clear(); }
+
+        arena_vector(const self_type&) = delete;
+        self_type& operator=(const self_type&) = delete;
+
+        /**
+         * @brief Append a copy of v.
+         * @return False when the vector is full.
+         */
+        bool push_back(const_reference v) {
+            if (full()) return false;
+            new (m_pData + m_sSize) T(v);
+            ++m_sSize;
+            return true;
+        }
+
+        /**
+         * @brief Construct an element at the end.
+         * @return The element, nullptr when the vector is full.
+         */
+        template <typename... TArgs>
+        pointer emplace_back(TArgs&&... args) {
+            if (full()) return nullptr;
+            return new (m_pData + m_sSize++) T(utb::forward<TArgs>(args)...);
+        }
+
+        void pop_back() {
+            assert(!empty());
+            m_pData[--m_sSize].~T();
+        }
+
+        void clear() {
+            while (m_sSize) m_pData[--m_sSize].~T();
+        }
+
+        reference operator[](size_type i)                       { return m_pData[i]; }
+        const_reference operator[](size_type i) const           { return m_pData[i]; }
+        reference front()                                       { return m_pData[0]; }
+        reference back()                                        { return m_pData[m_sSize - 1]; }
+
+        iterator begin()                                        { return m_pData; }
+        iterator end()                                          { return m_pData + m_sSize; }
+        const_iterator begin() const                            { return m_pData; }
+        const_iterator end() const                              { return m_pData + m_sSize; }
+        pointer data()                                          { return m_pData; }
+
+        size_type size() const                                  { return m_sSize; }
+        size_type capacity() const                              { return m_sCapacity; }
+        bool empty() const                                      { return m_sSize == 0; }
+        bool full() const                                       { return m_sSize == m_sCapacity; }
+
+    private:
+        pointer m_pData;
+        size_type m_sSize;
+        size_type m_sCapacity;
+    };
+}
+
+#endif // __UT_ARENA_H__
@@ -42,7 +42,7 @@ namespace utb {
                 return m_bFlag.load(order);
             }
         private:
-            _atomic<flag_type> m_bFlag;
+            base_atomic<flag_type> m_bFlag;
         };
 
         using atomic_flag = basic_atomic_flag<bool>;
@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_BENCHMARK_H__
+#define __UT_BENCHMARK_H__
+
+#include "utconfig.h"
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define UTB_BENCH_COUNTER_RDTSC 1
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+    #define UTB_BENCH_COUNTER_DWT 1
+#elif defined(__XTENSA__)
+    #define UTB_BENCH_COUNTER_CCOUNT 1
+#elif defined(ARDUINO)
+    #include <Arduino.h>
+    #define UTB_BENCH_COUNTER_MICROS 1
+#else
+    #include <chrono>
+    #define UTB_BENCH_COUNTER_CHRONO 1
+#endif
+
+namespace utb {
+    namespace bench {
+
+        /**
+         * @brief The best free-running counter of the target.
+         *
+         *  - x86: rdtsc, in TSC cycles
+         *  - Cortex-M3/M4/M7/M33: DWT CYCCNT, in core cycles
+         *  - ESP32 (Xtensa): the ccount special register, in core cycles
+         *  - other Arduino targets (AVR): micros()
+         *  - everything else: std::chrono::steady_clock in nanoseconds
+         */
+        struct cycle_counter {
+        #if UTB_BENCH_COUNTER_RDTSC
+            using value_type = uint64_t;
+            static constexpr const char* name()     { return "rdtsc"; }
+            static constexpr const char* unit()     { return "cycles"; }
+            static void init()                      { }
+            static value_type now()                 { return __rdtsc(); }
+        #elif UTB_BENCH_COUNTER_DWT
+            using value_type = uint32_t;
+            static constexpr const char* name()     { return "dwt"; }
+            static constexpr const char* unit()     { return "cycles"; }
+            static void init() {
+                *reinterpret_cast<volatile uint32_t*>(0xE000EDFCu) |= (1u << 24);   // DEMCR.TRCENA
+                *reinterpret_cast<volatile uint32_t*>(0xE0001FB0u) = 0xC5ACCE55u;   // DWT.LAR, needed on M7
+                *reinterpret_cast<volatile uint32_t*>(0xE0001004u) = 0;             // DWT.CYCCNT
+                *reinterpret_cast<volatile uint32_t*>(0xE0001000u) |= 1u;           // DWT.CTRL.CYCCNTENA
+            }
+            static value_type now()                 { return *reinterpret_cast<volatile uint32_t*>(0xE0001004u); }
+        #elif UTB_BENCH_COUNTER_CCOUNT
+            using value_type = uint32_t;
+            static constexpr const char* name()     { return "ccount"; }
+            static constexpr const char* unit()     { return "cycles"; }
+            static void init()                      { }
+            static value_type now() {
+                uint32_t _c;
+                __asm__ __volatile__("rsr %0, ccount" : "=a"(_c));
+                return _c;
+            }
+        #elif UTB_BENCH_COUNTER_MICROS
+            using value_type = uint32_t;
+            static constexpr const char* name()     { return "micros"; }
+            static constexpr const char* unit()     { return "us"; }
+            static void init()                      { }
+            static value_type now()                 { return micros(); }
+        #else
+            using value_type = uint64_t;
+            static constexpr const char* name()     { return "chrono"; }
+            static constexpr const char* unit()     { return "ns"; }
+            static void init()                      { }
+            static value_type now() {
+                return value_type(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count());
+            }
+        #endif
+        };
+
+        /**
+         * @brief Keep the compiler from dropping a computed value.
+         */
+        template <typename T>
+        inline void do_not_optimize(T& value) {
+            __asm__ __volatile__("" : : "r"(&value) : "memory");
+        }
+
+        /**
+         * @brief Keep the compiler from reordering memory accesses over this point.
+         */
+        inline void clobber_memory() {
+            __asm__ __volatile__("" : : : "memory");
+        }
+
+        /// The result of one benchmark, the counts are per operation.
+        struct result {
+            const char* name;
+            uint32_t iterations;
+            uint8_t samples;
+            double min;
+            double mean;
+            /** @brief The stored baseline for this benchmark, 0 when there is none */
+            double baseline;
+            bool regression;
+        };
+
+        /// One stored baseline value, see basic_runner::compare().
+        struct baseline_entry {
+            const char* name;
+            double min;
+            /** @brief mean - min of the stored run, 0 when it is unknown */
+            double spread;
+        };
+
+        namespace internal {
+            /// Write an unsigned integer without printf, which is stripped down on most MCU libcs.
+            template <class TWriter>
+            void write_uint(TWriter& out, uint64_t v) {
+                char _buf[21];
+                char* _p = _buf + sizeof(_buf) - 1;
+                *_p = '\0';
+                do { *--_p = char('0' + v % 10); v /= 10; } while (v);
+                out(_p);
+            }
+
+            /// Write v with two decimals.
+            template <class TWriter>
+            void write_fixed(TWriter& out, double v) {
+                if (v < 0) { out("-"); v = -v; }
+                const uint64_t _hundreds = uint64_t(v * 100 + 0.5);
+                write_uint(out, _hundreds / 100);
+                out(_hundreds % 100 < 10 ? ".0" : ".");
+                write_uint(out, _hundreds % 100);
+            }
+        }
+
+        /**
+         * @brief Runs benchmarks, keeps up to TMaxResults results and writes them as JSON.
+         *
+         * Every benchmark runs its body iterations times per sample, the minimum over the samples
+         * is the robust value to compare, the mean shows the spread. The overhead of reading the
+         * counter is measured once and subtracted. Running a benchmark again under the same name
+         * adds its samples to the stored result, so a suite that runs N times keeps the min-of-N.
+         *
+         * The output goes to a writer, any callable that takes a const char*, so the same code
+         * prints to std::cout on the host or to Serial on a target:
+         * @code
+         * auto out = [](const char* s) { Serial.print(s); };
+         * runner.write_json(out);
+         * @endcode
+         *
+         * @tparam TMaxResults The maximal number of benchmarks.
+         * @tparam TCounter The counter, see cycle_counter.
+         */
+        template <utb::size_t TMaxResults, class TCounter = cycle_counter>
+        class basic_runner {
+        public:
+            using counter_type = TCounter;
+            using value_type = typename TCounter::value_type;
+            using size_type = utb::size_t;
+            using self_type = basic_runner<TMaxResults, TCounter>;
+
+            basic_runner() : m_sUsed(0), m_vOverhead(0) {
+                counter_type::init();
+
+                value_type _best = value_type(~value_type(0));
+                for (int i = 0; i < 16; ++i) {
+                    const value_type _start = counter_type::now();
+                    clobber_memory();
+                    const value_type _elapsed = value_type(counter_type::now() - _start);
+                    if (_elapsed < _best) _best = _elapsed;
+                }
+                m_vOverhead = _best;
+            }
+
+            /**
+             * @brief Time fn, called iterations times per sample.
+             * @param name The name of the benchmark, must outlive the runner.
+             * @param fn The body, called as fn().
+             * @return The result, nullptr when the runner is full.
+             * @note When a result with this name exists, the new samples are merged into it.
+             */
+            template <class TFn>
+            const result* run(const char* name, uint32_t iterations, TFn fn, uint8_t samples = 7) {
+                result* _existing = find(name);
+                if (iterations == 0 || samples == 0) return nullptr;
+                if (_existing == nullptr && m_sUsed == TMaxResults) return nullptr;
+
+                fn();   // warm up caches and branch predictors
+
+                double _min = 0, _sum = 0;
+                for (uint8_t s = 0; s < samples; ++s) {
+                    const value_type _start = counter_type::now();
+                    for (uint32_t i = 0; i < iterations; ++i) { fn(); clobber_memory(); }
+                    value_type _elapsed = value_type(counter_type::now() - _start);
+
+                    _elapsed = _elapsed > m_vOverhead ? value_type(_elapsed - m_vOverhead) : value_type(0);
+                    const double _per_op = double(_elapsed) / iterations;
+
+                    if (s == 0 || _per_op < _min) _min = _per_op;
+                    _sum += _per_op;
+                }
+
+                if (_existing != nullptr) {
+                    result& _r = *_existing;
+                    const unsigned _samples = unsigned(_r.samples) + samples;
+
+                    _r.mean = (_r.mean * _r.samples + _sum) / _samples;
+                    _r.samples = _samples > 255 ? uint8_t(255) : uint8_t(_samples);
+                    if (_min < _r.min) _r.min = _min;
+                    return &_r;
+                }
+
+                result& _r = m_ayResults[m_sUsed++];
+                _r.name = name;
+                _r.iterations = iterations;
+                _r.samples = samples;
+                _r.min = _min;
+                _r.mean = _sum / samples;
+                _r.baseline = 0;
+                _r.regression = false;
+                return &_r;
+            }
+
+            /**
+             * @brief Compare the results with a stored baseline and flag regressions.
+             *
+             * A single minimum still moves with the machine state, so the limit also allows the
+             * larger of the recorded spreads (mean - min of the baseline and of this run) on top of
+             * the tolerance. A benchmark that was noisy when either side was measured needs a
+             * larger step before it is reported.
+             *
+             * @param pBaseline The baseline values, matched by name.
+             * @param tolerancePercent A result is a regression when its minimum is more than this
+             * percentage plus the spread above the baseline.
+             * @param out Gets one line per regression.
+             * @return The number of regressions.
+             */
+            template <class TWriter>
+            size_type compare(const baseline_entry* pBaseline, size_type n, uint8_t tolerancePercent, TWriter& out) {
+                size_type _regressions = 0;
+
+                for (size_type i = 0; i < m_sUsed; ++i) {
+                    result& _r = m_ayResults[i];
+
+                    for (size_type k = 0; k < n; ++k) {
+                        if (strcmp(pBaseline[k].name, _r.name) != 0) continue;
+
+                        double _spread = _r.mean - _r.min;
+                        if (pBaseline[k].spread > _spread) _spread = pBaseline[k].spread;
+
+                        _r.baseline = pBaseline[k].min;
+                        _r.regression = _r.min > _r.baseline * (100 + tolerancePercent) / 100 + _spread;
+                        if (_r.regression) {
+                            ++_regressions;
+                            out("regression: "); out(_r.name); out(" ");
+                            internal::write_fixed(out, _r.baseline); out(" -> ");
+                            internal::write_fixed(out, _r.min); out(" "); out(counter_type::unit()); out("\n");
+                        }
+                        break;
+                    }
+                }
+                return _regressions;
+            }
+
+            /**
+             * @brief Write all results as JSON, one result per line.
+             */
+            template <class TWriter>
+            void write_json(TWriter& out) const {
+                out("{\n  \"counter\": \""); out(counter_type::name());
+                out("\",\n  \"unit\": \""); out(counter_type::unit());
+                out("\",\n  \"results\": [\n");
+
+                for (size_type i = 0; i < m_sUsed; ++i) {
+                    const result& _r = m_ayResults[i];
+
+                    out("    { \"name\": \""); out(_r.name);
+                    out("\", \"iterations\": "); internal::write_uint(out, _r.iterations);
+                    out(", \"samples\": "); internal::write_uint(out, _r.samples);
+                    out(", \"min\": "); internal::write_fixed(out, _r.min);
+                    out(", \"mean\": "); internal::write_fixed(out, _r.mean);
+                    if (_r.baseline > 0) {
+                        out(", \"baseline\": "); internal::write_fixed(out, _r.baseline);
+                        out(", \"regression\": "); out(_r.regression ? "true" : "false");
+                    }
+                    out(i + 1 < m_sUsed ? " },\n" : " }\n");
+                }
+                out("  ]\n}\n");
+            }
+
+            const result& operator[](size_type i) const         { return m_ayResults[i]; }
+            constexpr size_type size() const                    { return m_sUsed; }
+            constexpr size_type capacity() const                { return TMaxResults; }
+
+        private:
+            result* find(const char* name) {
+                for (size_type i = 0; i < m_sUsed; ++i)
+                    if (strcmp(m_ayResults[i].name, name) == 0) return &m_ayResults[i];
+                return nullptr;
+            }
+
+            result m_ayResults[TMaxResults];
+            size_type m_sUsed;
+            value_type m_vOverhead;
+        };
+
+        template <utb::size_t TMaxResults>
+        using runner = basic_runner<TMaxResults>;
+    }
+}
+
+#endif
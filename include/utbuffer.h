@@ -22,7 +22,6 @@ namespace utb {
 
 	template<typename TYPE>
 	class buffer_iterator {
-		static_assert(TSIZE > 0, "Size must be greater than zero.");	
 	public:
 		using self_type = buffer_iterator<TYPE>;
 		using value_type = TYPE;
@@ -36,31 +35,29 @@ namespace utb {
 		using iterator = pointer;
 		using const_iterator = const value_type*;
 
-		explicit buffer_iterator(pointer& pBuffer, size_type sSize , size_type iStartPosition = 0) 
-			: m_iCurrentPosition(iStartPosition), m_pBuffer(pBuffer), m_sMaxSize(sSize) { }
+		explicit buffer_iterator(pointer pBuffer, size_type sSize , size_type iStartPosition = 0) 
+			: m_iCurrentPosition(iStartPosition), m_sMaxSize(sSize), m_pBuffer(pBuffer) { }
 
 		~buffer_iterator() = default;
 
 		constexpr bool	operator== (const self_type& iter) const {
-			for(utb::size_t i = m_iCurrentPosition; i < m_sMaxSize; ++i) {
-				if (m_pBuffer[i] != iter.m_pBuffer[i]) {
-					return false;
-				}
-			}
-			return m_iCurrentPosition == iter.m_iCurrentPosition && m_sMaxSize == iter.m_sMaxSize;
+			return m_pBuffer == iter.m_pBuffer && m_iCurrentPosition == iter.m_iCurrentPosition;
+		}
+		constexpr bool	operator!= (const self_type& iter) const {
+			return !(*this == iter);
 		}
 
 		constexpr bool	operator< (const self_type& iter) const
-			{ return m_itr < iter.m_itr; }
+			{ return m_iCurrentPosition < iter.m_iCurrentPosition; }
 
-		constexpr reference_type	operator* () const { return (*m_pBuffer[m_iCurrentPosition]); }
-		constexpr pointer			operator-> () const { return &*m_pBuffer[m_iCurrentPosition]; }
+		constexpr reference	operator* () const { return m_pBuffer[m_iCurrentPosition]; }
+		constexpr pointer	operator-> () const { return &m_pBuffer[m_iCurrentPosition]; }
 
 		constexpr self_type&	operator++ () { if(m_iCurrentPosition < m_sMaxSize) ++m_iCurrentPosition;  return *this; }
 		constexpr self_type&	operator-- () { if(m_iCurrentPosition > 0) --m_iCurrentPosition; return *this; }
 
-		constexpr self_type		operator++ (int) { if(m_iCurrentPosition < m_sMaxSize) ++m_iCurrentPosition;  return *this; }
-		constexpr self_type		operator-- (int) { if(m_iCurrentPosition > 0) --m_iCurrentPosition; return *this; }
+		constexpr self_type		operator++ (int) { self_type _tmp = *this; ++(*this); return _tmp; }
+		constexpr self_type		operator-- (int) { self_type _tmp = *this; --(*this); return _tmp; }
 
 		constexpr self_type&	operator+= (utb::size_t n) { 
 			m_iCurrentPosition += n; 
@@ -90,28 +87,99 @@ namespace utb {
 
 		constexpr self_type		operator- (utb::size_t n) const {
 			self_type iter = *this;
-			iter.m_iCurrentPosition += n;
-			if (iter.m_iCurrentPosition > m_sMaxSize) {
-				iter.m_iCurrentPosition = m_sMaxSize;
-			}
+			iter -= n;
 			return iter;
 		}
 
-		constexpr reference_type 	operator[] (utb::size_t n) const { assert(n < m_sMaxSize); return m_pBuffer[n]; }
-		constexpr difference_type	operator- (const self_type& i) const { return m_iCurrentPosition - i.m_iCurrentPosition; }
+		constexpr reference 		operator[] (utb::size_t n) const { assert(n < m_sMaxSize); return m_pBuffer[n]; }
+		constexpr difference_type	operator- (const self_type& i) const {
+			return difference_type(m_iCurrentPosition) - difference_type(i.m_iCurrentPosition); }
 
 	private:
 		size_type   m_iCurrentPosition;
 		size_type   m_sMaxSize;
-		pointer& 	m_pBuffer;
+		pointer 	m_pBuffer;
 	};
+
+	namespace internal {
+		/// Reduce a position in [0, 2 * TSIZE) to a slot, a mask when TSIZE is a power of two.
+		/// Neither form divides, which matters on MCUs without a hardware divider.
+		template <utb::size_t TSIZE>
+		constexpr utb::size_t ring_wrap(utb::size_t position) noexcept {
+			return ((TSIZE & (TSIZE - 1)) == 0) ? (position & (TSIZE - 1))
+				: (position >= TSIZE ? position - TSIZE : position);
+		}
+	}
+
+	/**
+	 * @brief Wrap-aware iterator over a circular buffer.
+	 *
+	 * The position is the logical index from the head, the physical slot is
+	 * (head + position) modulo the capacity. Head and position are both at most the
+	 * capacity, so the slot is found like the buffer's own, without a division.
+	 */
+	template<typename TYPE, utb::size_t TSIZE>
+	class ring_buffer_iterator {
+	public:
+		using self_type = ring_buffer_iterator<TYPE, TSIZE>;
+		using value_type = TYPE;
+		using pointer = value_type*;
+		using reference = value_type&;
+		using size_type = utb::size_t;
+		using iterator_category = random_access_iterator_tag ;
+		using difference_type = ptrdiff_t;
+
+		ring_buffer_iterator(pointer pBuffer, size_type sHead, size_type iPosition)
+			: m_pBuffer(pBuffer), m_sHead(sHead), m_iPosition(iPosition) { }
+
+		constexpr bool	operator== (const self_type& iter) const { return m_iPosition == iter.m_iPosition; }
+		constexpr bool	operator!= (const self_type& iter) const { return m_iPosition != iter.m_iPosition; }
+		constexpr bool	operator< (const self_type& iter) const  { return m_iPosition < iter.m_iPosition; }
+
+		reference	operator* () const 	{ return m_pBuffer[slot(m_iPosition)]; }
+		pointer		operator-> () const { return &m_pBuffer[slot(m_iPosition)]; }
+		reference 	operator[] (size_type n) const { return m_pBuffer[slot(m_iPosition + n)]; }
+
+		self_type&	operator++ () { ++m_iPosition; return *this; }
+		self_type&	operator-- () { --m_iPosition; return *this; }
+		self_type	operator++ (int) { self_type _tmp = *this; ++m_iPosition; return _tmp; }
+		self_type	operator-- (int) { self_type _tmp = *this; --m_iPosition; return _tmp; }
+
+		self_type&	operator+= (size_type n) { m_iPosition += n; return *this; }
+		self_type&	operator-= (size_type n) { m_iPosition -= n; return *this; }
+		self_type	operator+ (size_type n) const { self_type _tmp = *this; return _tmp += n; }
+		self_type	operator- (size_type n) const { self_type _tmp = *this; return _tmp -= n; }
+
+		difference_type	operator- (const self_type& i) const {
+			return difference_type(m_iPosition) - difference_type(i.m_iPosition); }
+
+	private:
+		constexpr size_type slot(size_type position) const {
+			return internal::ring_wrap<TSIZE>(m_sHead + position);
+		}
+	private:
+		pointer		m_pBuffer;
+		size_type	m_sHead;
+		size_type	m_iPosition;
+	};
+
+	/**
+	 * @brief A view over a global, statically allocated raw buffer.
+	 *
+	 * @tparam TYPE The element type.
+	 * @tparam TRAWBUFFER The static storage of the buffer.
+	 * @tparam TSIZE The number of elements in TRAWBUFFER.
+	 * @tparam TRING When true the buffer is a circular head/tail queue (@see ring_buffer),
+	 *  when false read() shifts the remaining elements to the front.
+	 */
+	template<typename TYPE, TYPE* TRAWBUFFER, utb::size_t TSIZE, bool TRING = false>
+	class buffer;
+
 	template<typename TYPE, TYPE* TRAWBUFFER, utb::size_t TSIZE>
-	class buffer {
+	class buffer<TYPE, TRAWBUFFER, TSIZE, false> {
 		static_assert(TSIZE > 0, "Size must be greater than zero.");
-		static_assert(TSIZE <= utb::size_t(sizeof(TYPE*) / sizeof(TYPE)), "Buffer view out of bounds.");
-		static_assert(utb::is_pointer<TYPE*>::value, "TYPE must be a pointer type.");
 	public:
-		using self_type = buffer<TYPE, TRAWBUFFER, TSIZE>;
+		using self_type = buffer<TYPE, TRAWBUFFER, TSIZE, false>;
 		using value_type = TYPE;
 		using pointer = value_type*;
 		using reference = value_type&;
@@ -123,8 +191,8 @@ namespace utb {
 
 		using iterator_category = random_access_iterator_tag ;
 		using difference_type = ptrdiff_t;
-		using iterator = buffer_iterator<TYPE, TSIZE>;
-		using const_iterator = const buffer_iterator<TYPE, TSIZE>;
+		using iterator = buffer_iterator<TYPE>;
+		using const_iterator = const buffer_iterator<TYPE>;
 
 		buffer() : m_sUsed(0) { }
 		buffer(const self_type& other) = delete;
@@ -152,13 +220,13 @@ namespace utb {
 		 * @brief Get the iterator to end of the buffer.
 		 * @return The iterator to end of the buffer.
 		 */
-		iterator end() 				{ return iterator(&TRAWBUFFER[m_sUsed], m_sUsed, m_sUsed); }
+		iterator end() 				{ return iterator(TRAWBUFFER, m_sUsed, m_sUsed); }
 
 		/**
 		 * @brief Get the iterator to end of the buffer.
 		 * @return The iterator to end of the buffer.
 		 */
-		const_iterator end() const 	{ return const_iterator(&TRAWBUFFER[m_sUsed], m_sUsed, m_sUsed); }
+		const_iterator end() const 	{ return const_iterator(TRAWBUFFER, m_sUsed, m_sUsed); }
 
 
 		utb::size_t write(const_reference value) {
@@ -172,6 +240,7 @@ namespace utb {
 
 			value_type value = TRAWBUFFER[0];
 			utb::move(TRAWBUFFER + 1, TRAWBUFFER + m_sUsed, TRAWBUFFER);
+			--m_sUsed;
 			return value;
 		}
 
@@ -210,7 +279,10 @@ namespace utb {
 			if (m_sUsed != other.m_sUsed) {
 				return false;
 			}
-			return utb::equal(begin(), end(), other.begin());
+			for (size_type i = 0; i < m_sUsed; ++i) {
+				if (!(TRAWBUFFER[i] == other[i])) return false;
+			}
+			return true;
 		}
 
 		constexpr reference at(size_type index) const {
@@ -313,6 +385,220 @@ namespace utb {
 	private:
 		size_type    m_sUsed;
 	};
+	/**
+	 * @brief Circular head/tail mode of buffer.
+	 *
+	 * read() and write() are O(1): only the head index and the used count change.
+	 * The bulk variants copy at most two contiguous blocks, one up to the physical
+	 * end of TRAWBUFFER and one from its start.
+	 */
+	template<typename TYPE, TYPE* TRAWBUFFER, utb::size_t TSIZE>
+	class buffer<TYPE, TRAWBUFFER, TSIZE, true> {
+		static_assert(TSIZE > 0, "Size must be greater than zero.");
+	public:
+		using self_type = buffer<TYPE, TRAWBUFFER, TSIZE, true>;
+		using value_type = TYPE;
+		using pointer = value_type*;
+		using reference = value_type&;
+		using size_type = utb::size_t;
+
+		using const_reference = const value_type&;
+		using const_pointer = const value_type*;
+
+		using iterator_category = random_access_iterator_tag ;
+		using difference_type = ptrdiff_t;
+		using iterator = ring_buffer_iterator<TYPE, TSIZE>;
+		using const_iterator = ring_buffer_iterator<const TYPE, TSIZE>;
+
+		buffer() : m_sHead(0), m_sUsed(0) { }
+		buffer(const self_type& other) = delete;
+		buffer(self_type&& other) noexcept = delete;
+		~buffer() = default;
+
+		self_type& operator=(const self_type&) = delete;
+		self_type& operator=(self_type&&) = delete;
+
+		/**
+		 * @brief Get the iterator to the oldest element.
+		 */
+		iterator begin() 				{ return iterator(TRAWBUFFER, m_sHead, 0); }
+		const_iterator begin() const 	{ return const_iterator(TRAWBUFFER, m_sHead, 0); }
+
+		/**
+		 * @brief Get the iterator past the newest element.
+		 */
+		iterator end() 					{ return iterator(TRAWBUFFER, m_sHead, m_sUsed); }
+		const_iterator end() const 		{ return const_iterator(TRAWBUFFER, m_sHead, m_sUsed); }
+
+		/**
+		 * @brief Append a single element at the tail.
+		 * @return 1 when the element was written, 0 when the buffer is full.
+		 */
+		utb::size_t write(const_reference value) {
+			if (m_sUsed >= TSIZE) return 0;
+
+			TRAWBUFFER[wrap(m_sHead + m_sUsed)] = value;
+			++m_sUsed;
+			return 1;
+		}
+
+		/**
+		 * @brief Append up to n elements at the tail.
+		 * @return The number of written elements, less than n when the buffer runs full.
+		 */
+		utb::size_t write(const_pointer pSource, size_type n) {
+			n = utb::min<size_type>(n, TSIZE - m_sUsed);
+			if (n == 0) return 0;
+
+			const size_type _tail = wrap(m_sHead + m_sUsed);
+			const size_type _first = utb::min<size_type>(n, TSIZE - _tail);
+
+			utb::copy_n(pSource, _first, TRAWBUFFER + _tail);
+			if (n > _first) utb::copy_n(pSource + _first, n - _first, TRAWBUFFER);
+
+			m_sUsed += n;
+			return n;
+		}
+
+		/**
+		 * @brief Remove and return the oldest element.
+		 */
+		value_type read() {
+			assert (m_sUsed > 0);
+
+			value_type value = TRAWBUFFER[m_sHead];
+			m_sHead = wrap(m_sHead + 1);
+			--m_sUsed;
+			return value;
+		}
+
+		/**
+		 * @brief Remove up to n of the oldest elements and copy them to pDest.
+		 * @return The number of read elements.
+		 */
+		utb::size_t read(pointer pDest, size_type n) {
+			n = utb::min<size_type>(n, m_sUsed);
+			if (n == 0) return 0;
+
+			const size_type _first = utb::min<size_type>(n, TSIZE - m_sHead);
+
+			utb::copy_n(TRAWBUFFER + m_sHead, _first, pDest);
+			if (n > _first) utb::copy_n(TRAWBUFFER, n - _first, pDest + _first);
+
+			m_sHead = wrap(m_sHead + n);
+			m_sUsed -= n;
+			return n;
+		}
+
+		/**
+		 * @brief Drop up to n of the oldest elements without copying them.
+		 * @return The number of dropped elements.
+		 */
+		utb::size_t skip(size_type n) {
+			n = utb::min<size_type>(n, m_sUsed);
+			m_sHead = wrap(m_sHead + n);
+			m_sUsed -= n;
+			return n;
+		}
+
+		utb::size_t assign(const_pointer pBuffer, size_type size) {
+			if ( size > TSIZE - m_sUsed) return 0;
+
+			return write(pBuffer, size);
+		}
+
+		void emplace_back(const_reference value) {
+			assert (m_sUsed < TSIZE);
+			TRAWBUFFER[wrap(m_sHead + m_sUsed)] = value;
+			++m_sUsed;
+		}
+
+		/**
+		 * @brief Clear the used content.
+		 */
+		void clear() {
+			m_sHead = 0;
+			m_sUsed = 0;
+		}
+
+		reference at(size_type index) {
+			assert (index < m_sUsed);
+			return TRAWBUFFER[wrap(m_sHead + index)];
+		}
+
+		const_reference at(size_type index) const {
+			assert (index < m_sUsed);
+			return TRAWBUFFER[wrap(m_sHead + index)];
+		}
+
+		reference front() 				{ return at(0); }
+		const_reference front() const 	{ return at(0); }
+		reference back() 				{ return at(m_sUsed - 1); }
+		const_reference back() const 	{ return at(m_sUsed - 1); }
+
+		/**
+		 * @brief Get the capacity of the buffer in elements.
+		 */
+		constexpr size_type capacity() const noexcept		{ return TSIZE - m_sUsed; }
+
+		/**
+		 * @brief is the buffer  empty?
+		 */
+		constexpr bool is_empty() const noexcept			{ return m_sUsed == 0; }
+
+		/**
+		 * @brief is the buffer  full?
+		 */
+		constexpr bool is_full() const noexcept				{ return m_sUsed == TSIZE; }
+
+		/**
+		 * @brief Get the free memory size in elements.
+		 */
+		constexpr size_type free() const noexcept 		{ return TSIZE - m_sUsed; }
+
+		/**
+		 * @brief Get the free memory size in bytes.
+		 */
+		constexpr size_type free_bytes() const noexcept { return (TSIZE - m_sUsed) * sizeof(value_type); }
+
+		/**
+		 * @brief Get the allocated memory size in elements.
+		 */
+		constexpr size_type size() const noexcept 		{ return TSIZE; }
+
+		/**
+		 * @brief Get the allocated memory size in bytes.
+		 */
+		constexpr size_type bytes() const noexcept { return TSIZE * sizeof(value_type); }
+
+		/**
+		 * @brief Get the used size of the buffer in elements.
+		 */
+		constexpr size_type used() const noexcept		{ return m_sUsed; }
+
+		/**
+		 * @brief Get the used size of the buffer in bytes.
+		 */
+		constexpr size_type used_bytes() const noexcept { return m_sUsed * sizeof(value_type); }
+
+		reference operator [] (size_type index) 			{ return at(index); }
+		const_reference operator [] (size_type index) const { return at(index); }
+
+	private:
+		/// Reduce a position in [0, 2 * TSIZE) to a slot, see internal::ring_wrap().
+		static constexpr size_type wrap(size_type position) noexcept {
+			return internal::ring_wrap<TSIZE>(position);
+		}
+	private:
+		size_type    m_sHead;
+		size_type    m_sUsed;
+	};
+
+	/**
+	 * @brief A circular buffer view over a global, statically allocated raw buffer.
+	 */
+	template<typename TYPE, TYPE* TRAWBUFFER, utb::size_t TSIZE>
+	using ring_buffer = buffer<TYPE, TRAWBUFFER, TSIZE, true>;
 }
 
 #endif
\ No newline at end of file
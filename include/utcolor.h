@@ -11,6 +11,9 @@
 
 #include "utconfig.h"
 #include "utalgorithm.h"
+#include "utcolor_lut.h"
+
+#include <math.h>
 
 #define COLORCON 0.003921568627450980392156862745098
 
@@ -219,14 +222,53 @@ namespace utb {
         inline basic_color<T> max(const basic_color<T>& c1, const basic_color<T>& c2) {
             return basic_color<T>(utb::max<T>(c1.r, c2.r), utb::max<T>(c1.g, c2.g), utb::max<T>(c1.b, c2.b), utb::max<T>(c1.a, c2.a));}
         
+        namespace internal {
+            /// Split the hue in degrees into the sextant and the position in it.
+            template <typename T>
+            inline uint8_t hsv_split(const T h, T& f, utb::int_to_type<false>) {
+                T _h = h / 60;                  // sector 0 to 5
+                if (_h >= 6) _h -= 6;
+                const T _i = floor(_h);
+                f = _h - _i;                    // factorial part of h
+                return uint8_t(_i);
+            }
+
+            /// As above, the hue is quantized to 1536 steps, the fraction comes from hsv_fraction_lut.
+            template <typename T>
+            inline uint8_t hsv_split(const T h, T& f, utb::int_to_type<true>) {
+                uint16_t _index = uint16_t(h * T(1536.0 / 360.0));
+                if (_index >= 1536) _index -= 1536;
+                f = lut_read(&hsv_fraction_lut<T>::instance().fraction[_index & 0xFF]);
+                return uint8_t(_index >> 8);
+            }
+
+            template <typename T>
+            inline basic_color<T> yuv_to_rgb(const T y, const T u, const T v, utb::int_to_type<false>) {
+                return basic_color<T>(T(1.164 * (y - 16) + 1.596*(v - 128)), 
+                                    T(1.164 * (y - 16) - 0.813*(v - 128) - 0.391*(u - 128)), 
+                                    T(1.164 * (y - 16) + 2.018*(u - 128)));
+            }
+
+            /// As above from yuv_lut, only this overload references the 2.5 KB table.
+            template <typename T>
+            inline basic_color<T> yuv_to_rgb(const T y, const T u, const T v, utb::int_to_type<true>) {
+                const yuv_lut& _lut = yuv_lut::instance();
+                const int16_t _y = lut_read(&_lut.y[uint8_t(y)]);
+                const uint8_t _u = uint8_t(u), _v = uint8_t(v);
+
+                return basic_color<T>(T(_y + lut_read(&_lut.rv[_v])),
+                                    T(_y - lut_read(&_lut.gv[_v]) - lut_read(&_lut.gu[_u])),
+                                    T(_y + lut_read(&_lut.bu[_u])));
+            }
+        }
+
         /**
          * @brief Create a RGBA color object from a yuv
+         * @tparam TLut True: take the coefficient products from yuv_lut, y, u and v are truncated to 0 - 255.
          */
-        template <typename T>
+        template <typename T, bool TLut = false>
         basic_color<T> from_yuv(const T y, const T u, const T v) {
-            return basic_color<T>(T(1.164 * (y - 16) + 1.596*(v - 128)), 
-                                T(1.164 * (y - 16) - 0.813*(v - 128) - 0.391*(u - 128)), 
-                                T(1.164 * (y - 16) + 2.018*(u - 128)));
+            return internal::yuv_to_rgb(y, u, v, utb::int_to_type<TLut>());
         }
         
         /**
@@ -239,27 +281,29 @@ namespace utb {
         
         /**
          * @brief Create a RGBA color object from a hsv
+         * @param h The hue in degrees 0 - 360
+         * @param s The saturation 0 - 1
+         * @param v The value 0 - 1
+         * @tparam TLut True: no floor() and division, the hue is resolved with hsv_fraction_lut to 1/1536 turn.
          */
-        template <typename T>
+        template <typename T, bool TLut = false>
         basic_color<T> from_hsv(const T h, const T s, const T v) {
                 if( s == 0 ) return basic_color<T>(v,v,v);
                 
-                T i, f, p, q, t;
-                
-                h /= 60;			// sector 0 to 5
-                i = floor( h );
-                f = h - i;			// factorial part of h
-                p = v * ( 1 - s );
-                q = v * ( 1 - s * f );
-                t = v * ( 1 - s * ( 1 - f ) );
-
-                if(i == 0) return basic_color<T>(v, t, p);
-                if(i == 1) return basic_color<T>(q, v, p);
-                if(i == 2) return basic_color<T>(p, v, t);
-                if(i == 3) return basic_color<T>(p, q, v);
-                if(i == 4) return basic_color<T>(t, p, v);
-
-                return raColor(v, p, q);
+                T f;
+                const uint8_t i = internal::hsv_split(h, f, utb::int_to_type<TLut>());
+                const T p = v * ( 1 - s );
+                const T q = v * ( 1 - s * f );
+                const T t = v * ( 1 - s * ( 1 - f ) );
+
+                switch (i) {
+                    case 0:  return basic_color<T>(v, t, p);
+                    case 1:  return basic_color<T>(q, v, p);
+                    case 2:  return basic_color<T>(p, v, t);
+                    case 3:  return basic_color<T>(p, q, v);
+                    case 4:  return basic_color<T>(t, p, v);
+                    default: return basic_color<T>(v, p, q);
+                }
         }
 
         using color = basic_color<float>;
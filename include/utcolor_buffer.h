@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_COLOR_BUFFER_H__
+#define __UT_COLOR_BUFFER_H__
+
+#include "utconfig.h"
+#include "uttypetraits.h"
+#include "utalgorithm.h"
+#include "utcolor.h"
+
+namespace utb {
+    namespace graphic {
+
+        /**
+         * @brief Fixed-point helpers for uint8_t and uint16_t color channels, a channel value of
+         * max (255 or 65535) stands for 1.0.
+         */
+        template <typename T>
+        struct fixed_channel {
+            static_assert(sizeof(T) == 1 || sizeof(T) == 2, "Channel must be uint8_t or uint16_t.");
+            static_assert(!utb::is_signed<T>::value, "Channel must be unsigned.");
+
+            using value_type = T;
+            using wide_type = typename utb::select<(sizeof(T) == 1), uint16_t, uint32_t>::result;
+
+            static constexpr unsigned bits = sizeof(T) * 8;
+            static constexpr T max = T(~T(0));
+
+            /**
+             * @brief a * b / max, exact for b = 0 and b = max.
+             */
+            static constexpr T scale(T a, T b) {
+                return T((wide_type(a) * (wide_type(b) + 1)) >> bits);
+            }
+
+            /**
+             * @brief Blend from a (frac = 0) to b (frac = max).
+             */
+            static constexpr T lerp(T a, T b, T frac) {
+                return (b > a) ? T(a + scale(T(b - a), frac)) : T(a - scale(T(a - b), frac));
+            }
+
+            /**
+             * @brief Convert a float channel 0.0 - 1.0 to fixed-point, values outside are clamped.
+             */
+            template <typename F>
+            static constexpr T from_float(F f) {
+                return f >= F(1) ? max : (f <= F(0) ? T(0) : T(f * F(max) + F(0.5)));
+            }
+        };
+
+        /// The memory order of the channels in a packed pixel.
+        enum class pixel_order {
+            /** @brief red, green, blue */
+            rgb,
+            /** @brief green, red, blue, the wire order of WS2812 and SK6812 */
+            grb
+        };
+
+        /**
+         * @brief A packed three channel pixel, the members are laid out in TOrder so a frame of
+         * pixels can be sent to the LED driver byte by byte.
+         *
+         * @tparam T The channel type, uint8_t or uint16_t.
+         * @tparam TOrder The memory order of the channels.
+         */
+        template <typename T, pixel_order TOrder>
+        struct basic_pixel;
+
+        template <typename T>
+        struct basic_pixel<T, pixel_order::rgb> {
+            using value_type = T;
+            static constexpr pixel_order order = pixel_order::rgb;
+
+            /** @brief The red value  */
+            value_type r;
+            /** @brief The green value  */
+            value_type g;
+            /** @brief The blue value  */
+            value_type b;
+
+            constexpr basic_pixel() : r(0), g(0), b(0) { }
+            constexpr basic_pixel(value_type _r, value_type _g, value_type _b) : r(_r), g(_g), b(_b) { }
+        };
+
+        template <typename T>
+        struct basic_pixel<T, pixel_order::grb> {
+            using value_type = T;
+            static constexpr pixel_order order = pixel_order::grb;
+
+            /** @brief The green value  */
+            value_type g;
+            /** @brief The red value  */
+            value_type r;
+            /** @brief The blue value  */
+            value_type b;
+
+            constexpr basic_pixel() : g(0), r(0), b(0) { }
+            constexpr basic_pixel(value_type _r, value_type _g, value_type _b) : g(_g), r(_r), b(_b) { }
+        };
+
+        template <typename T, pixel_order TOrder>
+        inline bool operator == (const basic_pixel<T, TOrder>& a, const basic_pixel<T, TOrder>& b) {
+            return a.r == b.r && a.g == b.g && a.b == b.b; }
+
+        template <typename T, pixel_order TOrder>
+        inline bool operator != (const basic_pixel<T, TOrder>& a, const basic_pixel<T, TOrder>& b) {
+            return !(a == b); }
+
+        using rgb888 = basic_pixel<uint8_t, pixel_order::rgb>;
+        using grb888 = basic_pixel<uint8_t, pixel_order::grb>;
+        using rgb161616 = basic_pixel<uint16_t, pixel_order::rgb>;
+
+        namespace internal {
+            /// Split the hue into the sextant (return) and the position in it.
+            template <typename T>
+            inline uint8_t hsv_split_fixed(const T h, T& f, utb::int_to_type<false>) {
+                using channel = fixed_channel<T>;
+
+                // h * 6: the high part is the sextant, the low part the position in it
+                const typename channel::wide_type _h6 = typename channel::wide_type(h) * 6;
+                f = T(_h6 & channel::max);
+                return uint8_t(_h6 >> channel::bits);
+            }
+
+            /// As above from hsv_sextant_lut, only for 8 bit hue.
+            inline uint8_t hsv_split_fixed(const uint8_t h, uint8_t& f, utb::int_to_type<true>) {
+                const hsv_sextant_lut& _lut = hsv_sextant_lut::instance();
+                f = lut_read(&_lut.fraction[h]);
+                return lut_read(&_lut.sector[h]);
+            }
+        }
+
+        /**
+         * @brief Create a pixel from a fixed-point hsv, without float math.
+         *
+         * @tparam TPixel The pixel type, e.g. grb888.
+         * @tparam TLut True: split the hue with hsv_sextant_lut (8 bit channels only, ignored otherwise).
+         * @param h The hue, the full channel range is one turn (0 - 255 or 0 - 65535 = 0° - 360°).
+         * @param s The saturation, max = full saturation.
+         * @param v The value, max = full brightness.
+         */
+        template <class TPixel, bool TLut = false>
+        TPixel from_hsv_fixed(const typename TPixel::value_type h, const typename TPixel::value_type s,
+                              const typename TPixel::value_type v) {
+            using channel = fixed_channel<typename TPixel::value_type>;
+            using T = typename TPixel::value_type;
+
+            if (s == 0) return TPixel(v, v, v);
+
+            T _f;
+            const uint8_t _sector = internal::hsv_split_fixed(h, _f, utb::int_to_type<TLut && sizeof(T) == 1>());
+
+            const T _p = channel::scale(v, T(channel::max - s));
+            const T _q = channel::scale(v, T(channel::max - channel::scale(s, _f)));
+            const T _t = channel::scale(v, T(channel::max - channel::scale(s, T(channel::max - _f))));
+
+            switch (_sector) {
+                case 0:  return TPixel(v, _t, _p);
+                case 1:  return TPixel(_q, v, _p);
+                case 2:  return TPixel(_p, v, _t);
+                case 3:  return TPixel(_p, _q, v);
+                case 4:  return TPixel(_t, _p, v);
+                default: return TPixel(v, _p, _q);
+            }
+        }
+
+        /**
+         * @brief interpolate two pixels in fixed-point
+         * @param c1 The start color
+         * @param c2 The end color
+         * @param frac The step, 0 = c1 and max = c2
+         * @return The interpolated color
+         */
+        template <typename T, pixel_order TOrder>
+        inline basic_pixel<T, TOrder> interpolate(const basic_pixel<T, TOrder>& c1, const basic_pixel<T, TOrder>& c2, const T frac) {
+            using channel = fixed_channel<T>;
+            return basic_pixel<T, TOrder>(channel::lerp(c1.r, c2.r, frac), channel::lerp(c1.g, c2.g, frac),
+                                          channel::lerp(c1.b, c2.b, frac));
+        }
+
+        /**
+         * @brief Convert a float color to a packed pixel, the alpha value is ignored.
+         */
+        template <class TPixel, typename T>
+        inline TPixel to_pixel(const basic_color<T>& c) {
+            using channel = fixed_channel<typename TPixel::value_type>;
+            return TPixel(channel::from_float(c.r), channel::from_float(c.g), channel::from_float(c.b));
+        }
+
+        /**
+         * @brief A frame of N packed pixels, e.g. one LED strip.
+         *
+         * The pixels are stored back to back in wire order, data() can be handed to the driver as is.
+         * The bulk operations work on the flat channel array, so they are branch-free per channel and
+         * the compiler is free to vectorize them; there is no per-pixel float conversion.
+         *
+         * @tparam TPixel The pixel type, e.g. grb888.
+         * @tparam N The number of pixels.
+         */
+        template <class TPixel, utb::size_t N>
+        class basic_color_buffer {
+            static_assert(N > 0, "Size must be greater than zero.");
+            static_assert(sizeof(TPixel) == 3 * sizeof(typename TPixel::value_type), "Pixel must be packed.");
+        public:
+            using pixel_type = TPixel;
+            using value_type = typename TPixel::value_type;
+            using channel = fixed_channel<value_type>;
+            using pointer = TPixel*;
+            using const_pointer = const TPixel*;
+            using reference = TPixel&;
+            using const_reference = const TPixel&;
+            using iterator = TPixel*;
+            using const_iterator = const TPixel*;
+            using size_type = utb::size_t;
+            using self_type = basic_color_buffer<TPixel, N>;
+
+            basic_color_buffer() : m_ayPixel() { }
+
+            /**
+             * @brief Set all pixels to one color.
+             */
+            void fill(const_reference color) {
+                utb::fill_n(m_ayPixel, N, color);
+            }
+
+            /**
+             * @brief Set all pixels to black.
+             */
+            void clear() {
+                utb::fill_n(channels(), channel_count(), value_type(0));
+            }
+
+            /**
+             * @brief Scale every channel by brightness, max keeps the frame unchanged.
+             */
+            void scale(value_type brightness) {
+                value_type* _c = channels();
+                for (size_type i = 0; i < channel_count(); ++i)
+                    _c[i] = channel::scale(_c[i], brightness);
+            }
+
+            /**
+             * @brief Map every channel through a 256 entry table, e.g. a gamma table.
+             */
+            void apply_lut(const uint8_t* pTable) {
+                static_assert(sizeof(value_type) == 1, "apply_lut needs 8 bit channels.");
+                value_type* _c = channels();
+                for (size_type i = 0; i < channel_count(); ++i)
+                    _c[i] = pTable[_c[i]];
+            }
+
+            /**
+             * @brief Map every channel through a table object of utcolor_lut.h, e.g. gamma_lut<22>::instance().
+             * Reads through its operator[], so it works with the tables in flash (UTB_CONFIG_LUT_PROGMEM).
+             */
+            template <class TLut>
+            void apply_lut(const TLut& lut) {
+                static_assert(sizeof(value_type) == 1, "apply_lut needs 8 bit channels.");
+                value_type* _c = channels();
+                for (size_type i = 0; i < channel_count(); ++i)
+                    _c[i] = lut[_c[i]];
+            }
+
+            /**
+             * @brief Set this frame to the blend of from and to.
+             * @param frac The step, 0 = from and max = to.
+             */
+            void interpolate(const self_type& from, const self_type& to, value_type frac) {
+                const value_type* _a = from.channels();
+                const value_type* _b = to.channels();
+                value_type* _c = channels();
+
+                for (size_type i = 0; i < channel_count(); ++i)
+                    _c[i] = channel::lerp(_a[i], _b[i], frac);
+            }
+
+            /**
+             * @brief Fill the frame with a hue gradient.
+             * @param hue The hue of the first pixel.
+             * @param delta The hue step from pixel to pixel, wraps around.
+             */
+            void fill_rainbow(value_type hue, value_type delta, value_type s = channel::max, value_type v = channel::max) {
+                for (size_type i = 0; i < N; ++i, hue = value_type(hue + delta))
+                    m_ayPixel[i] = from_hsv_fixed<TPixel>(hue, s, v);
+            }
+
+            /**
+             * @brief Convert n hsv triples (h, s, v, h, s, v, ...) to the pixels, starting at first.
+             */
+            void from_hsv(const value_type* pHsv, size_type n, size_type first = 0) {
+                n = utb::min<size_type>(n, N - first);
+                for (size_type i = 0; i < n; ++i, pHsv += 3)
+                    m_ayPixel[first + i] = from_hsv_fixed<TPixel>(pHsv[0], pHsv[1], pHsv[2]);
+            }
+
+            reference operator[](size_type i)                   { return m_ayPixel[i]; }
+            const_reference operator[](size_type i) const       { return m_ayPixel[i]; }
+
+            iterator begin()                                    { return m_ayPixel; }
+            iterator end()                                      { return m_ayPixel + N; }
+            const_iterator begin() const                        { return m_ayPixel; }
+            const_iterator end() const                          { return m_ayPixel + N; }
+
+            /// The raw frame in wire order.
+            const uint8_t* data() const                         { return reinterpret_cast<const uint8_t*>(m_ayPixel); }
+
+            constexpr size_type size() const                    { return N; }
+            constexpr size_type bytes() const                   { return sizeof(m_ayPixel); }
+
+        private:
+            static constexpr size_type channel_count()          { return N * 3; }
+            value_type* channels()                              { return reinterpret_cast<value_type*>(m_ayPixel); }
+            const value_type* channels() const                  { return reinterpret_cast<const value_type*>(m_ayPixel); }
+
+        private:
+            pixel_type m_ayPixel[N];
+        };
+
+        template <utb::size_t N>
+        using grb888_buffer = basic_color_buffer<grb888, N>;
+
+        template <utb::size_t N>
+        using rgb888_buffer = basic_color_buffer<rgb888, N>;
+    }
+}
+
+#endif
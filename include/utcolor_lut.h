@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_COLOR_LUT_H__
+#define __UT_COLOR_LUT_H__
+
+#include "utconfig.h"
+#include <stdint.h>
+
+#if UTB_CONFIG_LUT_PROGMEM == UTB_YES
+    #include <avr/pgmspace.h>
+    #define UTB_LUT_STORAGE PROGMEM
+    #define UTB_LUT_CONSTEXPR
+#else
+    #define UTB_LUT_STORAGE
+    #define UTB_LUT_CONSTEXPR constexpr
+#endif
+
+namespace utb {
+    namespace graphic {
+        namespace internal {
+            /// Natural logarithm for the table generators, x > 0.
+            constexpr double lut_log(double x) {
+                // x = m * 2^k with m in [0.5, 1), then ln(m) = 2 atanh((m - 1) / (m + 1))
+                int _k = 0;
+                while (x < 0.5) { x *= 2; --_k; }
+                while (x >= 1.0) { x /= 2; ++_k; }
+
+                const double _y = (x - 1) / (x + 1);
+                const double _y2 = _y * _y;
+                double _term = _y, _sum = 0;
+                for (int n = 1; n < 40; n += 2) { _sum += _term / n; _term *= _y2; }
+
+                return 2 * _sum + _k * 0.69314718055994530942;
+            }
+
+            /// e^x for the table generators.
+            constexpr double lut_exp(double x) {
+                // e^x = (e^(x / 1024))^1024, the small argument converges after a few terms
+                x /= 1024;
+                double _term = 1, _sum = 1;
+                for (int n = 1; n < 12; ++n) { _term *= x / n; _sum += _term; }
+                for (int n = 0; n < 10; ++n) _sum *= _sum;
+                return _sum;
+            }
+
+            /// x^e for the table generators, x >= 0.
+            constexpr double lut_pow(double x, double e) {
+                return x <= 0 ? 0 : lut_exp(e * lut_log(x));
+            }
+
+            constexpr uint8_t lut_round8(double v) {
+                return v <= 0 ? 0 : (v >= 255 ? 255 : uint8_t(v + 0.5));
+            }
+
+            constexpr int16_t lut_round16(double v) {
+                return int16_t(v < 0 ? v - 0.5 : v + 0.5);
+            }
+
+        #if UTB_CONFIG_LUT_PROGMEM == UTB_YES
+            /// Read a table entry from flash.
+            inline uint8_t lut_read(const uint8_t* p)   { return pgm_read_byte(p); }
+            inline int16_t lut_read(const int16_t* p)   { return int16_t(pgm_read_word(p)); }
+
+            template <typename T>
+            inline T lut_read(const T* p) {
+                T _v;
+                memcpy_P(&_v, p, sizeof(T));
+                return _v;
+            }
+        #else
+            /// Read a table entry, from flash when UTB_CONFIG_LUT_PROGMEM is set.
+            template <typename T>
+            constexpr T lut_read(const T* p) { return *p; }
+        #endif
+        }
+
+        /**
+         * @brief A 256 entry gamma table, generated at compile time: out = 255 * (in / 255)^(TGamma10 / 10).
+         *
+         * Map the linear channel values of a frame through it before sending them to the LEDs,
+         * e.g. basic_color_buffer::apply_lut(gamma_lut<22>::instance()).
+         *
+         * @tparam TGamma10 The gamma times 10, 22 for gamma 2.2.
+         */
+        template <unsigned TGamma10>
+        struct gamma_lut {
+            uint8_t table[256];
+
+            constexpr gamma_lut() : table() {
+                for (unsigned i = 0; i < 256; ++i)
+                    table[i] = internal::lut_round8(255.0 * internal::lut_pow(i / 255.0, TGamma10 / 10.0));
+            }
+
+            UTB_LUT_CONSTEXPR uint8_t operator[](uint8_t i) const  { return internal::lut_read(&table[i]); }
+            /// The raw table, in program memory when UTB_CONFIG_LUT_PROGMEM is set.
+            constexpr const uint8_t* data() const                   { return table; }
+
+            static const gamma_lut<TGamma10>& instance() {
+                static constexpr gamma_lut<TGamma10> _lut UTB_LUT_STORAGE = gamma_lut<TGamma10>();
+                return _lut;
+            }
+        };
+
+        /**
+         * @brief The sRGB decode curve as 256 entry table, sRGB encoded values to linear 0 - 255.
+         */
+        struct srgb_lut {
+            uint8_t table[256];
+
+            constexpr srgb_lut() : table() {
+                for (unsigned i = 0; i < 256; ++i) {
+                    const double _c = i / 255.0;
+                    table[i] = internal::lut_round8(255.0 * (_c <= 0.04045 ? _c / 12.92
+                                                   : internal::lut_pow((_c + 0.055) / 1.055, 2.4)));
+                }
+            }
+
+            UTB_LUT_CONSTEXPR uint8_t operator[](uint8_t i) const  { return internal::lut_read(&table[i]); }
+            /// The raw table, in program memory when UTB_CONFIG_LUT_PROGMEM is set.
+            constexpr const uint8_t* data() const                   { return table; }
+
+            static const srgb_lut& instance() {
+                static constexpr srgb_lut _lut UTB_LUT_STORAGE = srgb_lut();
+                return _lut;
+            }
+        };
+
+        /**
+         * @brief Hue sextant table for the 8 bit hsv conversion: sector and position in the sector
+         * for every hue 0 - 255, replaces the multiply by six and the split.
+         */
+        struct hsv_sextant_lut {
+            uint8_t sector[256];
+            uint8_t fraction[256];
+
+            constexpr hsv_sextant_lut() : sector(), fraction() {
+                for (unsigned h = 0; h < 256; ++h) {
+                    sector[h] = uint8_t((h * 6) >> 8);
+                    fraction[h] = uint8_t((h * 6) & 0xFF);
+                }
+            }
+
+            static const hsv_sextant_lut& instance() {
+                static constexpr hsv_sextant_lut _lut UTB_LUT_STORAGE = hsv_sextant_lut();
+                return _lut;
+            }
+        };
+
+        /**
+         * @brief Fraction table for the float hsv conversion: position i / 256 in a sextant, so the
+         * float path needs neither floor() nor a division.
+         */
+        template <typename T>
+        struct hsv_fraction_lut {
+            T fraction[256];
+
+            constexpr hsv_fraction_lut() : fraction() {
+                for (unsigned i = 0; i < 256; ++i) fraction[i] = T(i / 256.0);
+            }
+
+            static const hsv_fraction_lut<T>& instance() {
+                static constexpr hsv_fraction_lut<T> _lut UTB_LUT_STORAGE = hsv_fraction_lut<T>();
+                return _lut;
+            }
+        };
+
+        /**
+         * @brief The yuv coefficient products for every 8 bit y, u and v, rounded to integers.
+         */
+        struct yuv_lut {
+            int16_t y[256];      ///< 1.164 * (y - 16)
+            int16_t rv[256];     ///< 1.596 * (v - 128)
+            int16_t gv[256];     ///< 0.813 * (v - 128)
+            int16_t gu[256];     ///< 0.391 * (u - 128)
+            int16_t bu[256];     ///< 2.018 * (u - 128)
+
+            constexpr yuv_lut() : y(), rv(), gv(), gu(), bu() {
+                for (int i = 0; i < 256; ++i) {
+                    y[i]  = internal::lut_round16(1.164 * (i - 16));
+                    rv[i] = internal::lut_round16(1.596 * (i - 128));
+                    gv[i] = internal::lut_round16(0.813 * (i - 128));
+                    gu[i] = internal::lut_round16(0.391 * (i - 128));
+                    bu[i] = internal::lut_round16(2.018 * (i - 128));
+                }
+            }
+
+            static const yuv_lut& instance() {
+                static constexpr yuv_lut _lut UTB_LUT_STORAGE = yuv_lut();
+                return _lut;
+            }
+        };
+    }
+}
+
+#endif
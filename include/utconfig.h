@@ -37,6 +37,32 @@
 #define UTB_CONFIG_ENABLE_ATOMIC UTB_YES
 #endif
 
+#ifndef UTB_CONFIG_ENABLE_SIMD
+#define UTB_CONFIG_ENABLE_SIMD UTB_YES
+#endif
+
+#ifndef UTB_CONFIG_CACHE_LINE_SIZE
+#define UTB_CONFIG_CACHE_LINE_SIZE UTB_SIZE_TYPE_AUTO
+#endif
+
+#ifndef UTB_CONFIG_LUT_PROGMEM
+    /// The tables of utcolor_lut.h in flash, on by default for AVR where .rodata is copied to RAM
+    #if defined(__AVR__)
+        #define UTB_CONFIG_LUT_PROGMEM UTB_YES
+    #else
+        #define UTB_CONFIG_LUT_PROGMEM UTB_NO
+    #endif
+#endif
+
+#ifndef UTB_CONFIG_ENABLE_COROUTINE
+    /// The C++20 coroutine types of utcoroutine.h, on by default when the compiler supports them
+    #if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+        #define UTB_CONFIG_ENABLE_COROUTINE UTB_YES
+    #else
+        #define UTB_CONFIG_ENABLE_COROUTINE UTB_NO
+    #endif
+#endif
+
 #ifndef UTB_CONFIG_BASIC_HASHMUL_VAL
 	/// Basic value for struct::hash as basic hash calculate @see utb::hash
 	#define UTB_CONFIG_BASIC_HASHMUL_VAL 2149645487U
@@ -87,7 +113,18 @@
     #endif  
 #endif
 
-
+#if UTB_CONFIG_CACHE_LINE_SIZE == UTB_SIZE_TYPE_AUTO
+    #undef UTB_CONFIG_CACHE_LINE_SIZE
+    #if __SIZEOF_POINTER__ == 2
+        #define UTB_CONFIG_CACHE_LINE_SIZE 1                    // 16-bit MCU, no cache
+    #elif __SIZEOF_POINTER__ == 4
+        #define UTB_CONFIG_CACHE_LINE_SIZE 32                   // 32-bit MCU
+    #elif __SIZEOF_POINTER__ == 8
+        #define UTB_CONFIG_CACHE_LINE_SIZE 64                   // 64-bit system
+    #else
+        #error "Unknown cache line size — cannot auto-detect UTB_CONFIG_CACHE_LINE_SIZE"
+    #endif
+#endif
 
 
 static_assert(sizeof(index_type) * 8 == UTB_SIZE_TYPE,
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_COROUTINE_H__
+#define __UT_COROUTINE_H__
+
+#include "utconfig.h"
+#include "utalgorithm.h"
+
+/**
+ * Stackless coroutines in two flavours:
+ *
+ *  - C++20 (UTB_CONFIG_ENABLE_COROUTINE): basic_co_task with its frame in a static pool, and the
+ *    awaitables co_sleep() (timer wheel), co_defer() (scheduler) and co_event.
+ *  - every compiler: the UTB_CO_* macros, a switch over the line of the last wait (Duff's device)
+ *    in a function that returns true when the coroutine has finished.
+ */
+
+namespace utb {
+
+    /**
+     * @brief The resume point of a macro coroutine, see UTB_CO_BEGIN.
+     */
+    struct co_state {
+        static constexpr uint16_t finished = 0xFFFF;
+
+        uint16_t line;
+        uint32_t mark;
+
+        co_state() noexcept : line(0), mark(0) { }
+
+        bool done() const noexcept                              { return line == finished; }
+        void reset() noexcept                                   { line = 0; }
+    };
+}
+
+/**
+ * Macro coroutines keep only the resume line in a co_state, so local variables do not survive a
+ * wait and the body may not contain a switch of its own; keep the state of the driver in members.
+ * @code
+ * struct uart_reader {
+ *     utb::co_state co;
+ *     uint8_t header;
+ *
+ *     bool step(uint32_t now) {
+ *         UTB_CO_BEGIN(co);
+ *         UTB_CO_WAIT_UNTIL(co, rx.available() >= 1);
+ *         header = rx.read();
+ *         UTB_CO_WAIT_TICKS(co, now, 5);           // without blocking the CPU
+ *         UTB_CO_WAIT_UNTIL(co, rx.available() >= header);
+ *         parse();
+ *         UTB_CO_END(co);
+ *     }
+ * };
+ * @endcode
+ */
+#if __cplusplus >= 201703L
+    #define UTB_CO_FALLTHROUGH [[fallthrough]]
+#elif defined(__GNUC__) && __GNUC__ >= 7
+    #define UTB_CO_FALLTHROUGH __attribute__((fallthrough))
+#else
+    #define UTB_CO_FALLTHROUGH ((void)0)
+#endif
+
+#define UTB_CO_BEGIN(state)                                                             \
+    switch ((state).line) { case 0:
+
+#define UTB_CO_YIELD(state)                                                             \
+    do {                                                                                \
+        static_assert(__LINE__ < utb::co_state::finished, "The coroutine is too far down the file."); \
+        (state).line = __LINE__; return false; case __LINE__:;                          \
+    } while (0)
+
+#define UTB_CO_WAIT_UNTIL(state, cond)                                                  \
+    do {                                                                                \
+        static_assert(__LINE__ < utb::co_state::finished, "The coroutine is too far down the file."); \
+        (state).line = __LINE__; UTB_CO_FALLTHROUGH; case __LINE__:                      \
+        if (!(cond)) return false;                                                      \
+    } while (0)
+
+/// Wait until ticks have passed on the wrapping 32 bit clock now.
+#define UTB_CO_WAIT_TICKS(state, now, ticks)                                            \
+    do {                                                                                \
+        (state).mark = uint32_t(now);                                                   \
+        UTB_CO_WAIT_UNTIL(state, uint32_t(uint32_t(now) - (state).mark) >= uint32_t(ticks)); \
+    } while (0)
+
+#define UTB_CO_END(state)                                                               \
+        default: break;                                                                 \
+    }                                                                                   \
+    (state).line = utb::co_state::finished;                                             \
+    return true
+
+#if UTB_CONFIG_ENABLE_COROUTINE == UTB_YES
+
+#include <coroutine>
+#include <exception>
+#include "utalignment.h"
+#include "utintrusive_list.h"
+#include "utpool.h"
+
+namespace utb {
+
+    /**
+     * @brief Frame allocator of basic_co_task: TFrames frames of at most TFrameSize bytes in a
+     * static pool, shared by all tasks with the same parameters.
+     */
+    template <utb::size_t TFrameSize = 128, utb::size_t TFrames = 8>
+    struct coroutine_frames {
+        struct frame {
+            alignas(max_alignment) unsigned char bytes[TFrameSize];
+        };
+        using pool_type = basic_pool<frame, TFrames>;
+
+        /// A frame for n bytes, nullptr when it is too large or the pool is exhausted.
+        static void* allocate(utb::size_t n) noexcept   { return n <= TFrameSize ? pool().allocate() : nullptr; }
+        static void deallocate(void* p) noexcept        { pool().deallocate(p); }
+
+        static pool_type& pool() noexcept {
+            static pool_type _pool;
+            return _pool;
+        }
+    };
+
+    /**
+     * @brief A lazily started C++20 coroutine whose frame comes from TFrameAllocator.
+     *
+     * The coroutine runs up to its first suspension on the first resume(). When no frame is left,
+     * calling the coroutine function returns an invalid task instead of allocating from the heap.
+     * The task is callable, so it can be the body of a scheduler task or a timer callback.
+     * @code
+     * utb::co_task blink(utb::timer_wheel<8>& timers) {
+     *     for (;;) {
+     *         toggle_led();
+     *         co_await utb::co_sleep(timers, 500);
+     *     }
+     * }
+     *
+     * utb::co_task led = blink(timers);
+     * led.resume();            // runs to the first co_await, the wheel resumes it later
+     * @endcode
+     */
+    template <class TFrameAllocator = coroutine_frames<> >
+    class basic_co_task {
+    public:
+        struct promise_type {
+            basic_co_task get_return_object() noexcept {
+                return basic_co_task(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+            static basic_co_task get_return_object_on_allocation_failure() noexcept { return basic_co_task(); }
+
+            std::suspend_always initial_suspend() noexcept      { return {}; }
+            std::suspend_always final_suspend() noexcept        { return {}; }
+            void return_void() noexcept                         { }
+            void unhandled_exception() noexcept                 { std::terminate(); }
+
+            static void* operator new(std::size_t n) noexcept   { return TFrameAllocator::allocate(n); }
+            static void operator delete(void* p) noexcept       { TFrameAllocator::deallocate(p); }
+        };
+        using handle_type = std::coroutine_handle<promise_type>;
+        using self_type = basic_co_task<TFrameAllocator>;
+
+        basic_co_task() noexcept : m_handle(nullptr) { }
+        basic_co_task(self_type&& other) noexcept : m_handle(other.m_handle) { other.m_handle = nullptr; }
+
+        self_type& operator=(self_type&& other) noexcept {
+            if (this != &other) {
+                if (m_handle) m_handle.destroy();
+                m_handle = other.m_handle;
+                other.m_handle = nullptr;
+            }
+            return *this;
+        }
+
+        basic_co_task(const self_type&) = delete;
+        self_type& operator=(const self_type&) = delete;
+
+        ~basic_co_task()                                        { if (m_handle) m_handle.destroy(); }
+
+        /**
+         * @brief Run the coroutine to its next suspension.
+         * @return False when it has finished.
+         */
+        bool resume() {
+            if (done()) return false;
+            m_handle.resume();
+            return !m_handle.done();
+        }
+
+        void operator()()                                       { resume(); }
+
+        /// False when the frame could not be allocated.
+        bool valid() const noexcept                             { return bool(m_handle); }
+        bool done() const noexcept                              { return !m_handle || m_handle.done(); }
+
+    private:
+        explicit basic_co_task(handle_type h) noexcept : m_handle(h) { }
+
+        handle_type m_handle;
+    };
+
+    using co_task = basic_co_task<>;
+
+    namespace internal {
+        template <class TWheel>
+        class co_sleep_awaiter {
+        public:
+            co_sleep_awaiter(TWheel& wheel, uint32_t ticks) noexcept
+                : m_wheel(wheel), m_iTicks(ticks), m_id(0) { }
+
+            ~co_sleep_awaiter()                                 { if (m_id) m_wheel.cancel(m_id); }
+
+            bool await_ready() const noexcept                   { return m_iTicks == 0; }
+            bool await_suspend(std::coroutine_handle<> h) {
+                m_id = m_wheel.schedule(m_iTicks, [h]() { h.resume(); });
+                return m_id != 0;               // no timer left: do not wait
+            }
+            void await_resume() noexcept                        { }
+
+        private:
+            TWheel& m_wheel;
+            uint32_t m_iTicks;
+            uint32_t m_id;
+        };
+
+        template <class TScheduler>
+        class co_defer_awaiter {
+        public:
+            co_defer_awaiter(TScheduler& sched, uint32_t ticks) noexcept
+                : m_sched(sched), m_iTicks(ticks), m_id(0) { }
+
+            ~co_defer_awaiter()                                 { if (m_id) m_sched.cancel_deferred(m_id); }
+
+            bool await_ready() const noexcept                   { return false; }
+            bool await_suspend(std::coroutine_handle<>) {
+                if (m_iTicks == 0) {
+                    m_sched.post(m_sched.current());
+                    return true;
+                }
+                m_id = m_sched.defer(m_sched.current(), m_iTicks);
+                return m_id != 0;
+            }
+            void await_resume() noexcept                        { }
+
+        private:
+            TScheduler& m_sched;
+            uint32_t m_iTicks;
+            uint32_t m_id;
+        };
+    }
+
+    /**
+     * @brief Suspend for ticks of a basic_timer_wheel; the wheel's tick() resumes the coroutine.
+     */
+    template <class TWheel>
+    inline internal::co_sleep_awaiter<TWheel> co_sleep(TWheel& wheel, uint32_t ticks) {
+        return internal::co_sleep_awaiter<TWheel>(wheel, ticks);
+    }
+
+    /**
+     * @brief Suspend a coroutine that runs as the current task of a basic_scheduler and post that
+     * task again after ticks (0: at once, behind the other ready tasks).
+     * @code
+     * utb::co_task driver = run_driver();
+     * utb::task_id id = sched.create(3, [&driver]() { driver.resume(); });
+     * @endcode
+     */
+    template <class TScheduler>
+    inline internal::co_defer_awaiter<TScheduler> co_defer(TScheduler& sched, uint32_t ticks = 0) {
+        return internal::co_defer_awaiter<TScheduler>(sched, ticks);
+    }
+
+    /**
+     * @brief An event that coroutines wait for with co_await, e.g. "rx data available".
+     *
+     * set() resumes all waiting coroutines in the caller, so call it from the main loop or a task,
+     * not from an interrupt. The event stays set until reset(); a set event does not suspend.
+     */
+    class co_event {
+    public:
+        class awaiter : public intrusive_list_hook {
+        public:
+            explicit awaiter(co_event& ev) noexcept : m_event(ev) { }
+            ~awaiter()                                          { if (is_linked()) m_event.m_waiters.erase(*this); }
+
+            bool await_ready() const noexcept                   { return m_event.m_bSet; }
+            void await_suspend(std::coroutine_handle<> h)       { m_handle = h; m_event.m_waiters.push_back(*this); }
+            void await_resume() noexcept                        { }
+
+        private:
+            friend class co_event;
+            co_event& m_event;
+            std::coroutine_handle<> m_handle;
+        };
+
+        co_event() noexcept : m_bSet(false) { }
+        co_event(const co_event&) = delete;
+        co_event& operator=(const co_event&) = delete;
+
+        awaiter operator co_await() noexcept                    { return awaiter(*this); }
+
+        /// Set the event and resume the coroutines that were waiting.
+        void set() {
+            m_bSet = true;
+            // a resumed coroutine may reset() and wait again, it then waits for the next set()
+            for (utb::size_t n = m_waiters.size(); n > 0 && !m_waiters.empty(); --n) {
+                awaiter& _a = m_waiters.front();
+                m_waiters.pop_front();
+                _a.m_handle.resume();
+            }
+        }
+
+        void reset() noexcept                                   { m_bSet = false; }
+        bool is_set() const noexcept                            { return m_bSet; }
+        bool has_waiters() const noexcept                       { return !m_waiters.empty(); }
+
+    private:
+        basic_intrusive_list<awaiter> m_waiters;
+        bool m_bSet;
+    };
+}
+
+#endif // UTB_CONFIG_ENABLE_COROUTINE
+
+#endif // __UT_COROUTINE_H__
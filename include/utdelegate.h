@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_DELEGATE_H__
+#define __UT_DELEGATE_H__
+
+#include "utconfig.h"
+#include "utalgorithm.h"
+#include "utalignment.h"
+#include "utfunctional.h"
+
+namespace utb {
+
+    /// Handle of a callback in a basic_multicast_delegate, 0 is never a valid handle.
+    using delegate_id = uint16_t;
+    constexpr delegate_id invalid_delegate = 0;
+
+    template <class TSig, utb::size_t TCapacity, utb::size_t TGroups, utb::size_t TSlotSize>
+    class basic_multicast_delegate;
+
+    /**
+     * @brief A list of callbacks that are all called with the same arguments, grouped by type.
+     *
+     * The callbacks are stored by value in TCapacity slots of TSlotSize bytes. Callbacks of the
+     * same concrete type form a group in consecutive slots, and invoking the delegate makes one
+     * indirect call per group into a loop that calls the group's callbacks directly, so the
+     * compiler can inline them. Inside a group the callbacks run in the order they were added,
+     * the groups run in the order their first callback was added.
+     *
+     * A callback may remove itself or others while the delegate is running: it is skipped from
+     * then on and destroyed when the outermost call returns. add() is refused while running.
+     * @code
+     * struct filter { float* out; float k; void operator()(const sample& s) const { ... } };
+     *
+     * static utb::multicast_delegate<void(const sample&), 32> on_sample;
+     * for (auto& f : filters) on_sample.add(f);       // all filters form one group
+     * on_sample.add(&log_sample);                     // function pointers form another
+     * on_sample(s);
+     * @endcode
+     *
+     * @tparam TSig The signature, void(Args...).
+     * @tparam TCapacity The maximal number of callbacks.
+     * @tparam TGroups The maximal number of different callback types.
+     * @tparam TSlotSize The maximal size of one callback.
+     */
+    template <class... Args, utb::size_t TCapacity, utb::size_t TGroups, utb::size_t TSlotSize>
+    class basic_multicast_delegate<void(Args...), TCapacity, TGroups, TSlotSize> {
+        static_assert(TCapacity > 0 && TCapacity < 0xFFFF, "The capacity must be in 1 - 65534.");
+        static_assert(TGroups > 0, "A delegate needs at least one group.");
+    public:
+        using size_type = utb::size_t;
+        using self_type = basic_multicast_delegate<void(Args...), TCapacity, TGroups, TSlotSize>;
+
+        basic_multicast_delegate() noexcept : m_sSlots(0), m_sGroups(0), m_iNextId(1), m_iDepth(0), m_bDirty(false) { }
+
+        ~basic_multicast_delegate()                             { clear(); }
+
+        basic_multicast_delegate(const self_type&) = delete;
+        self_type& operator=(const self_type&) = delete;
+
+        /**
+         * @brief Add a copy of fn behind the callbacks of the same type.
+         * @return The handle, invalid_delegate when the delegate is full, has no group left for
+         * a new type, or is running.
+         */
+        template <class TFn>
+        delegate_id add(TFn&& fn) {
+            using callback_type = decay_t<TFn>;
+            static_assert(sizeof(callback_type) <= TSlotSize, "The callback does not fit into a slot.");
+            static_assert(alignof(callback_type) <= alignof(slot_storage), "The callback is too aligned.");
+
+            if (m_iDepth != 0 || m_sSlots == TCapacity) return invalid_delegate;
+
+            const group_ops* _ops = ops_of<callback_type>::get();
+            size_type _g = 0;
+            while (_g < m_sGroups && m_ayGroups[_g].ops != _ops) ++_g;
+
+            if (_g == m_sGroups) {
+                if (m_sGroups == TGroups) return invalid_delegate;
+                m_ayGroups[_g] = group{ _ops, uint16_t(m_sSlots), 0 };
+                ++m_sGroups;
+            }
+
+            // the new callback goes behind its group, the later groups move up one slot
+            const size_type _pos = m_ayGroups[_g].first + m_ayGroups[_g].count;
+            for (size_type g = m_sGroups - 1; g > _g; --g) {
+                group& _later = m_ayGroups[g];
+                for (size_type s = _later.first + _later.count; s > _later.first; --s) relocate(_later, s - 1, s);
+                ++_later.first;
+            }
+
+            new (&m_aySlots[_pos].data) callback_type(utb::forward<TFn>(fn));
+            m_aySlots[_pos].id = next_id();
+            ++m_ayGroups[_g].count;
+            ++m_sSlots;
+            return m_aySlots[_pos].id;
+        }
+
+        /**
+         * @brief Remove a callback, also from inside a callback of this delegate.
+         * @return False when id is not in the delegate.
+         */
+        bool remove(delegate_id id) {
+            if (id == invalid_delegate) return false;
+
+            for (size_type i = 0; i < m_sSlots; ++i) {
+                if (m_aySlots[i].id != id) continue;
+
+                m_aySlots[i].id = invalid_delegate;
+                m_bDirty = true;
+                if (m_iDepth == 0) compact();
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Call all callbacks with args, group by group.
+         */
+        void operator()(Args... args) {
+            ++m_iDepth;
+            for (size_type g = 0; g < m_sGroups; ++g) {
+                const group& _g = m_ayGroups[g];
+                _g.ops->invoke(&m_aySlots[_g.first], _g.count, args...);
+            }
+            if (--m_iDepth == 0 && m_bDirty) compact();
+        }
+
+        void invoke(Args... args)                               { (*this)(args...); }
+
+        /// Remove all callbacks, not while running.
+        void clear() {
+            assert(m_iDepth == 0);
+            for (size_type i = 0; i < m_sSlots; ++i) m_aySlots[i].id = invalid_delegate;
+            m_bDirty = true;
+            compact();
+        }
+
+        size_type size() const noexcept                         { return m_sSlots; }
+        size_type groups() const noexcept                       { return m_sGroups; }
+        bool empty() const noexcept                             { return m_sSlots == 0; }
+        bool full() const noexcept                              { return m_sSlots == TCapacity; }
+        constexpr size_type capacity() const noexcept           { return TCapacity; }
+
+    private:
+        struct slot_storage {
+            alignas(max_alignment) unsigned char bytes[TSlotSize];
+        };
+        struct slot {
+            slot_storage data;
+            delegate_id id;
+        };
+
+        /// What a group does with its callbacks, one table per callback type.
+        struct group_ops {
+            void (*invoke)(slot* first, size_type n, Args... args);
+            /// Move-construct src into dst and destroy src, nullptr: copy the bytes.
+            void (*relocate)(slot_storage* src, slot_storage* dst);
+            /// nullptr: nothing to destroy.
+            void (*destroy)(slot_storage* p);
+        };
+
+        struct group {
+            const group_ops* ops;
+            uint16_t first;
+            uint16_t count;
+        };
+
+        template <class T>
+        struct ops_of {
+            static void invoke(slot* first, size_type n, Args... args) {
+                for (size_type i = 0; i < n; ++i) {
+                    if (first[i].id != invalid_delegate) (*reinterpret_cast<T*>(&first[i].data))(args...);
+                }
+            }
+            static void relocate(slot_storage* src, slot_storage* dst) {
+                new (dst) T(utb::move(*reinterpret_cast<T*>(src)));
+                reinterpret_cast<T*>(src)->~T();
+            }
+            static void destroy(slot_storage* p)                { reinterpret_cast<T*>(p)->~T(); }
+
+            static const group_ops* get() {
+                static const group_ops _table = {
+                    &invoke,
+                    is_trivially_copyable<T>::value ? nullptr : &relocate,
+                    is_trivially_copyable<T>::value ? nullptr : &destroy
+                };
+                return &_table;
+            }
+        };
+
+        void relocate(const group& g, size_type from, size_type to) {
+            if (g.ops->relocate) g.ops->relocate(&m_aySlots[from].data, &m_aySlots[to].data);
+            else m_aySlots[to].data = m_aySlots[from].data;
+            m_aySlots[to].id = m_aySlots[from].id;
+        }
+
+        /// Destroy the removed callbacks and close the gaps, empty groups are dropped.
+        void compact() {
+            size_type _write = 0, _groups = 0;
+
+            for (size_type g = 0; g < m_sGroups; ++g) {
+                group _g = m_ayGroups[g];
+                const size_type _first = _write;
+
+                for (size_type s = _g.first; s < size_type(_g.first + _g.count); ++s) {
+                    if (m_aySlots[s].id == invalid_delegate) {
+                        if (_g.ops->destroy) _g.ops->destroy(&m_aySlots[s].data);
+                        continue;
+                    }
+                    if (s != _write) relocate(_g, s, _write);
+                    ++_write;
+                }
+                if (_write == _first) continue;
+
+                m_ayGroups[_groups++] = group{ _g.ops, uint16_t(_first), uint16_t(_write - _first) };
+            }
+            m_sSlots = _write;
+            m_sGroups = _groups;
+            m_bDirty = false;
+        }
+
+        delegate_id next_id() {
+            // skip 0 and ids that are still in use after a wrap
+            for (;;) {
+                const delegate_id _id = m_iNextId++;
+                if (_id == invalid_delegate) continue;
+
+                size_type i = 0;
+                while (i < m_sSlots && m_aySlots[i].id != _id) ++i;
+                if (i == m_sSlots) return _id;
+            }
+        }
+
+        slot m_aySlots[TCapacity];
+        group m_ayGroups[TGroups];
+        size_type m_sSlots;
+        size_type m_sGroups;
+        delegate_id m_iNextId;
+        uint16_t m_iDepth;
+        bool m_bDirty;
+    };
+
+    template <class TSig, utb::size_t TCapacity>
+    using multicast_delegate = basic_multicast_delegate<TSig, TCapacity, 8, sizeof(void*) * 4>;
+}
+
+#endif // __UT_DELEGATE_H__
@@ -27,7 +27,7 @@ namespace utb {
 		constexpr ebo_storage() = default;
 
 		template<typename U>
-		constexpr ebo_storage(U&& u) noexcept : m_iItem(utb::forward(u) ) {}
+		constexpr ebo_storage(U&& u) noexcept : m_iItem(utb::forward<U>(u) ) {}
 
 				  		reference get() noexcept 		{ return m_iItem; }
 		constexpr const_reference get() const noexcept 	{ return m_iItem; }
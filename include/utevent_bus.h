@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_EVENT_BUS_H__
+#define __UT_EVENT_BUS_H__
+
+#include "utconfig.h"
+#include "utalgorithm.h"
+#include "utfunction.h"
+#include "uttypetraits.h"
+#include "utspsc_queue.h"
+
+namespace utb {
+
+    /// Handle of a subscription: the generation of the slot in the high 16 bits, then the event id and the slot.
+    using subscription_id = uint32_t;
+    constexpr subscription_id invalid_subscription = 0xFFFFFFFF;
+
+    namespace internal {
+        /// The position of TEvent in TEvents, the compile-time id of the event.
+        template <class TEvent, class... TEvents>
+        struct event_index {
+            static_assert(sizeof(TEvent) == 0, "The event type is not registered at this bus.");
+        };
+        template <class TEvent, class... TEvents>
+        struct event_index<TEvent, TEvent, TEvents...> {
+            static constexpr utb::size_t value = 0;
+        };
+        template <class TEvent, class TOther, class... TEvents>
+        struct event_index<TEvent, TOther, TEvents...> {
+            static constexpr utb::size_t value = 1 + event_index<TEvent, TEvents...>::value;
+        };
+
+        constexpr utb::size_t event_max(utb::size_t a)                  { return a; }
+        template <class... TRest>
+        constexpr utb::size_t event_max(utb::size_t a, utb::size_t b, TRest... rest) {
+            return event_max(a > b ? a : b, rest...);
+        }
+
+        /// The subscribers of one event type, a contiguous array of handlers.
+        template <class TEvent, utb::size_t TSubscribers>
+        struct event_subscribers {
+            utb::function<void(const TEvent&)> handlers[TSubscribers];
+            bool removed[TSubscribers] = {};    // unsubscribed while publishing, reset afterwards
+            uint16_t generation[TSubscribers] = {};     // bumped by unsubscribe, stale ids do not match
+            uint8_t count = 0;      // one past the last used slot
+            uint8_t depth = 0;      // running publish() calls
+            bool dirty = false;
+
+            bool active(utb::size_t slot) const { return handlers[slot] && !removed[slot]; }
+        };
+
+        template <utb::size_t TSubscribers, class... TEvents>
+        struct event_tables : event_subscribers<TEvents, TSubscribers>... { };
+
+        /// A queued event: its id and a copy of its bytes.
+        template <utb::size_t TSize, utb::size_t TAlign>
+        struct event_record {
+            uint8_t id;
+            alignas(TAlign) unsigned char data[TSize];
+        };
+
+        /// Stands in for the deferred queue of a bus without one.
+        template <class TRecord>
+        struct no_event_queue {
+            bool try_push(const TRecord&) noexcept              { return false; }
+            bool try_pop(TRecord&) noexcept                     { return false; }
+            utb::size_t size() const noexcept                   { return 0; }
+            bool empty() const noexcept                         { return true; }
+        };
+    }
+
+    /**
+     * @brief Typed publish/subscribe bus with a fixed table of subscribers per event type.
+     *
+     * Every event type in TEvents gets a compile-time id (its position) and an array of
+     * TSubscribers handlers. publish() walks that array and calls the handlers in subscription
+     * order, nothing is allocated and no lookup happens at run time. post() copies the event into
+     * a lock-free single-producer queue of TQueue entries (TQueue = 0: no queue), dispatch()
+     * publishes the queued events later from the main loop; post() may be called from one
+     * interrupt or thread. Queued events must be trivially copyable.
+     * @code
+     * struct button_pressed { uint8_t pin; };
+     * struct frame_received { uint8_t length; uint8_t data[16]; };
+     *
+     * static utb::event_bus<button_pressed, frame_received> bus;
+     *
+     * bus.subscribe<button_pressed>([](const button_pressed& e) { toggle(e.pin); });
+     * void EXTI_IRQHandler() { bus.post(button_pressed{ 3 }); }
+     * for (;;) { bus.dispatch(); }
+     * @endcode
+     *
+     * @tparam TSubscribers The handlers per event type, at most 254.
+     * @tparam TQueue The entries of the deferred queue, 0 or a power of two.
+     * @tparam TEvents The event types, at most 254.
+     */
+    template <utb::size_t TSubscribers, utb::size_t TQueue, class... TEvents>
+    class basic_event_bus {
+        static_assert(sizeof...(TEvents) > 0 && sizeof...(TEvents) < 0xFF, "A bus needs 1 - 254 event types.");
+        static_assert(TSubscribers > 0 && TSubscribers < 0xFF, "A bus needs 1 - 254 subscribers per event.");
+    #if UTB_CONFIG_ENABLE_ATOMIC != UTB_YES
+        static_assert(TQueue == 0, "The deferred queue needs atomics, see UTB_CONFIG_ENABLE_ATOMIC.");
+    #endif
+    public:
+        using size_type = utb::size_t;
+        using self_type = basic_event_bus<TSubscribers, TQueue, TEvents...>;
+
+        template <class TEvent>
+        using handler_type = utb::function<void(const TEvent&)>;
+
+        /// The compile-time id of TEvent.
+        template <class TEvent>
+        static constexpr size_type id_of()                      { return internal::event_index<TEvent, TEvents...>::value; }
+
+        static constexpr size_type event_count = sizeof...(TEvents);
+
+        basic_event_bus() noexcept { }
+        basic_event_bus(const self_type&) = delete;
+        self_type& operator=(const self_type&) = delete;
+
+        /**
+         * @brief Add a handler for TEvent, it is called after the earlier ones.
+         * @return The subscription, invalid_subscription when all slots of TEvent are in use.
+         */
+        template <class TEvent, class TFn>
+        subscription_id subscribe(TFn&& fn) {
+            subscribers<TEvent>& _s = table<TEvent>();
+
+            size_type _slot = 0;
+            while (_slot < _s.count && _s.handlers[_slot]) ++_slot;    // reuse a free slot
+            if (_slot == TSubscribers) return invalid_subscription;
+
+            _s.handlers[_slot] = handler_type<TEvent>(utb::forward<TFn>(fn));
+            if (_slot == _s.count) ++_s.count;
+            return (subscription_id(_s.generation[_slot]) << 16) | subscription_id(id_of<TEvent>() << 8) | subscription_id(_slot);
+        }
+
+        /**
+         * @brief Remove a handler, the slots of the other handlers do not move.
+         *
+         * Also from inside a handler: during publish() the handler is only marked and is destroyed
+         * when the outermost publish() of its event returns.
+         * @return False when id is not an active subscription.
+         */
+        bool unsubscribe(subscription_id id) {
+            static const unsubscriber _table[] = { &self_type::unsubscribe_erased<TEvents>... };
+
+            const size_type _event = (id >> 8) & 0xFF;
+            if (id == invalid_subscription || _event >= event_count) return false;
+            return _table[_event](*this, id & 0xFF, uint16_t(id >> 16));
+        }
+
+        /**
+         * @brief Call the handlers of e now, in the caller.
+         * @return The number of handlers called.
+         */
+        template <class TEvent>
+        size_type publish(const TEvent& e) {
+            subscribers<TEvent>& _s = table<TEvent>();
+            size_type _called = 0;
+
+            ++_s.depth;
+            for (size_type i = 0; i < _s.count; ++i) {
+                if (!_s.active(i)) continue;
+                _s.handlers[i](e);
+                ++_called;
+            }
+            if (--_s.depth == 0 && _s.dirty) purge(_s);
+            return _called;
+        }
+
+        /**
+         * @brief Queue a copy of e for dispatch(), from one producer context.
+         * @return False when the queue is full.
+         */
+        template <class TEvent>
+        bool post(const TEvent& e) noexcept {
+            static_assert(TQueue > 0, "This bus has no deferred queue.");
+            static_assert(is_trivially_copyable<TEvent>::value, "Queued events must be trivially copyable.");
+
+            record_type _r;
+            _r.id = uint8_t(id_of<TEvent>());
+            memcpy(_r.data, &e, sizeof(TEvent));
+            return m_queue.try_push(_r);
+        }
+
+        /**
+         * @brief Publish the queued events, at most max of them.
+         * @return The number of events dispatched.
+         */
+        size_type dispatch(size_type max = size_type(-1)) {
+            static const publisher _table[] = { &self_type::publish_erased<TEvents>... };
+
+            size_type _events = 0;
+            record_type _r;
+            while (_events < max && m_queue.try_pop(_r)) {
+                _table[_r.id](*this, _r.data);
+                ++_events;
+            }
+            return _events;
+        }
+
+        /// The number of active handlers of TEvent.
+        template <class TEvent>
+        size_type subscriber_count() {
+            subscribers<TEvent>& _s = table<TEvent>();
+            size_type _n = 0;
+            for (size_type i = 0; i < _s.count; ++i) if (_s.active(i)) ++_n;
+            return _n;
+        }
+
+        size_type pending() const noexcept                      { return m_queue.size(); }
+
+    private:
+        template <class TEvent>
+        using subscribers = internal::event_subscribers<TEvent, TSubscribers>;
+
+        using record_type = internal::event_record<internal::event_max(sizeof(TEvents)...),
+                                                   internal::event_max(alignof(TEvents)...)>;
+    #if UTB_CONFIG_ENABLE_ATOMIC == UTB_YES
+        using queue_type = typename utb::select<TQueue == 0, internal::no_event_queue<record_type>,
+                                                basic_spsc_queue<record_type, (TQueue == 0 ? 2 : TQueue)> >::result;
+    #else
+        using queue_type = internal::no_event_queue<record_type>;
+    #endif
+        using publisher = size_type (*)(self_type&, const void*);
+        using unsubscriber = bool (*)(self_type&, size_type, uint16_t);
+
+        template <class TEvent>
+        subscribers<TEvent>& table()                            { return m_tables; }
+
+        template <class TEvent>
+        static size_type publish_erased(self_type& bus, const void* data) {
+            return bus.publish(*reinterpret_cast<const TEvent*>(data));
+        }
+
+        template <class TEvent>
+        static bool unsubscribe_erased(self_type& bus, size_type slot, uint16_t generation) {
+            subscribers<TEvent>& _s = bus.table<TEvent>();
+            if (slot >= _s.count || !_s.active(slot) || _s.generation[slot] != generation) return false;
+
+            ++_s.generation[slot];
+            // a running handler must not be destroyed, publish() purges it when it is done
+            _s.removed[slot] = true;
+            _s.dirty = true;
+            if (_s.depth == 0) purge(_s);
+            return true;
+        }
+
+        template <class TEvent>
+        static void purge(subscribers<TEvent>& s) {
+            for (size_type i = 0; i < s.count; ++i) {
+                if (!s.removed[i]) continue;
+                s.handlers[i] = handler_type<TEvent>();
+                s.removed[i] = false;
+            }
+            while (s.count > 0 && !s.handlers[s.count - 1]) --s.count;
+            s.dirty = false;
+        }
+
+        internal::event_tables<TSubscribers, TEvents...> m_tables;
+        queue_type m_queue;
+    };
+
+    template <class... TEvents>
+    using event_bus = basic_event_bus<4, (UTB_CONFIG_ENABLE_ATOMIC == UTB_YES ? 16 : 0), TEvents...>;
+}
+
+#endif // __UT_EVENT_BUS_H__
@@ -29,10 +29,10 @@ namespace utb {
             base_fastbit(const base_fastbit& b) { bit = b.bit; }
             
             base_fastbit& operator = (const base_fastbit& other) {
-                bit = other.bit; 
+                bit = other.bit; return *this;
             }
             base_fastbit& operator = (const bool& v) {
-                bit = v ? 1 : 0; 
+                bit = v ? 1 : 0; return *this;
             }
 
             bool operator == (const base_fastbit& other) {
@@ -50,6 +50,169 @@ namespace utb {
         };
     }
 
+
+    /**
+     * @brief Schatten-Kopie eines Registers für gebündelte Änderungen.
+     *
+     * Der Konstruktor liest das Register einmal, alle Bit- und Feldänderungen laufen danach auf
+     * der lokalen Kopie. commit() schreibt sie mit einem einzigen volatile Store zurück, und nur
+     * wenn sich etwas geändert hat. Der Destruktor ruft commit() auf, discard() verwirft die
+     * Änderungen.
+     *
+     * @code
+     * {
+     *     auto tx = utb::register_transaction<uint8_t>(portd_address);
+     *     tx.set(3).clear(4).write_field(0, 3, 5);
+     * }   // ein Store auf das Register
+     * @endcode
+     *
+     * @tparam TVALUE Basistyp des Registers (z.B. uint8_t, uint32_t).
+     */
+    template <typename TVALUE>
+    class register_transaction {
+    public:
+        using value_type = TVALUE;
+        using size_type = utb::size_t;
+        using self_type = register_transaction<TVALUE>;
+        using register_pointer = volatile TVALUE*;
+
+        /**
+         * @brief Liest das Register einmal in die Schatten-Kopie.
+         */
+        explicit register_transaction(register_pointer reg)
+            : m_pRegister(reg), m_vShadow(*reg), m_vOriginal(m_vShadow), m_bPending(true), m_bForce(false) { }
+
+        explicit register_transaction(uintptr_t address)
+            : register_transaction(reinterpret_cast<register_pointer>(address)) { }
+
+        /**
+         * @brief Für Register, die nicht gelesen werden dürfen oder sollen: startet mit initial statt einem Lesezugriff.
+         *
+         * Der Inhalt des Registers ist unbekannt, commit() schreibt daher immer.
+         */
+        register_transaction(register_pointer reg, value_type initial)
+            : m_pRegister(reg), m_vShadow(initial), m_vOriginal(initial), m_bPending(true), m_bForce(true) { }
+
+        register_transaction(self_type&& other)
+            : m_pRegister(other.m_pRegister), m_vShadow(other.m_vShadow),
+              m_vOriginal(other.m_vOriginal), m_bPending(other.m_bPending), m_bForce(other.m_bForce) {
+            other.m_bPending = false; }
+
+        register_transaction(const self_type&) = delete;
+        self_type& operator = (const self_type&) = delete;
+
+        ~register_transaction() { commit(); }
+
+        self_type& set(size_type pos)                       { m_vShadow |= bit_of(pos); return *this; }
+        self_type& clear(size_type pos)                     { m_vShadow &= value_type(~bit_of(pos)); return *this; }
+        self_type& flip(size_type pos)                      { m_vShadow ^= bit_of(pos); return *this; }
+        self_type& assign(size_type pos, bool v)            { return v ? set(pos) : clear(pos); }
+
+        self_type& set_mask(value_type mask)                { m_vShadow |= mask; return *this; }
+        self_type& clear_mask(value_type mask)              { m_vShadow &= value_type(~mask); return *this; }
+        self_type& modify(value_type clearMask, value_type setMask) {
+            m_vShadow = value_type((m_vShadow & ~clearMask) | setMask); return *this; }
+
+        /**
+         * @brief Schreibt v in das Feld mit width Bits ab Bit pos.
+         */
+        self_type& write_field(size_type pos, size_type width, value_type v) {
+            const value_type _mask = field_mask(width);
+            m_vShadow = value_type((m_vShadow & ~value_type(_mask << pos)) | value_type((v & _mask) << pos));
+            return *this;
+        }
+
+        value_type read_field(size_type pos, size_type width) const {
+            return value_type((m_vShadow >> pos) & field_mask(width));
+        }
+
+        bool get(size_type pos) const                       { return (m_vShadow & bit_of(pos)) != 0; }
+        value_type value() const                            { return m_vShadow; }
+
+        /**
+         * @brief Schreibt die Schatten-Kopie mit einem volatile Store zurück, falls sie sich geändert hat
+         * oder die Transaktion ohne Lesezugriff begonnen wurde.
+         * @return true, wenn geschrieben wurde.
+         */
+        bool commit() {
+            if (!m_bPending) return false;
+            m_bPending = false;
+
+            if (!m_bForce && m_vShadow == m_vOriginal) return false;
+            *m_pRegister = m_vShadow;
+            return true;
+        }
+
+        /**
+         * @brief Verwirft alle gesammelten Änderungen.
+         */
+        void discard()                                      { m_bPending = false; }
+
+    private:
+        static value_type bit_of(size_type pos)             { return value_type(value_type(1) << pos); }
+        static value_type field_mask(size_type width) {
+            return width >= sizeof(value_type) * 8 ? value_type(~value_type(0)) : value_type((value_type(1) << width) - 1);
+        }
+
+    private:
+        register_pointer m_pRegister;
+        value_type m_vShadow;
+        value_type m_vOriginal;
+        bool m_bPending;
+        bool m_bForce;
+    };
+
+    /**
+     * @brief Register-Paar mit Write-1-to-Set und Write-1-to-Clear Semantik (z.B. ESP32 GPIO_OUT_W1TS/W1TC).
+     *
+     * Jede Operation ist ein einziger Store ohne Lesezugriff und damit atomar gegenüber Interrupts.
+     */
+    template <typename TVALUE>
+    class set_clear_register {
+    public:
+        using value_type = TVALUE;
+        using register_pointer = volatile TVALUE*;
+
+        set_clear_register(uintptr_t setAddress, uintptr_t clearAddress)
+            : m_pSet(reinterpret_cast<register_pointer>(setAddress)),
+              m_pClear(reinterpret_cast<register_pointer>(clearAddress)) { }
+
+        void set(value_type mask) const                     { *m_pSet = mask; }
+        void clear(value_type mask) const                   { *m_pClear = mask; }
+
+        /**
+         * @brief Löscht clearMask und setzt setMask mit zwei Stores.
+         */
+        void modify(value_type clearMask, value_type setMask) const {
+            if (clearMask) *m_pClear = clearMask;
+            if (setMask) *m_pSet = setMask;
+        }
+
+    private:
+        register_pointer m_pSet;
+        register_pointer m_pClear;
+    };
+
+    /**
+     * @brief Toggle-Register: eine 1 kippt das Ausgangs-Bit (z.B. AVR PINx für PORTx).
+     *
+     * Auf AVR wird der Store auf ein I/O-Register im unteren Adressbereich zu einem einzigen
+     * sbi/out Befehl, ohne Read-Modify-Write.
+     */
+    template <typename TVALUE>
+    class toggle_register {
+    public:
+        using value_type = TVALUE;
+        using register_pointer = volatile TVALUE*;
+
+        explicit toggle_register(uintptr_t address)
+            : m_pToggle(reinterpret_cast<register_pointer>(address)) { }
+
+        void toggle(value_type mask) const                  { *m_pToggle = mask; }
+
+    private:
+        register_pointer m_pToggle;
+    };
     
     /**
      * @brief View für ein Register oder einen Wert als Ganzes und als Bit-Feld.
@@ -113,6 +276,37 @@ namespace utb {
             return *this;
         }
 
+        /**
+         * @brief Setzt alle Bits aus mask mit einem einzigen Read-Modify-Write.
+         */
+        void set_mask(value_type mask) {
+            volatile value_type* _reg = &value;
+            *_reg = value_type(*_reg | mask);
+        }
+
+        /**
+         * @brief Löscht alle Bits aus mask mit einem einzigen Read-Modify-Write.
+         */
+        void clear_mask(value_type mask) {
+            volatile value_type* _reg = &value;
+            *_reg = value_type(*_reg & ~mask);
+        }
+
+        /**
+         * @brief Löscht clearMask und setzt setMask in einem Lese- und einem Schreibzugriff.
+         */
+        void modify(value_type clearMask, value_type setMask) {
+            volatile value_type* _reg = &value;
+            *_reg = value_type((*_reg & ~clearMask) | setMask);
+        }
+
+        /**
+         * @brief Startet eine Transaktion auf einer lokalen Kopie des Registers, siehe register_transaction.
+         */
+        register_transaction<value_type> begin() {
+            return register_transaction<value_type>(&value);
+        }
+
         bit& get(const size_type p) {  return bits[p];  }
         bit& operator [] (const size_type p) {  return bits[p];  }
 
@@ -173,11 +367,6 @@ namespace utb {
             result.value &= rhs.value;
             return result;
         }
-        self_type& operator ~ () {
-            self_type result = self_type(*this);
-            result.value = ~result.value;
-            return result;
-        }
     };
     /**
      * @brief Alias für eine schnelle Adress-/Register-View.
@@ -0,0 +1,493 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_FASTMATH_H__
+#define __UT_FASTMATH_H__
+
+#include "utconfig.h"
+#include "utalgorithm.h"
+#include "utlimits.h"
+#include "utfixed.h"
+
+#include <math.h>
+#include <string.h>
+
+/**
+ * Approximations of sin, cos, atan, atan2, exp, log and sqrt by minimax polynomials after a range
+ * reduction, for float and for utb::fixed, plus batch forms over arrays.
+ *
+ * The float versions need only multiplications, additions and float/int conversions (atan and
+ * atan2 one division), so they are much faster than libm with a software FPU and branch free
+ * enough to be vectorized by the compiler in the batch forms. The fixed versions run the same
+ * polynomials in Q30 integer arithmetic; atan2 is a CORDIC vectoring without division. For double
+ * and every other type the functions fall back to the C library.
+ * @code
+ * float s, c;
+ * utb::math::fast_sincos(angle, s, c);                         // approx_precise
+ * float a = utb::math::fast_atan2<utb::math::approx_fast>(y, x);
+ *
+ * utb::fixed16_16 e = utb::math::fast_exp(utb::fixed16_16(1.5));
+ * utb::math::sin_n<utb::math::approx_full>(angles, out, 256);
+ * @endcode
+ */
+
+namespace utb {
+    namespace math {
+        /**
+         * @brief Precision policies of the fast functions.
+         *
+         * max_error bounds |approx - exact| / max(1, |exact|) of every float function: the absolute
+         * error of sin, cos and atan, the relative error of large results. The fixed versions add
+         * the resolution of their type.
+         */
+        /// About 11 bits: sin and cos of degree 3/4, atan 5, exp 3, log 4, one Newton step for sqrt.
+        struct approx_fast      { static constexpr float max_error = 2e-3f; };
+        /// About 17 bits: sin and cos of degree 5/6, atan 11, exp 4, log 6, two Newton steps for sqrt.
+        struct approx_precise   { static constexpr float max_error = 1e-5f; };
+        /// Float precision within a few ulp: sin and cos of degree 7/8, atan 15, exp 6, log 8, sqrtf().
+        struct approx_full      { static constexpr float max_error = 5e-7f; };
+
+        namespace internal {
+            /// Guess of 1/sqrt(x) from the float bits, about 3.4% relative error.
+            inline float rsqrt_guess(float x) noexcept {
+                uint32_t _bits;
+                memcpy(&_bits, &x, sizeof(_bits));
+                _bits = 0x5F375A86u - (_bits >> 1);
+                memcpy(&x, &_bits, sizeof(x));
+                return x;
+            }
+
+            /// One Newton step of the guess y of 1/sqrt(x), squares the relative error.
+            inline float rsqrt_newton(float x, float y) noexcept { return y * (1.5f - 0.5f * x * y * y); }
+
+            inline float float_from_bits(uint32_t bits) noexcept {
+                float _f;
+                memcpy(&_f, &bits, sizeof(_f));
+                return _f;
+            }
+            inline uint32_t float_to_bits(float f) noexcept {
+                uint32_t _bits;
+                memcpy(&_bits, &f, sizeof(_bits));
+                return _bits;
+            }
+
+            /// All bits set for true.
+            inline uint32_t mask_of(bool b) noexcept         { return uint32_t(0) - uint32_t(b); }
+            /// a where mask is set, b elsewhere.
+            inline float select(uint32_t mask, float a, float b) noexcept {
+                return float_from_bits((float_to_bits(a) & mask) | (float_to_bits(b) & ~mask));
+            }
+            /// v with the sign flipped where sign (0 or 0x80000000) is set.
+            inline float flip_sign(float v, uint32_t sign) noexcept { return float_from_bits(float_to_bits(v) ^ sign); }
+
+            /// round(v) for |v| < 2^31: adds 0.5 with the sign of v.
+            inline int32_t round_to_int(float v) noexcept {
+                return int32_t(v + float_from_bits(0x3F000000u | (float_to_bits(v) & 0x80000000u)));
+            }
+
+            /// c0 + z * (c1 + z * (c2 + ...)).
+            inline float horner(float, float c0) noexcept   { return c0; }
+            template <typename... TCoeffs>
+            inline float horner(float z, float c0, TCoeffs... cs) noexcept { return c0 + z * horner(z, cs...); }
+
+            /// As horner(), z and the coefficients in Q30.
+            inline int32_t mul_q30(int32_t a, int32_t b) noexcept {
+                return int32_t((int64_t(a) * b + (int64_t(1) << 29)) >> 30);
+            }
+            inline int32_t horner_q30(int32_t, int32_t c0) noexcept { return c0; }
+            template <typename... TCoeffs>
+            inline int32_t horner_q30(int32_t z, int32_t c0, TCoeffs... cs) noexcept {
+                return c0 + mul_q30(z, horner_q30(z, cs...));
+            }
+
+            // The coefficients, fitted on the reduced ranges: sin(r) = r + r z P(z) and
+            // cos(r) = 1 + z P(z) with z = r^2, |r| <= pi/4; atan(t) = t P(t^2), 0 <= t <= 1;
+            // exp(r) = 1 + r P(r), |r| <= ln2/2; log(1 + t) = t P(t), sqrt(1/2) - 1 <= t < sqrt(2) - 1.
+            inline float sin_poly(float z, approx_fast) noexcept    { return horner(z, -0.162259128f); }
+            inline float sin_poly(float z, approx_precise) noexcept { return horner(z, -0.166628337f, 0.00815299093f); }
+            inline float sin_poly(float z, approx_full) noexcept    { return horner(z, -0.166666507f, 0.00833197865f, -0.000194956347f); }
+
+            inline float cos_poly(float z, approx_fast) noexcept    { return horner(z, -0.499776303f, 0.0404889243f); }
+            inline float cos_poly(float z, approx_precise) noexcept { return horner(z, -0.499998948f, 0.0416562945f, -0.00135978216f); }
+            inline float cos_poly(float z, approx_full) noexcept    { return horner(z, -0.499999997f, 0.0416666233f, -0.00138867638f, 2.43904493e-05f); }
+
+            inline float atan_poly(float z, approx_fast) noexcept   { return horner(z, 0.99535788f, -0.288689815f, 0.0793386035f); }
+            inline float atan_poly(float z, approx_precise) noexcept {
+                return horner(z, 0.999977219f, -0.332622823f, 0.193540343f, -0.116426395f, 0.0526472535f, -0.011719096f);
+            }
+            inline float atan_poly(float z, approx_full) noexcept {
+                return horner(z, 0.999999336f, -0.333298608f, 0.199465654f, -0.139086282f, 0.0964219378f,
+                              -0.0559122757f, 0.0218629207f, -0.00405455649f);
+            }
+
+            inline float exp_poly(float r, approx_fast) noexcept    { return horner(r, 1.00019585f, 0.504130482f, 0.165179818f); }
+            inline float exp_poly(float r, approx_precise) noexcept { return horner(r, 0.999966836f, 0.500030136f, 0.167874751f, 0.0415138572f); }
+            inline float exp_poly(float r, approx_full) noexcept {
+                return horner(r, 1.00000003f, 0.499999942f, 0.166664313f, 0.041668002f, 0.0083741556f, 0.00138436547f);
+            }
+
+            inline float log_poly(float t, approx_fast) noexcept    { return horner(t, 0.999352307f, -0.502465303f, 0.358710616f, -0.22848221f); }
+            inline float log_poly(float t, approx_precise) noexcept {
+                return horner(t, 1.00001278f, -0.499850512f, 0.332258707f, -0.25472467f, 0.223300927f, -0.143198655f);
+            }
+            inline float log_poly(float t, approx_full) noexcept {
+                return horner(t, 0.999999814f, -0.500006674f, 0.333361821f, -0.249593435f, 0.198730447f,
+                              -0.173334678f, 0.164200042f, -0.101022466f);
+            }
+
+            inline int32_t sin_poly(int32_t z, approx_fast) noexcept    { return horner_q30(z, -174224412); }
+            inline int32_t sin_poly(int32_t z, approx_precise) noexcept { return horner_q30(z, -178915815, 8754207); }
+            inline int32_t sin_poly(int32_t z, approx_full) noexcept    { return horner_q30(z, -178956799, 8946394, -209333); }
+
+            inline int32_t cos_poly(int32_t z, approx_fast) noexcept    { return horner_q30(z, -536630719, 43474651); }
+            inline int32_t cos_poly(int32_t z, approx_precise) noexcept { return horner_q30(z, -536869782, 44728106, -1460055); }
+            inline int32_t cos_poly(int32_t z, approx_full) noexcept    { return horner_q30(z, -536870909, 44739196, -1491080, 26189); }
+
+            inline int32_t exp_poly(int32_t r, approx_fast) noexcept    { return horner_q30(r, 1073952112, 541305984, 177360479); }
+            inline int32_t exp_poly(int32_t r, approx_precise) noexcept { return horner_q30(r, 1073706214, 536903271, 180254141, 44575165); }
+            inline int32_t exp_poly(int32_t r, approx_full) noexcept {
+                return horner_q30(r, 1073741859, 536870850, 178954443, 44740677, 8991681, 1486451);
+            }
+
+            inline int32_t log_poly(int32_t t, approx_fast) noexcept    { return horner_q30(t, 1073046369, -539518011, 385162591, -245330905); }
+            inline int32_t log_poly(int32_t t, approx_precise) noexcept {
+                return horner_q30(t, 1073755549, -536710401, 356760070, -273508531, 239767545, -153758385);
+            }
+            inline int32_t log_poly(int32_t t, approx_full) noexcept {
+                return horner_q30(t, 1073741624, -536878078, 357944530, -267998910, 213385192, -186116693, 176308453, -108472047);
+            }
+
+            /// CORDIC iterations of fast_atan2() for fixed.
+            constexpr utb::size_t cordic_steps(approx_fast) noexcept    { return 12; }
+            constexpr utb::size_t cordic_steps(approx_precise) noexcept { return 18; }
+            constexpr utb::size_t cordic_steps(approx_full) noexcept    { return 28; }
+
+            inline float sqrt_approx(float x, approx_fast) noexcept    { return x * rsqrt_newton(x, rsqrt_guess(x)); }
+            inline float sqrt_approx(float x, approx_precise) noexcept { return x * rsqrt_newton(x, rsqrt_newton(x, rsqrt_guess(x))); }
+            inline float sqrt_approx(float x, approx_full) noexcept    { return ::sqrtf(x); }
+
+            /// x - k pi/2 with pi/2 in three parts (Cody-Waite), the first one exact for k * part.
+            template <class TPolicy>
+            inline float reduce_half_pi(float x, float k, TPolicy) noexcept {
+                return ((x - k * 1.5703125f) - k * 4.83870506e-4f) + k * 4.37113883e-8f;
+            }
+            /// As above in four parts, the first three of 8 bits, so k * part is exact for |k| < 2^16.
+            inline float reduce_half_pi(float x, float k, approx_full) noexcept {
+                return (((x - k * 1.5703125f) - k * 4.84466553e-4f) + k * 6.40749931e-7f) - k * 9.92093580e-10f;
+            }
+
+            /// The raw value of a fixed with TFrac fraction bits in Q30, and back with rounding.
+            template <utb::size_t TFrac>
+            inline int64_t raw_to_q30(int64_t raw) noexcept {
+                return TFrac <= 30 ? raw * (int64_t(1) << (TFrac <= 30 ? 30 - TFrac : 0)) : raw >> (TFrac > 30 ? TFrac - 30 : 0);
+            }
+            template <utb::size_t TFrac>
+            inline int64_t q30_to_raw(int64_t q30) noexcept {
+                return TFrac < 30 ? (q30 + (int64_t(1) << (TFrac < 30 ? 29 - TFrac : 0))) >> (TFrac < 30 ? 30 - TFrac : 0)
+                                  : q30 * (int64_t(1) << (TFrac >= 30 ? TFrac - 30 : 0));
+            }
+        }
+
+        // -------------------------------------------------------------------------------- float
+
+        // The float functions compare, take signs and select on the bits: integer operations are
+        // cheap without an FPU and, unlike float compares under the default -ftrapping-math, do
+        // not keep the compiler from vectorizing the batch loops.
+
+        /**
+         * @brief sin and cos of x (radians) with one range reduction; accurate for |x| < 10^5.
+         *
+         * approx_full reduces with pi/2 in four parts, the three parts of the others lose up to
+         * 2e-6 near 10^5, which is within their bound but not within 5e-7.
+         */
+        template <class TPolicy = approx_precise>
+        inline void fast_sincos(float x, float& s, float& c) noexcept {
+            // x = k pi/2 + r
+            const int32_t _q = internal::round_to_int(x * 0.636619772f);
+            const float _k = float(_q);
+            const float _r = internal::reduce_half_pi(x, _k, TPolicy());
+            const float _z = _r * _r;
+
+            const float _sin = _r + _r * _z * internal::sin_poly(_z, TPolicy());
+            const float _cos = 1.0f + _z * internal::cos_poly(_z, TPolicy());
+
+            // quadrant: swap for odd k, sin negative for k = 2, 3, cos for k = 1, 2 (mod 4)
+            const uint32_t _swap = internal::mask_of((_q & 1) != 0);
+            s = internal::flip_sign(internal::select(_swap, _cos, _sin), uint32_t(_q & 2) << 30);
+            c = internal::flip_sign(internal::select(_swap, _sin, _cos), uint32_t((_q + 1) & 2) << 30);
+        }
+
+        template <class TPolicy = approx_precise>
+        inline float fast_sin(float x) noexcept {
+            float _s, _c;
+            fast_sincos<TPolicy>(x, _s, _c);
+            return _s;
+        }
+
+        template <class TPolicy = approx_precise>
+        inline float fast_cos(float x) noexcept {
+            float _s, _c;
+            fast_sincos<TPolicy>(x, _s, _c);
+            return _c;
+        }
+
+        template <class TPolicy = approx_precise>
+        inline float fast_atan(float x) noexcept {
+            const uint32_t _abs = internal::float_to_bits(x) & 0x7FFFFFFFu;
+            const uint32_t _invert = internal::mask_of(_abs > 0x3F800000u);       // |x| > 1
+            const float _ax = internal::float_from_bits(_abs);
+            const float _t = internal::select(_invert, 1.0f / _ax, _ax);
+
+            const float _a = _t * internal::atan_poly(_t * _t, TPolicy());
+            return internal::flip_sign(internal::select(_invert, 1.57079633f - _a, _a), internal::float_to_bits(x) & 0x80000000u);
+        }
+
+        /**
+         * @brief The angle of (x, y) in [-pi, pi], 0 for (0, 0).
+         */
+        template <class TPolicy = approx_precise>
+        inline float fast_atan2(float y, float x) noexcept {
+            const uint32_t _bx = internal::float_to_bits(x), _by = internal::float_to_bits(y);
+            const uint32_t _ax = _bx & 0x7FFFFFFFu, _ay = _by & 0x7FFFFFFFu;
+            const uint32_t _steep = internal::mask_of(_ay > _ax);
+            const uint32_t _max = (_ay & _steep) | (_ax & ~_steep), _min = (_ax & _steep) | (_ay & ~_steep);
+
+            // t = min / max in [0, 1], max = 0 divides by 1
+            const uint32_t _div = _max | (internal::mask_of(_max == 0) & 0x3F800000u);
+            const float _t = internal::float_from_bits(_min) / internal::float_from_bits(_div);
+
+            float _a = _t * internal::atan_poly(_t * _t, TPolicy());
+            _a = internal::select(_steep, 1.57079633f - _a, _a);
+            _a = internal::select(internal::mask_of((_bx >> 31) != 0), 3.14159265f - _a, _a);
+            return internal::flip_sign(_a, _by & 0x80000000u);
+        }
+
+        /**
+         * @brief e^x, x is clamped to [-88, 88].
+         */
+        template <class TPolicy = approx_precise>
+        inline float fast_exp(float x) noexcept {
+            // |x| <= 88 on the bits, so 2^k stays in the float range
+            const uint32_t _bits = internal::float_to_bits(x), _abs = _bits & 0x7FFFFFFFu;
+            x = internal::float_from_bits((_abs < 0x42B00000u ? _abs : 0x42B00000u) | (_bits & 0x80000000u));
+
+            // x = k ln2 + r, 2^k from the exponent bits
+            const int32_t _q = internal::round_to_int(x * 1.44269504f);
+            const float _k = float(_q);
+            const float _r = (x - _k * 0.693359375f) + _k * 2.12194440e-4f;
+
+            const float _p = 1.0f + _r * internal::exp_poly(_r, TPolicy());
+            return _p * internal::float_from_bits(uint32_t(_q + 127) << 23);
+        }
+
+        /**
+         * @brief The natural logarithm of a normal float, -infinity for x <= 0.
+         */
+        template <class TPolicy = approx_precise>
+        inline float fast_log(float x) noexcept {
+            // x = m 2^e with m in [sqrt(1/2), sqrt(2)): the mantissas above sqrt(2) take the next exponent
+            const uint32_t _bits = internal::float_to_bits(x);
+            const uint32_t _high = internal::mask_of((_bits & 0x007FFFFFu) > 0x003504F3u);
+            const int32_t _e = int32_t(_bits >> 23) - 127 + int32_t(_high & 1u);
+            const float _m = internal::float_from_bits((_bits & 0x007FFFFFu) | (0x3F800000u - (_high & 0x00800000u)));
+
+            const float _t = _m - 1.0f, _fe = float(_e);
+            const float _log = _fe * 0.693359375f + (_t * internal::log_poly(_t, TPolicy()) - _fe * 2.12194440e-4f);
+            return internal::select(internal::mask_of(int32_t(_bits) > 0), _log, -utb::numeric_limits<float>::infinity());
+        }
+
+        /**
+         * @brief The square root of x >= 0; approx_full is sqrtf(), the others Newton steps from the bits.
+         */
+        template <class TPolicy = approx_precise>
+        inline float fast_sqrt(float x) noexcept        { return internal::sqrt_approx(x, TPolicy()); }
+
+        // -------------------------------------------------------------------------------- fixed
+
+        /**
+         * @brief sin and cos of a fixed angle (radians), Q30 polynomials instead of the CORDIC of sincos().
+         */
+        template <class TPolicy = approx_precise, utb::size_t I, utb::size_t F, class O, class R>
+        inline void fast_sincos(fixed<I, F, O, R> x, fixed<I, F, O, R>& s, fixed<I, F, O, R>& c) noexcept {
+            using fixed_type = fixed<I, F, O, R>;
+
+            // k = round(x 2/pi), r = x - k pi/2 in Q30
+            const int64_t _k = (int64_t(x.raw()) * 683565276 + (int64_t(1) << (F + 29))) >> (F + 30);
+            const int32_t _r = int32_t(internal::raw_to_q30<F>(x.raw()) - _k * 1686629713);
+            const int32_t _z = internal::mul_q30(_r, _r);
+
+            const int32_t _sin = _r + internal::mul_q30(internal::mul_q30(_r, _z), internal::sin_poly(_z, TPolicy()));
+            const int32_t _cos = (int32_t(1) << 30) + internal::mul_q30(_z, internal::cos_poly(_z, TPolicy()));
+
+            const bool _swap = (_k & 1) != 0;
+            int64_t _s = _swap ? _cos : _sin, _c = _swap ? _sin : _cos;
+            if (_k & 2) _s = -_s;
+            if ((_k + 1) & 2) _c = -_c;
+            s = fixed_type::from_raw(fixed_type::narrow(internal::q30_to_raw<F>(_s)));
+            c = fixed_type::from_raw(fixed_type::narrow(internal::q30_to_raw<F>(_c)));
+        }
+
+        template <class TPolicy = approx_precise, utb::size_t I, utb::size_t F, class O, class R>
+        inline fixed<I, F, O, R> fast_sin(fixed<I, F, O, R> x) noexcept {
+            fixed<I, F, O, R> _s, _c;
+            fast_sincos<TPolicy>(x, _s, _c);
+            return _s;
+        }
+
+        template <class TPolicy = approx_precise, utb::size_t I, utb::size_t F, class O, class R>
+        inline fixed<I, F, O, R> fast_cos(fixed<I, F, O, R> x) noexcept {
+            fixed<I, F, O, R> _s, _c;
+            fast_sincos<TPolicy>(x, _s, _c);
+            return _c;
+        }
+
+        /**
+         * @brief The angle of (x, y) in [-pi, pi] by CORDIC vectoring: shifts and adds, no division.
+         */
+        template <class TPolicy = approx_precise, utb::size_t I, utb::size_t F, class O, class R>
+        inline fixed<I, F, O, R> fast_atan2(fixed<I, F, O, R> y, fixed<I, F, O, R> x) noexcept {
+            using fixed_type = fixed<I, F, O, R>;
+            using fixed_point::internal::cordic_atan;
+            using fixed_point::internal::cordic_pi;
+
+            int64_t _x = x.raw(), _y = y.raw();
+            if (_x == 0 && _y == 0) return fixed_type::from_raw(0);
+
+            // rotate into the right half plane
+            int32_t _z = 0;
+            if (_x < 0) { _z = _y < 0 ? -cordic_pi : cordic_pi; _x = -_x; _y = -_y; }
+
+            // scale to 28 bits: the length (up to sqrt(2) max) times the CORDIC gain (1.65) stays below 2^31
+            const int64_t _max = _x > (_y < 0 ? -_y : _y) ? _x : (_y < 0 ? -_y : _y);
+            const int _shift = 28 - int(utb::nlz(uint64_t(_max)));
+            int32_t _cx = int32_t(_shift >= 0 ? _x * (int64_t(1) << _shift) : _x >> -_shift);
+            int32_t _cy = int32_t(_shift >= 0 ? _y * (int64_t(1) << _shift) : _y >> -_shift);
+
+            for (utb::size_t i = 0; i < internal::cordic_steps(TPolicy()); ++i) {
+                const int32_t _dx = _cy >> i, _dy = _cx >> i;
+                if (_cy > 0) { _cx += _dx; _cy -= _dy; _z += cordic_atan[i]; }
+                else         { _cx -= _dx; _cy += _dy; _z -= cordic_atan[i]; }
+            }
+            // Q29 to the raw value
+            return fixed_type::from_raw(fixed_type::narrow(internal::q30_to_raw<F>(int64_t(_z) * 2)));
+        }
+
+        template <class TPolicy = approx_precise, utb::size_t I, utb::size_t F, class O, class R>
+        inline fixed<I, F, O, R> fast_atan(fixed<I, F, O, R> x) noexcept {
+            return fast_atan2<TPolicy>(x, fixed<I, F, O, R>(1));
+        }
+
+        /**
+         * @brief e^x, saturated or wrapped to the range of the fixed type.
+         */
+        template <class TPolicy = approx_precise, utb::size_t I, utb::size_t F, class O, class R>
+        inline fixed<I, F, O, R> fast_exp(fixed<I, F, O, R> x) noexcept {
+            using fixed_type = fixed<I, F, O, R>;
+
+            // k = round(x / ln2), r = x - k ln2 in Q30
+            const int64_t _k = (int64_t(x.raw()) * 1549082005 + (int64_t(1) << (F + 29))) >> (F + 30);
+            const int32_t _r = int32_t(internal::raw_to_q30<F>(x.raw()) - _k * 744261118);
+            const int64_t _p = (int64_t(1) << 30) + internal::mul_q30(_r, internal::exp_poly(_r, TPolicy()));
+
+            // p 2^k from Q30 to the raw value
+            const int64_t _shift = _k + int64_t(F) - 30;
+            if (_shift >= 32) return fixed_type::from_raw(fixed_type::narrow(INT64_MAX));
+            if (_shift >= 0) return fixed_type::from_raw(fixed_type::narrow(_p << _shift));
+            if (_shift < -62) return fixed_type::from_raw(0);
+            return fixed_type::from_raw(fixed_type::narrow((_p + (int64_t(1) << (-_shift - 1))) >> -_shift));
+        }
+
+        /**
+         * @brief The natural logarithm, lowest() for x <= 0.
+         */
+        template <class TPolicy = approx_precise, utb::size_t I, utb::size_t F, class O, class R>
+        inline fixed<I, F, O, R> fast_log(fixed<I, F, O, R> x) noexcept {
+            using fixed_type = fixed<I, F, O, R>;
+            if (x.raw() <= 0) return fixed_type::from_raw(fixed_type::raw_min);
+
+            // x = m 2^e with m in [sqrt(1/2), sqrt(2)) in Q30
+            const int _msb = int(utb::nlz(uint64_t(x.raw())));
+            int64_t _e = int64_t(_msb) - int64_t(F);
+            int64_t _m = _msb <= 30 ? int64_t(x.raw()) << (30 - _msb) : int64_t(x.raw()) >> (_msb - 30);
+            if (_m > 1518500250) { _m >>= 1; ++_e; }
+
+            const int32_t _t = int32_t(_m - (int64_t(1) << 30));
+            const int64_t _log = _e * 744261118 + internal::mul_q30(_t, internal::log_poly(_t, TPolicy()));
+            return fixed_type::from_raw(fixed_type::narrow(internal::q30_to_raw<F>(_log)));
+        }
+
+        /**
+         * @brief The square root of the fixed type, exact to the last bit for every policy.
+         */
+        template <class TPolicy = approx_precise, utb::size_t I, utb::size_t F, class O, class R>
+        inline fixed<I, F, O, R> fast_sqrt(fixed<I, F, O, R> x) noexcept  { return fixed_point::sqrt(x); }
+
+        // ------------------------------------------------------------------ double and others
+
+        /// The C library for double and every other type.
+        template <class TPolicy = approx_precise, typename T>
+        inline void fast_sincos(T x, T& s, T& c) noexcept   { s = T(::sin(double(x))); c = T(::cos(double(x))); }
+        template <class TPolicy = approx_precise, typename T>
+        inline T fast_sin(T x) noexcept                     { return T(::sin(double(x))); }
+        template <class TPolicy = approx_precise, typename T>
+        inline T fast_cos(T x) noexcept                     { return T(::cos(double(x))); }
+        template <class TPolicy = approx_precise, typename T>
+        inline T fast_atan(T x) noexcept                    { return T(::atan(double(x))); }
+        template <class TPolicy = approx_precise, typename T>
+        inline T fast_atan2(T y, T x) noexcept              { return T(::atan2(double(y), double(x))); }
+        template <class TPolicy = approx_precise, typename T>
+        inline T fast_exp(T x) noexcept                     { return T(::exp(double(x))); }
+        template <class TPolicy = approx_precise, typename T>
+        inline T fast_log(T x) noexcept                     { return T(::log(double(x))); }
+        template <class TPolicy = approx_precise, typename T>
+        inline T fast_sqrt(T x) noexcept                    { return T(::sqrt(double(x))); }
+
+        // -------------------------------------------------------------------------------- batch
+
+        /**
+         * @brief out[i] = fast_sin(x[i]) for n values; the float loops are branch free, so
+         * -O3 vectorizes them. In-place (out == x) is allowed for all batch functions.
+         */
+        template <class TPolicy = approx_precise, typename T>
+        inline void sin_n(const T* x, T* out, utb::size_t n) noexcept {
+            for (utb::size_t i = 0; i < n; ++i) out[i] = fast_sin<TPolicy>(x[i]);
+        }
+
+        template <class TPolicy = approx_precise, typename T>
+        inline void cos_n(const T* x, T* out, utb::size_t n) noexcept {
+            for (utb::size_t i = 0; i < n; ++i) out[i] = fast_cos<TPolicy>(x[i]);
+        }
+
+        template <class TPolicy = approx_precise, typename T>
+        inline void sincos_n(const T* x, T* s, T* c, utb::size_t n) noexcept {
+            for (utb::size_t i = 0; i < n; ++i) fast_sincos<TPolicy>(x[i], s[i], c[i]);
+        }
+
+        template <class TPolicy = approx_precise, typename T>
+        inline void atan2_n(const T* y, const T* x, T* out, utb::size_t n) noexcept {
+            for (utb::size_t i = 0; i < n; ++i) out[i] = fast_atan2<TPolicy>(y[i], x[i]);
+        }
+
+        template <class TPolicy = approx_precise, typename T>
+        inline void exp_n(const T* x, T* out, utb::size_t n) noexcept {
+            for (utb::size_t i = 0; i < n; ++i) out[i] = fast_exp<TPolicy>(x[i]);
+        }
+
+        template <class TPolicy = approx_precise, typename T>
+        inline void log_n(const T* x, T* out, utb::size_t n) noexcept {
+            for (utb::size_t i = 0; i < n; ++i) out[i] = fast_log<TPolicy>(x[i]);
+        }
+
+        template <class TPolicy = approx_precise, typename T>
+        inline void sqrt_n(const T* x, T* out, utb::size_t n) noexcept {
+            for (utb::size_t i = 0; i < n; ++i) out[i] = fast_sqrt<TPolicy>(x[i]);
+        }
+    }
+}
+
+#endif // __UT_FASTMATH_H__
@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_FIXED_H__
+#define __UT_FIXED_H__
+
+#include "utconfig.h"
+#include "uttypes.h"
+#include "uttypetraits.h"
+#include "utfunctional.h"
+#include "utlimits.h"
+
+/**
+ * The fixed-point number utb::fixed and its functions. They live in utb::fixed_point so that
+ * sqrt(), sin(), cos(), abs() and floor() are found by argument-dependent lookup from the generic
+ * math templates (vector2/3/4, quaternion, rectangle, basic_color) and do not collide with the
+ * compile-time utb::sqrt. Call them unqualified or as utb::fixed_point::sqrt(); after
+ * `using namespace utb;` the name sqrt alone refers to the class template utb::sqrt.
+ */
+
+namespace utb {
+    namespace fixed_point {
+
+        /// Overflow policy: results outside the range are clamped to max() / lowest().
+        struct fixed_saturate { };
+        /// Overflow policy: results outside the range wrap around, like int.
+        struct fixed_wrap { };
+        /// Rounding policy: products, quotients and conversions round to the nearest value.
+        struct fixed_round_nearest { };
+        /// Rounding policy: the dropped bits are cut off (products round down, quotients toward zero).
+        struct fixed_truncate { };
+
+        namespace internal {
+            template <utb::size_t TBits> struct fixed_storage;
+            template <> struct fixed_storage<8>  { using raw_type = int8_t;  using wide_type = int16_t; };
+            template <> struct fixed_storage<16> { using raw_type = int16_t; using wide_type = int32_t; };
+            template <> struct fixed_storage<32> { using raw_type = int32_t; using wide_type = int64_t; };
+
+            /// atan(2^-i) in Q29, the rotation angles of cordic_sincos().
+            static constexpr int32_t cordic_atan[] = {
+                421657428, 248918915, 131521918, 66762579, 33510843, 16771758, 8387925, 4194219,
+                2097141, 1048575, 524288, 262144, 131072, 65536, 32768, 16384, 8192, 4096, 2048,
+                1024, 512, 256, 128, 64, 32, 16, 8, 4, 2
+            };
+            constexpr int32_t cordic_gain = 326016437;          // 0.60725..., 1 / the CORDIC gain, Q29
+            constexpr int32_t cordic_half_pi = 843314857;       // pi / 2, Q29
+            constexpr int32_t cordic_pi = 1686629713;           // pi, Q29
+
+            /**
+             * @brief sin and cos of z (Q29, in [-pi, pi]) by iterations CORDIC rotations, Q29.
+             */
+            inline void cordic_sincos(int32_t z, utb::size_t iterations, int32_t& s, int32_t& c) {
+                bool _negate = false;
+                if (z > cordic_half_pi)       { z = cordic_pi - z;  _negate = true; }
+                else if (z < -cordic_half_pi) { z = -cordic_pi - z; _negate = true; }
+
+                int32_t _x = cordic_gain, _y = 0;
+                for (utb::size_t i = 0; i < iterations; ++i) {
+                    const int32_t _dx = _y >> i, _dy = _x >> i;
+                    if (z >= 0) { _x -= _dx; _y += _dy; z -= cordic_atan[i]; }
+                    else        { _x += _dx; _y -= _dy; z += cordic_atan[i]; }
+                }
+                s = _y;
+                c = _negate ? -_x : _x;
+            }
+        }
+
+        /**
+         * @brief Signed binary fixed-point number with TIntBits integer bits (including the sign) and
+         * TFracBits fraction bits in an 8, 16 or 32 bit integer.
+         *
+         * Add and subtract are integer operations, multiply uses the double-width integer, divide
+         * and sqrt() use only shifts, subtractions and one integer division of the raw width (no
+         * 64 bit division on 32 bit targets), sin() and cos() are CORDIC rotations. Conversions from
+         * float and double are constexpr, so literals cost nothing at run time on targets without
+         * an FPU. The type is trivial, so it can be a member of the unions in vector3 and friends.
+         * @code
+         * using real = utb::fixed16_16;
+         *
+         * utb::math::vector3<real> v(real(0.5), real(-1.25), real(2));
+         * real l = utb::math::lenght(v);                 // sqrt() of utb::fixed_point
+         * real s = sin(real(0.5)) * 3;                   // multiply by int: no rounding
+         * int16_t raw = utb::fixed<8, 8>(1.5).raw();     // 384
+         * @endcode
+         *
+         * @tparam TIntBits The integer bits, the sign included; TIntBits + TFracBits is 8, 16 or 32.
+         * @tparam TFracBits The fraction bits, the resolution is 2^-TFracBits.
+         * @tparam TOverflow fixed_saturate or fixed_wrap.
+         * @tparam TRounding fixed_round_nearest or fixed_truncate.
+         */
+        template <utb::size_t TIntBits, utb::size_t TFracBits,
+                  class TOverflow = fixed_saturate, class TRounding = fixed_round_nearest>
+        class fixed {
+            static_assert(TIntBits > 0, "The sign needs one integer bit.");
+            static_assert(TIntBits + TFracBits == 8 || TIntBits + TFracBits == 16 || TIntBits + TFracBits == 32,
+                          "A fixed-point number has 8, 16 or 32 bits.");
+            static_assert(utb::is_same<TOverflow, fixed_saturate>::value || utb::is_same<TOverflow, fixed_wrap>::value,
+                          "Unknown overflow policy.");
+            static_assert(utb::is_same<TRounding, fixed_round_nearest>::value || utb::is_same<TRounding, fixed_truncate>::value,
+                          "Unknown rounding policy.");
+
+            using storage = internal::fixed_storage<TIntBits + TFracBits>;
+            struct raw_tag { };
+        public:
+            using raw_type = typename storage::raw_type;
+            using wide_type = typename storage::wide_type;
+            using self_type = fixed<TIntBits, TFracBits, TOverflow, TRounding>;
+
+            static constexpr utb::size_t integer_bits = TIntBits;
+            static constexpr utb::size_t fraction_bits = TFracBits;
+            static constexpr bool saturating = utb::is_same<TOverflow, fixed_saturate>::value;
+            static constexpr bool rounding = utb::is_same<TRounding, fixed_round_nearest>::value;
+
+            static constexpr raw_type raw_max = utb::numeric_limits<raw_type>::max();
+            static constexpr raw_type raw_min = utb::numeric_limits<raw_type>::min();
+            /// 1.0 as wide raw value.
+            static constexpr wide_type one = wide_type(1) << TFracBits;
+
+            fixed() = default;
+
+            /// From an integer, saturated or wrapped to the range.
+            template <typename TInt, utb::enable_if_t<utb::is_integral<TInt>::value, int> = 0>
+            constexpr fixed(TInt v) noexcept : m_iRaw(from_int(int64_t(v))) { }
+
+            /// From float or double, rounded by TRounding; at compile time for constant arguments.
+            template <typename TFloat, utb::enable_if_t<utb::is_floating_point<TFloat>::value, int> = 0>
+            constexpr fixed(TFloat v) noexcept : m_iRaw(from_real(v * TFloat(one))) { }
+
+            static constexpr self_type from_raw(raw_type raw) noexcept  { return self_type(raw_tag(), raw); }
+
+            constexpr raw_type raw() const noexcept                     { return m_iRaw; }
+
+            /// To float or double, or to an integer (toward zero, like a float).
+            template <typename T>
+            explicit constexpr operator T() const noexcept {
+                return convert<T>(utb::integral_constant<bool, utb::is_floating_point<T>::value>());
+            }
+            explicit constexpr operator bool() const noexcept           { return m_iRaw != 0; }
+
+            constexpr self_type operator + () const noexcept            { return *this; }
+            constexpr self_type operator - () const noexcept            { return from_raw(narrow(-wide_type(m_iRaw))); }
+
+            template <class TOther>
+            self_type& operator += (const TOther& b) noexcept           { return *this = *this + b; }
+            template <class TOther>
+            self_type& operator -= (const TOther& b) noexcept           { return *this = *this - b; }
+            template <class TOther>
+            self_type& operator *= (const TOther& b) noexcept           { return *this = *this * b; }
+            template <class TOther>
+            self_type& operator /= (const TOther& b) noexcept           { return *this = *this / b; }
+
+            friend constexpr self_type operator + (self_type a, self_type b) noexcept {
+                return from_raw(narrow(wide_type(a.m_iRaw) + b.m_iRaw));
+            }
+            friend constexpr self_type operator - (self_type a, self_type b) noexcept {
+                return from_raw(narrow(wide_type(a.m_iRaw) - b.m_iRaw));
+            }
+            friend self_type operator * (self_type a, self_type b) noexcept {
+                wide_type _p = wide_type(a.m_iRaw) * b.m_iRaw;
+                if (rounding && TFracBits > 0) _p += wide_type(1) << (TFracBits > 0 ? TFracBits - 1 : 0);
+                return from_raw(narrow(_p >> TFracBits));
+            }
+            friend self_type operator / (self_type a, self_type b) noexcept {
+                return from_raw(divide(a.m_iRaw, b.m_iRaw));
+            }
+
+            /// Multiply by an integer: exact up to the overflow.
+            template <typename TInt, utb::enable_if_t<utb::is_integral<TInt>::value, int> = 0>
+            friend self_type operator * (self_type a, TInt n) noexcept  { return from_raw(narrow(int64_t(a.m_iRaw) * int64_t(n))); }
+            template <typename TInt, utb::enable_if_t<utb::is_integral<TInt>::value, int> = 0>
+            friend self_type operator * (TInt n, self_type a) noexcept  { return from_raw(narrow(int64_t(a.m_iRaw) * int64_t(n))); }
+            /// Divide by an integer without the fraction shift.
+            template <typename TInt, utb::enable_if_t<utb::is_integral<TInt>::value, int> = 0>
+            friend self_type operator / (self_type a, TInt n) noexcept {
+                if (n == 0) return from_raw(a.m_iRaw < 0 ? raw_min : raw_max);
+                const int64_t _n = int64_t(n), _a = a.m_iRaw;
+                const int64_t _half = rounding ? ((_a < 0) != (_n < 0) ? -(_n < 0 ? -_n : _n) / 2 : (_n < 0 ? -_n : _n) / 2) : 0;
+                return from_raw(narrow((_a + _half) / _n));
+            }
+
+            friend constexpr bool operator == (self_type a, self_type b) noexcept { return a.m_iRaw == b.m_iRaw; }
+            friend constexpr bool operator != (self_type a, self_type b) noexcept { return a.m_iRaw != b.m_iRaw; }
+            friend constexpr bool operator <  (self_type a, self_type b) noexcept { return a.m_iRaw <  b.m_iRaw; }
+            friend constexpr bool operator <= (self_type a, self_type b) noexcept { return a.m_iRaw <= b.m_iRaw; }
+            friend constexpr bool operator >  (self_type a, self_type b) noexcept { return a.m_iRaw >  b.m_iRaw; }
+            friend constexpr bool operator >= (self_type a, self_type b) noexcept { return a.m_iRaw >= b.m_iRaw; }
+
+            /**
+             * @brief The quotient of two raw values, rounded by TRounding and saturated or wrapped.
+             */
+            static raw_type divide(raw_type a, raw_type b) noexcept {
+                if (b == 0) return a < 0 ? raw_min : raw_max;
+
+                const bool _negative = (a < 0) != (b < 0);
+                // a wide division is cheap where the wide type is a machine word
+                if (sizeof(wide_type) <= sizeof(void*)) {
+                    wide_type _n = wide_type(a) * one;
+                    if (rounding) {
+                        const wide_type _half = (b < 0 ? -wide_type(b) : wide_type(b)) / 2;
+                        _n += a < 0 ? -_half : _half;
+                    }
+                    return narrow(_n / b);
+                }
+
+                // else restoring division: the integer part, then one bit of the fraction per step
+                const uint32_t _ua = a < 0 ? uint32_t(0) - uint32_t(a) : uint32_t(a);
+                const uint32_t _ub = b < 0 ? uint32_t(0) - uint32_t(b) : uint32_t(b);
+                const uint32_t _limit = _negative ? uint32_t(raw_max) + 1u : uint32_t(raw_max);
+
+                uint32_t _q = _ua / _ub, _r = _ua % _ub;
+                if (_q > (_limit >> TFracBits)) {
+                    if (saturating) return _negative ? raw_min : raw_max;
+                }
+                for (utb::size_t i = 0; i < TFracBits; ++i) {
+                    _r <<= 1; _q <<= 1;
+                    if (_r >= _ub) { _r -= _ub; _q |= 1u; }
+                }
+                if (rounding && (_r << 1) >= _ub) ++_q;
+                if (saturating && _q > _limit) _q = _limit;
+                return raw_type(_negative ? uint32_t(0) - _q : _q);
+            }
+
+            /// Clamp or wrap a wide value to the raw range.
+            static constexpr raw_type narrow(int64_t v) noexcept {
+                return !saturating ? raw_type(v) : v > raw_max ? raw_max : v < raw_min ? raw_min : raw_type(v);
+            }
+
+        private:
+            constexpr fixed(raw_tag, raw_type raw) noexcept : m_iRaw(raw) { }
+
+            static constexpr raw_type from_int(int64_t v) noexcept {
+                return saturating ? (v > (raw_max >> TFracBits) ? raw_max : v < (raw_min >> TFracBits) ? raw_min
+                                        : raw_type(v * one))
+                                  : raw_type(uint64_t(v) << TFracBits);
+            }
+
+            template <typename TFloat>
+            static constexpr raw_type from_real(TFloat scaled) noexcept {
+                return scaled != scaled ? raw_type(0)
+                    : saturating && scaled >= TFloat(raw_max) ? raw_max
+                    : saturating && scaled <= TFloat(raw_min) ? raw_min
+                    : rounding ? raw_type(int64_t(scaled + (scaled < 0 ? TFloat(-0.5) : TFloat(0.5))))
+                    : raw_type(int64_t(scaled) - (scaled < TFloat(int64_t(scaled)) ? 1 : 0));
+            }
+
+            template <typename T>
+            constexpr T convert(utb::true_type) const noexcept          { return T(m_iRaw) / T(one); }
+            template <typename T>
+            constexpr T convert(utb::false_type) const noexcept         { return T(wide_type(m_iRaw) / one); }
+
+            raw_type m_iRaw;
+        };
+
+        template <utb::size_t I, utb::size_t F, class O, class R>
+        constexpr typename fixed<I, F, O, R>::wide_type fixed<I, F, O, R>::one;
+        template <utb::size_t I, utb::size_t F, class O, class R>
+        constexpr typename fixed<I, F, O, R>::raw_type fixed<I, F, O, R>::raw_max;
+        template <utb::size_t I, utb::size_t F, class O, class R>
+        constexpr typename fixed<I, F, O, R>::raw_type fixed<I, F, O, R>::raw_min;
+
+        template <utb::size_t I, utb::size_t F, class O, class R>
+        inline fixed<I, F, O, R> abs(fixed<I, F, O, R> v) noexcept  { return v.raw() < 0 ? -v : v; }
+
+        template <utb::size_t I, utb::size_t F, class O, class R>
+        inline fixed<I, F, O, R> floor(fixed<I, F, O, R> v) noexcept {
+            using raw_type = typename fixed<I, F, O, R>::raw_type;
+            return fixed<I, F, O, R>::from_raw(raw_type(v.raw() & ~raw_type(fixed<I, F, O, R>::one - 1)));
+        }
+
+        template <utb::size_t I, utb::size_t F, class O, class R>
+        inline fixed<I, F, O, R> ceil(fixed<I, F, O, R> v) noexcept {
+            return -floor(-v);
+        }
+
+        /**
+         * @brief The square root, digit by digit in the wide type; 0 for v <= 0.
+         */
+        template <utb::size_t I, utb::size_t F, class O, class R>
+        inline fixed<I, F, O, R> sqrt(fixed<I, F, O, R> v) noexcept {
+            using fixed_type = fixed<I, F, O, R>;
+            using uwide_type = typename utb::conditional<(sizeof(typename fixed_type::wide_type) > 4), uint64_t, uint32_t>::type;
+            if (v.raw() <= 0) return fixed_type::from_raw(0);
+
+            uwide_type _n = uwide_type(v.raw()) << F, _root = 0;
+            uwide_type _bit = uwide_type(1) << (sizeof(uwide_type) * 8 - 2);
+            while (_bit > _n) _bit >>= 2;
+
+            while (_bit != 0) {
+                if (_n >= _root + _bit) { _n -= _root + _bit; _root = (_root >> 1) + _bit; }
+                else _root >>= 1;
+                _bit >>= 2;
+            }
+            if (fixed_type::rounding && _n > _root) ++_root;
+            return fixed_type::from_raw(fixed_type::narrow(int64_t(_root)));
+        }
+
+        /**
+         * @brief sin and cos of angle (radians), within a few 2^-TFracBits.
+         */
+        template <utb::size_t I, utb::size_t F, class O, class R>
+        inline void sincos(fixed<I, F, O, R> angle, fixed<I, F, O, R>& s, fixed<I, F, O, R>& c) noexcept {
+            using fixed_type = fixed<I, F, O, R>;
+            constexpr int64_t _pi = int64_t(3.14159265358979323846 * double(int64_t(1) << F) + 0.5);
+
+            // reduce to [-pi, pi] in the raw domain, then go to Q29
+            int64_t _a = angle.raw();
+            if (_a > _pi || _a < -_pi) {
+                _a %= 2 * _pi;
+                if (_a > _pi) _a -= 2 * _pi;
+                else if (_a < -_pi) _a += 2 * _pi;
+            }
+            const int32_t _z = F <= 29 ? int32_t(_a * (int64_t(1) << (F <= 29 ? 29 - F : 0)))
+                                       : int32_t(_a >> (F > 29 ? F - 29 : 0));
+
+            int32_t _s, _c;
+            internal::cordic_sincos(_z, F + 2 < 29 ? F + 2 : 29, _s, _c);
+
+            // back from Q29
+            const int64_t _half = (fixed_type::rounding && F < 29) ? (int64_t(1) << (F < 29 ? 28 - F : 0)) : 0;
+            s = fixed_type::from_raw(fixed_type::narrow(F <= 29 ? (int64_t(_s) + _half) >> (F <= 29 ? 29 - F : 0)
+                                                                : int64_t(_s) * (int64_t(1) << (F > 29 ? F - 29 : 0))));
+            c = fixed_type::from_raw(fixed_type::narrow(F <= 29 ? (int64_t(_c) + _half) >> (F <= 29 ? 29 - F : 0)
+                                                                : int64_t(_c) * (int64_t(1) << (F > 29 ? F - 29 : 0))));
+        }
+
+        template <utb::size_t I, utb::size_t F, class O, class R>
+        inline fixed<I, F, O, R> sin(fixed<I, F, O, R> angle) noexcept {
+            fixed<I, F, O, R> _s, _c;
+            sincos(angle, _s, _c);
+            return _s;
+        }
+
+        template <utb::size_t I, utb::size_t F, class O, class R>
+        inline fixed<I, F, O, R> cos(fixed<I, F, O, R> angle) noexcept {
+            fixed<I, F, O, R> _s, _c;
+            sincos(angle, _s, _c);
+            return _c;
+        }
+    }
+
+    using fixed_point::fixed;
+    using fixed_point::fixed_saturate;
+    using fixed_point::fixed_wrap;
+    using fixed_point::fixed_round_nearest;
+    using fixed_point::fixed_truncate;
+
+    /// Q7.8, -128 to 127.996 in steps of 1/256.
+    using fixed8_8 = fixed<8, 8>;
+    /// Q1.14, -2 to 1.99994: unit vectors, quaternions and colors in 16 bit.
+    using fixed2_14 = fixed<2, 14>;
+    /// Q15.16, -32768 to 32767.99998 in steps of 1/65536.
+    using fixed16_16 = fixed<16, 16>;
+}
+
+#endif // __UT_FIXED_H__
@@ -28,50 +28,67 @@ namespace utb {
 
 	template <class TSIG, class... Args, utb::size_t sz, utb::size_t algn>
     class light_function_base<TSIG(Args...), sz, algn> {
-        /// @brief Type-erased vtable storing operations for the contained callable.
+        /// @brief The invoker of the stored callable, kept in the wrapper itself so a call is a
+        /// single indirect call without a vtable load.
+        using invoker_t = TSIG (*)(void const *t, Args &&...args);
+
+        /// @brief Copy, move and destroy of the stored callable.
         ///
-        /// The vtable provides three operations: move the stored object, destroy
-        /// the stored object, and invoke the stored callable with the given
-        /// arguments.
-        struct vtable_t {
-            /// @brief Move the stored object from src to dest (placement-new).
+        /// Trivially copyable callables (function pointers, lambdas capturing pointers or
+        /// references) have no manager: they are copied and moved as bytes and never destroyed.
+        struct manager_t {
+            /// @brief Copy-construct the object at src into dest (placement-new).
+            void (*copier)(void const *src, void *dest);
+
+            /// @brief Move-construct the object at src into dest (placement-new).
             void (*mover)(void *src, void *dest);
 
             /// @brief Destroy the stored object in-place.
             void (*destroyer)(void *);
 
-            /// @brief Invoke the stored callable and return the result.
-            TSIG (*invoke)(void const *t, Args &&...args);
+            /// @brief Obtain the manager for a specific callable type T, nullptr when T is
+            /// trivially copyable. The returned pointer is valid for the lifetime of the program.
+            template <class T> static manager_t const *get() {
+                return is_trivially_copyable<T>::value ? nullptr : get_table<T>();
+            }
 
-            /// @brief Obtain a vtable instance for a specific callable type T.
-            ///
-            /// The returned pointer is valid for the lifetime of the program.
-            template <class T> static vtable_t const *get() {
-                static const vtable_t table = {
+            template <class T> static manager_t const *get_table() {
+                static const manager_t table = {
+                    [](void const *src, void *dest) { new (dest) T(*static_cast<T const *>(src)); },
                     [](void *src, void *dest) { new (dest) T(utb::move(*static_cast<T *>(src))); },
-                    [](void *t) { static_cast<T *>(t)->~T(); },
-                    [](void const *t, Args &&...args) -> TSIG {
-                        return (*static_cast<T const *>(t))(utb::forward<Args>(args)...);
-                    }
+                    [](void *t) { static_cast<T *>(t)->~T(); }
                 };
                 return &table;
             }
         };
+
+        template <class T>
+        static TSIG invoke(void const *t, Args &&...args) {
+            return (*static_cast<T const *>(t))(utb::forward<Args>(args)...);
+        }
 	public:
         /// @brief The return type of the wrapped callable.
         using return_type = TSIG;
 
         /// @brief Default-construct an empty wrapper (no callable stored).
-        light_function_base() { }
+        light_function_base() noexcept : m_pInvoke(nullptr), m_pManager(nullptr) { }
+
+        /// @brief Construct an empty wrapper.
+        light_function_base(nullptr_t) noexcept : m_pInvoke(nullptr), m_pManager(nullptr) { }
 
-        /// @brief Copy-construct from another wrapper.
+        /// @brief Copy-construct from another wrapper, copying the stored callable.
         light_function_base(const light_function_base &o)
-            : table(o.table), data(o.data) { }
+            : m_pInvoke(o.m_pInvoke), m_pManager(o.m_pManager) {
+            if (m_pManager) m_pManager->copier(&o.m_data, &m_data);
+            else if (m_pInvoke) m_data = o.m_data;     // an empty wrapper has no bytes to copy
+        }
 
-        /// @brief Move-construct from another wrapper.
+        /// @brief Move-construct from another wrapper, the other wrapper is empty afterwards.
         light_function_base(light_function_base &&o)
-            : table(o.table) {
-            if (table) table->mover(&o.data, &data);
+            : m_pInvoke(o.m_pInvoke), m_pManager(o.m_pManager) {
+            if (m_pManager) m_pManager->mover(&o.m_data, &m_data);
+            else if (m_pInvoke) m_data = o.m_data;
+            o.reset();
         }
 
         /// @brief Construct from any callable object compatible with the signature.
@@ -79,46 +96,60 @@ namespace utb {
         /// The callable is stored in-place in the internal buffer. SFINAE is used
         /// to prevent accidental construction from another light_function_base and
         /// to ensure the callable's return type is convertible to TSIG.
-        template <class F, class dF = decay_t<F>, enable_if_t<!is_same<dF, light_function_base>{}> * = nullptr,
-                  enable_if_t<is_convertible<res_of_t<dF &(Args...)>, TSIG>{}> * = nullptr>
-        light_function_base(F &&f) : table(vtable_t::template get<dF>()) {
+        template <class F, class dF = decay_t<F>, enable_if_t<!is_same<dF, light_function_base>::value> * = nullptr,
+                  enable_if_t<is_convertible<res_of_t<dF &(Args...)>, TSIG>::value> * = nullptr>
+        light_function_base(F &&f)
+            : m_pInvoke(&invoke<dF>), m_pManager(manager_t::template get<dF>()), m_data() {
+            // m_data is zeroed: a trivially copyable dF smaller than the buffer is copied with the whole buffer
             static_assert(sizeof(dF) <= sz, "object too large");
             static_assert(alignof(dF) <= algn, "object too aligned");
-            new (&data) dF(forward<F>(f));
+            new (&m_data) dF(forward<F>(f));
         }
 
         /// @brief Destroy the stored callable, if any.
         ~light_function_base() {
-            if (table) table->destroyer(&data);
+            if (m_pManager) m_pManager->destroyer(&m_data);
         }
 
         /// @brief Copy-assignment.
         light_function_base &operator=(const light_function_base &o) {
-            this->~light_function_base();
-            new (this) light_function_base(move(o));
+            if (this != &o) {
+                this->~light_function_base();
+                new (this) light_function_base(o);
+            }
             return *this;
         }
 
         /// @brief Move-assignment.
         light_function_base &operator=(light_function_base &&o) {
-            this->~light_function_base();
-            new (this) light_function_base(move(o));
+            if (this != &o) {
+                this->~light_function_base();
+                new (this) light_function_base(move(o));
+            }
             return *this;
         }
 
+        /// @brief Destroy the stored callable, the wrapper is empty afterwards.
+        void reset() {
+            if (m_pManager) m_pManager->destroyer(&m_data);
+            m_pInvoke = nullptr;
+            m_pManager = nullptr;
+        }
+
         /// @brief True if a callable is stored.
         explicit operator bool() const {
-            return table;
+            return m_pInvoke != nullptr;
         }
 
         /// @brief Invoke the stored callable with the given arguments.
         /// @note Behavior is undefined if no callable is stored.
         return_type operator()(Args... args) const {
-            return table->invoke(&data, utb::forward<Args>(args)...);
+            return m_pInvoke(&m_data, utb::forward<Args>(args)...);
         }
 	private:
-		vtable_t const *table = nullptr;
-        aligned_storage_t<sz, algn> data;
+        invoker_t m_pInvoke;
+        manager_t const *m_pManager;
+        aligned_storage_t<sz, algn> m_data;
     };
 
     template <class TSIG, class... Args, utb::size_t sz, utb::size_t algn>
@@ -144,6 +175,69 @@ namespace utb {
 
     template <class TSIG>
     using function = light_function_base<TSIG, sizeof(void *) * 4, alignof(void *)>;
+
+    /// @brief Non-owning reference to a callable, two pointers in size.
+    ///
+    /// Nothing is copied or stored: the callable must outlive the function_ref, so use it
+    /// for parameters ("call this back while I run") and not for members. Callables that
+    /// convert to a function pointer, like lambdas without captures, are kept as that pointer
+    /// and cannot dangle.
+    /// @tparam Sig Function signature (return type and argument types).
+    template <class Sig>
+    class function_ref;
+
+    template <class TSIG, class... Args>
+    class function_ref<TSIG(Args...)> {
+        using pointer_t = TSIG (*)(Args...);
+
+        union target_t {
+            void const *object;
+            pointer_t function;
+        };
+        using invoker_t = TSIG (*)(target_t, Args &&...args);
+
+        template <class T>
+        static TSIG invoke_object(target_t t, Args &&...args) {
+            return (*static_cast<T const *>(t.object))(utb::forward<Args>(args)...);
+        }
+        static TSIG invoke_function(target_t t, Args &&...args) {
+            return t.function(utb::forward<Args>(args)...);
+        }
+    public:
+        /// @brief The return type of the referenced callable.
+        using return_type = TSIG;
+
+        /// @brief Refer to a function.
+        function_ref(pointer_t f) noexcept : m_pInvoke(&invoke_function) {
+            m_target.function = f;
+        }
+
+        /// @brief Refer to a callable object, which must outlive this reference.
+        template <class F, class dF = decay_t<F>, enable_if_t<!is_same<dF, function_ref>::value> * = nullptr,
+                  enable_if_t<is_convertible<res_of_t<dF &(Args...)>, TSIG>::value> * = nullptr>
+        function_ref(F &&f) noexcept {
+            bind(f, int_to_type<is_convertible<dF, pointer_t>::value>());
+        }
+
+        /// @brief Invoke the referenced callable with the given arguments.
+        return_type operator()(Args... args) const {
+            return m_pInvoke(m_target, utb::forward<Args>(args)...);
+        }
+    private:
+        template <class F>
+        void bind(F &f, int_to_type<true>) noexcept {
+            m_target.function = f;
+            m_pInvoke = &invoke_function;
+        }
+        template <class F>
+        void bind(F &f, int_to_type<false>) noexcept {
+            m_target.object = &f;
+            m_pInvoke = &invoke_object<F>;
+        }
+
+        target_t m_target;
+        invoker_t m_pInvoke;
+    };
 }
 
 #endif
\ No newline at end of file
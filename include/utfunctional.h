@@ -144,11 +144,15 @@ namespace utb {
 
 
     namespace internal {
+        /// void for the detection idiom, utb::void_t is a class type and never matches the default void.
+        template <class...> struct detect_void { using type = void; };
+        template <class... Ts> using detect_void_t = typename detect_void<Ts...>::type;
+
         template <template <class...> typename Z, typename, typename... Ts>
         struct can_apply : false_type {};
 
         template <template <class...> typename Z, typename... Ts>
-        struct can_apply<Z, void_t<Z<Ts...>>, Ts...> : true_type {};
+        struct can_apply<Z, detect_void_t<Z<Ts...>>, Ts...> : true_type {};
 
         template <typename From, typename To>
         using try_convert = decltype(To{declval<From>()});
@@ -159,7 +163,7 @@ namespace utb {
         template <class Sig, class = void>
         struct res_of {};
         template <class G, class... Args>
-        struct res_of<G(Args...), void_t<invoke_t<G, Args...>>> : tag<invoke_t<G, Args...>> {};
+        struct res_of<G(Args...), detect_void_t<invoke_t<G, Args...>>> : tag<invoke_t<G, Args...>> {};
 
     }
 
@@ -168,7 +172,7 @@ namespace utb {
 
 
     template <typename From, typename To>
-    struct is_convertible : internal::can_apply<internal::try_convert, From, To> {};
+    struct is_convertible : can_apply<internal::try_convert, From, To> {};
 
     template <> struct is_convertible<void, void> : true_type {};
 
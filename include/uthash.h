@@ -10,6 +10,7 @@
 #define __UTBHASH_H__
 
 #include "utconfig.h"
+#include "utalgorithm.h"
 #include <cstdint>
 #include <string.h>
 
@@ -19,97 +20,405 @@ namespace utb {
 
 	namespace internal {
 
-        #define ROTL32(x, r) (uint32_t) ( (x << r) | (x >> (32 - r)) );
-
-        uint32_t mmh3_x86(const void* key, int len, uint32_t seed) {
-            const uint8_t * data = (const uint8_t*)key;
-            const int nBlocks = len / 4;
-            const uint32_t * blocks = (const uint32_t *)(data + nBlocks*4);
-
-            uint32_t hash = seed;
-
-            const uint32_t c1 = 0xcc9e2d51;
-            const uint32_t c2 = 0x1b873593;
-
-            uint32_t k;
-            for (int i = 0; i < nBlocks ; ++i) {
-                k = blocks[i];
-                
-                k *= c1;
-                k = ROTL32(k,15);
-                k *= c2;
-                
-                hash ^= k;
-                hash = ROTL32(hash, 13);
-                hash = (hash * 5) + 0xe6546b64;
+        /// Unaligned little-endian reads, the compiler turns the memcpy into a single load where allowed.
+        inline uint32_t hash_read32(const uint8_t* p) { uint32_t v; memcpy(&v, p, 4); return v; }
+        inline uint64_t hash_read64(const uint8_t* p) { uint64_t v; memcpy(&v, p, 8); return v; }
+
+        inline uint32_t rotl32(uint32_t x, int8_t r) { return (x << r) | (x >> (32 - r)); }
+        inline uint64_t rotl64(uint64_t x, int8_t r) { return (x << r) | (x >> (64 - r)); }
+
+        inline uint64_t fmix64(uint64_t k) {
+            k ^= k >> 33; k *= 0xff51afd7ed558ccdULL;
+            k ^= k >> 33; k *= 0xc4ceb9fe1a85ec53ULL;
+            k ^= k >> 33;
+            return k;
+        }
+    }
+
+    /**
+     * @brief Integer mixers: every input bit affects every output bit, so the low bits are usable
+     * for a reduction to a table size (unlike a single multiply, whose low bits only depend on the
+     * low input bits).
+     */
+    inline uint32_t mix32(uint32_t x) {
+        x ^= x >> 16; x *= 0x7feb352dU;
+        x ^= x >> 15; x *= 0x846ca68bU;
+        x ^= x >> 16;
+        return x;
+    }
+
+    /// @copydoc mix32
+    inline uint64_t mix64(uint64_t x) {
+        x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27; x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return x;
+    }
+
+    /// 128 bit result of murmur3_128.
+    struct hash128 {
+        uint64_t low;
+        uint64_t high;
+
+        operator uint64_t() const { return low; }
+    };
+
+    /**
+     * @brief The byte hash algorithms. Every algorithm consumes block_size byte blocks and
+     * finishes with the tail, so the same code serves the one-shot hash_bytes() and the streaming
+     * basic_hash_stream.
+     *
+     * Blocks are read little-endian, results on big-endian targets differ.
+     */
+    namespace hash_algorithm {
+
+        /**
+         * @brief FNV-1a 32 bit: one xor and one multiply per byte, no tables, tiny code.
+         * The choice for 8 bit MCUs and short keys.
+         */
+        struct fnv1a32 {
+            using result_type = uint32_t;
+            static constexpr utb::size_t block_size = 1;
+
+            struct state_type { uint32_t h; };
+
+            static void init(state_type& s, uint32_t seed)          { s.h = 2166136261U ^ seed; }
+            static void block(state_type& s, const uint8_t* p)      { s.h = (s.h ^ *p) * 16777619U; }
+            static result_type finalize(state_type& s, const uint8_t*, utb::size_t, uint64_t) { return s.h; }
+        };
+
+        /**
+         * @brief MurmurHash3 x86_32.
+         */
+        struct murmur3_32 {
+            using result_type = uint32_t;
+            static constexpr utb::size_t block_size = 4;
+
+            struct state_type { uint32_t h; };
+
+            static constexpr uint32_t c1 = 0xcc9e2d51;
+            static constexpr uint32_t c2 = 0x1b873593;
+
+            static uint32_t scramble(uint32_t k) {
+                k *= c1; k = internal::rotl32(k, 15); k *= c2;
+                return k;
+            }
+
+            static void init(state_type& s, uint32_t seed)          { s.h = seed; }
+            static void block(state_type& s, const uint8_t* p) {
+                s.h ^= scramble(internal::hash_read32(p));
+                s.h = internal::rotl32(s.h, 13);
+                s.h = s.h * 5 + 0xe6546b64;
+            }
+            static result_type finalize(state_type& s, const uint8_t* tail, utb::size_t n, uint64_t length) {
+                uint32_t _k = 0;
+                switch (n) {
+                    case 3: _k ^= uint32_t(tail[2]) << 16;   // fall through
+                    case 2: _k ^= uint32_t(tail[1]) << 8;    // fall through
+                    case 1: _k ^= tail[0];
+                            s.h ^= scramble(_k);
+                }
+                uint32_t _h = s.h ^ uint32_t(length);
+                _h ^= _h >> 16; _h *= 0x85ebca6b;
+                _h ^= _h >> 13; _h *= 0xc2b2ae35;
+                _h ^= _h >> 16;
+                return _h;
             }
-            
-            const uint8_t * tail = (const uint8_t*)(data + nBlocks*4);
-
-            uint32_t k1 = 0;
-
-            switch(len & 3) {
-                case 3: 
-                    k ^= tail[2] << 16;
-                case 2: 
-                    k ^= tail[1] << 8;
-                case 1: 
-                    k ^= tail[0];
-                    k *= c1;
-                    k = ROTL32(k,15);
-                    k *= c2;
-                    hash ^= k;
+        };
+
+        /**
+         * @brief MurmurHash3 x64_128, for 128 bit digests and 64 bit targets.
+         */
+        struct murmur3_128 {
+            using result_type = hash128;
+            static constexpr utb::size_t block_size = 16;
+
+            struct state_type { uint64_t h1, h2; };
+
+            static constexpr uint64_t c1 = 0x87c37b91114253d5ULL;
+            static constexpr uint64_t c2 = 0x4cf5ad432745937fULL;
+
+            static void init(state_type& s, uint32_t seed)          { s.h1 = seed; s.h2 = seed; }
+            static void block(state_type& s, const uint8_t* p) {
+                uint64_t _k1 = internal::hash_read64(p);
+                uint64_t _k2 = internal::hash_read64(p + 8);
+
+                _k1 *= c1; _k1 = internal::rotl64(_k1, 31); _k1 *= c2; s.h1 ^= _k1;
+                s.h1 = internal::rotl64(s.h1, 27); s.h1 += s.h2; s.h1 = s.h1 * 5 + 0x52dce729;
+
+                _k2 *= c2; _k2 = internal::rotl64(_k2, 33); _k2 *= c1; s.h2 ^= _k2;
+                s.h2 = internal::rotl64(s.h2, 31); s.h2 += s.h1; s.h2 = s.h2 * 5 + 0x38495ab5;
             }
-            
-            hash ^= len;
-            hash ^= hash >> 16;
-            hash *= 0x85ebca6b;
-            hash ^= hash >> 13;
-            hash *= 0xc2b2ae35;
-            hash ^= hash  >> 16;
-                    
-            return hash;
+            static result_type finalize(state_type& s, const uint8_t* tail, utb::size_t n, uint64_t length) {
+                uint64_t _k1 = 0, _k2 = 0;
+
+                for (utb::size_t i = n; i > 8; --i) _k2 ^= uint64_t(tail[i - 1]) << ((i - 9) * 8);
+                if (n > 8) { _k2 *= c2; _k2 = internal::rotl64(_k2, 33); _k2 *= c1; s.h2 ^= _k2; }
+
+                for (utb::size_t i = (n > 8 ? 8 : n); i > 0; --i) _k1 ^= uint64_t(tail[i - 1]) << ((i - 1) * 8);
+                if (n > 0) { _k1 *= c1; _k1 = internal::rotl64(_k1, 31); _k1 *= c2; s.h1 ^= _k1; }
+
+                s.h1 ^= length; s.h2 ^= length;
+                s.h1 += s.h2; s.h2 += s.h1;
+                s.h1 = internal::fmix64(s.h1); s.h2 = internal::fmix64(s.h2);
+                s.h1 += s.h2; s.h2 += s.h1;
+
+                hash128 _r = { s.h1, s.h2 };
+                return _r;
+            }
+        };
+
+        /**
+         * @brief xxHash64: four independent 64 bit lanes over 32 byte stripes, the fastest choice for
+         * longer keys on 32/64 bit targets.
+         */
+        struct xxh64 {
+            using result_type = uint64_t;
+            static constexpr utb::size_t block_size = 32;
+
+            struct state_type { uint64_t v[4]; uint64_t seed; };
+
+            static constexpr uint64_t p1 = 11400714785074694791ULL;
+            static constexpr uint64_t p2 = 14029467366897019727ULL;
+            static constexpr uint64_t p3 = 1609587929392839161ULL;
+            static constexpr uint64_t p4 = 9650029242287828579ULL;
+            static constexpr uint64_t p5 = 2870177450012600261ULL;
+
+            static uint64_t round(uint64_t acc, uint64_t input) {
+                acc += input * p2;
+                acc = internal::rotl64(acc, 31);
+                return acc * p1;
+            }
+            static uint64_t merge(uint64_t acc, uint64_t v) {
+                acc ^= round(0, v);
+                return acc * p1 + p4;
+            }
+
+            static void init(state_type& s, uint32_t seed) {
+                s.seed = seed;
+                s.v[0] = s.seed + p1 + p2; s.v[1] = s.seed + p2;
+                s.v[2] = s.seed;           s.v[3] = s.seed - p1;
+            }
+            static void block(state_type& s, const uint8_t* p) {
+                s.v[0] = round(s.v[0], internal::hash_read64(p));
+                s.v[1] = round(s.v[1], internal::hash_read64(p + 8));
+                s.v[2] = round(s.v[2], internal::hash_read64(p + 16));
+                s.v[3] = round(s.v[3], internal::hash_read64(p + 24));
+            }
+            static result_type finalize(state_type& s, const uint8_t* tail, utb::size_t n, uint64_t length) {
+                uint64_t _h;
+                if (length >= block_size) {
+                    _h = internal::rotl64(s.v[0], 1) + internal::rotl64(s.v[1], 7) +
+                         internal::rotl64(s.v[2], 12) + internal::rotl64(s.v[3], 18);
+                    _h = merge(_h, s.v[0]); _h = merge(_h, s.v[1]);
+                    _h = merge(_h, s.v[2]); _h = merge(_h, s.v[3]);
+                } else {
+                    _h = s.seed + p5;
+                }
+                _h += length;
+
+                for (; n >= 8; n -= 8, tail += 8) {
+                    _h ^= round(0, internal::hash_read64(tail));
+                    _h = internal::rotl64(_h, 27) * p1 + p4;
+                }
+                if (n >= 4) {
+                    _h ^= uint64_t(internal::hash_read32(tail)) * p1;
+                    _h = internal::rotl64(_h, 23) * p2 + p3;
+                    n -= 4; tail += 4;
+                }
+                for (; n > 0; --n, ++tail) {
+                    _h ^= *tail * p5;
+                    _h = internal::rotl64(_h, 11) * p1;
+                }
+                _h ^= _h >> 33; _h *= p2;
+                _h ^= _h >> 29; _h *= p3;
+                _h ^= _h >> 32;
+                return _h;
+            }
+        };
+
+        /// FNV-1a on 8 bit targets, MurmurHash3 x86_32 on 32 bit and xxHash64 on 64 bit targets.
+        using default_algorithm = typename utb::select<(__SIZEOF_POINTER__ <= 2), fnv1a32,
+                                  typename utb::select<(__SIZEOF_POINTER__ <= 4), murmur3_32, xxh64>::result>::result;
+    }
+
+    /**
+     * @brief Hash n bytes at once.
+     * @tparam TAlgorithm The algorithm, one of utb::hash_algorithm.
+     */
+    template <class TAlgorithm = hash_algorithm::default_algorithm>
+    typename TAlgorithm::result_type hash_bytes(const void* key, utb::size_t n, uint32_t seed = UTB_CONFIG_BASIC_HASHMUL_VAL) {
+        const uint8_t* _p = static_cast<const uint8_t*>(key);
+        typename TAlgorithm::state_type _state;
+
+        TAlgorithm::init(_state, seed);
+
+        const utb::size_t _blocks = n / TAlgorithm::block_size;
+        for (utb::size_t i = 0; i < _blocks; ++i, _p += TAlgorithm::block_size)
+            TAlgorithm::block(_state, _p);
+
+        return TAlgorithm::finalize(_state, _p, n - _blocks * TAlgorithm::block_size, n);
+    }
+
+    /**
+     * @brief Streaming hasher for data that arrives in chunks, e.g. from a UART or a file.
+     *
+     * Any split of the data over update() calls gives the same result as hash_bytes() over the
+     * whole data. Only one block is buffered.
+     *
+     * @tparam TAlgorithm The algorithm, one of utb::hash_algorithm.
+     */
+    template <class TAlgorithm = hash_algorithm::default_algorithm>
+    class basic_hash_stream {
+    public:
+        using algorithm_type = TAlgorithm;
+        using result_type = typename TAlgorithm::result_type;
+        using size_type = utb::size_t;
+        using self_type = basic_hash_stream<TAlgorithm>;
+
+        explicit basic_hash_stream(uint32_t seed = UTB_CONFIG_BASIC_HASHMUL_VAL) {
+            reset(seed);
+        }
+
+        /**
+         * @brief Start a new hash.
+         */
+        void reset(uint32_t seed = UTB_CONFIG_BASIC_HASHMUL_VAL) {
+            TAlgorithm::init(m_state, seed);
+            m_sBuffered = 0;
+            m_iLength = 0;
         }
 
+        /**
+         * @brief Add n bytes.
+         */
+        self_type& update(const void* data, size_type n) {
+            const uint8_t* _p = static_cast<const uint8_t*>(data);
+            m_iLength += n;
+
+            // complete a buffered block first
+            if (m_sBuffered != 0) {
+                const size_type _fill = utb::min<size_type>(n, TAlgorithm::block_size - m_sBuffered);
+                memcpy(m_ayBuffer + m_sBuffered, _p, _fill);
+                m_sBuffered += _fill; _p += _fill; n -= _fill;
+
+                if (m_sBuffered < TAlgorithm::block_size) return *this;
+                TAlgorithm::block(m_state, m_ayBuffer);
+                m_sBuffered = 0;
+            }
+            for (; n >= TAlgorithm::block_size; n -= TAlgorithm::block_size, _p += TAlgorithm::block_size)
+                TAlgorithm::block(m_state, _p);
+
+            memcpy(m_ayBuffer, _p, n);
+            m_sBuffered = n;
+            return *this;
+        }
+
+        /**
+         * @brief Get the hash of all bytes added since the last reset().
+         * The stream is left unchanged, update() may go on.
+         */
+        result_type finalize() const {
+            typename TAlgorithm::state_type _state = m_state;
+            return TAlgorithm::finalize(_state, m_ayBuffer, m_sBuffered, m_iLength);
+        }
+
+    private:
+        typename TAlgorithm::state_type m_state;
+        uint8_t m_ayBuffer[TAlgorithm::block_size];
+        size_type m_sBuffered;
+        uint64_t m_iLength;
+    };
+
+    template <class TAlgorithm = hash_algorithm::default_algorithm>
+    using hash_stream = basic_hash_stream<TAlgorithm>;
+
+    /**
+     * @brief FNV-1a over a zero terminated string, constexpr so a literal is hashed by the compiler.
+     *
+     * Gives the same value as hash_bytes<hash_algorithm::fnv1a32>(s, strlen(s), seed), at runtime
+     * in a single pass without strlen():
+     * @code
+     * switch (utb::hash_literal(token)) {
+     *     case "led"_hash:   ...; break;
+     *     case "reset"_hash: ...; break;
+     * }
+     * @endcode
+     */
+    constexpr uint32_t hash_literal(const char* s, uint32_t seed = 0) {
+        uint32_t _h = 2166136261U ^ seed;
+        while (*s) _h = (_h ^ uint8_t(*s++)) * 16777619U;
+        return _h;
+    }
+
+    /**
+     * @brief FNV-1a over the first n chars of s, for tokens that are not zero terminated.
+     */
+    constexpr uint32_t hash_literal(const char* s, utb::size_t n, uint32_t seed) {
+        uint32_t _h = 2166136261U ^ seed;
+        for (utb::size_t i = 0; i < n; ++i) _h = (_h ^ uint8_t(s[i])) * 16777619U;
+        return _h;
+    }
+
+    namespace literals {
+        /// "name"_hash, equal to hash_literal("name").
+        constexpr uint32_t operator"" _hash(const char* s, decltype(sizeof(0)) n) {
+            return hash_literal(s, utb::size_t(n), 0);
+        }
+    }
+
+	namespace internal {
+        /// The former entry point, kept for existing callers.
+        inline uint32_t mmh3_x86(const void* key, int len, uint32_t seed) {
+            return hash_bytes<hash_algorithm::murmur3_32>(key, utb::size_t(len), seed);
+        }
+
+        inline hash_type fold_hash(uint32_t h) { return hash_type(h); }
+        inline hash_type fold_hash(uint64_t h) { return hash_type(sizeof(hash_type) < 8 ? h ^ (h >> 32) : h); }
+        inline hash_type fold_hash(const hash128& h) { return fold_hash(h.low); }
+    }
 
-      }
 	/**
-	 * @brief Default implementation of hasher.
+	 * @brief Default implementation of hasher: hashes the object representation of T.
 	 */
 	template<typename T>
 	struct hash {
-		const hash_type operator()(T& t) const noexcept {
-			return (hash_type) internal::mmh3_x86(&t, strlen( (char*)&t), UTB_CONFIG_BASIC_HASHMUL_VAL);
+		hash_type operator()(const T& t) const noexcept {
+			return internal::fold_hash(hash_bytes(&t, sizeof(T)));
 		}
 	};
 
+	/**
+	 * @brief Pointers are hashed by their address.
+	 */
 	template<typename T>
     struct hash<T*>{
 		hash_type operator () (T* pPtr) const noexcept {
-			assert(pPtr);
-
-			return (hash_type) internal::mmh3_x86(&pPtr, strlen((char *)pPtr), UTB_CONFIG_BASIC_HASHMUL_VAL);
+			return internal::fold_hash(sizeof(pPtr) > 4 ? mix64(uint64_t(reinterpret_cast<uintptr_t>(pPtr)))
+			                                            : uint64_t(mix32(uint32_t(reinterpret_cast<uintptr_t>(pPtr)))));
 		}
     };
 
-  	template<>
-    struct hash<char*>{
-		const hash_type operator()(const char* t) const noexcept {
-			return (hash_type) internal::mmh3_x86(t, strlen(t), UTB_CONFIG_BASIC_HASHMUL_VAL);
+	/**
+	 * @brief String hasher with a selectable algorithm.
+	 */
+	template <class TAlgorithm = hash_algorithm::default_algorithm>
+	struct string_hash {
+		hash_type operator()(const char* t) const noexcept {
+			return internal::fold_hash(hash_bytes<TAlgorithm>(t, strlen(t)));
 		}
-    };
+	};
+
+  	template<>
+    struct hash<char*> : string_hash<> { };
 
     template<>
-    struct hash<const char*>{
-		const hash_type operator()(const char* t) const noexcept {
-			return (hash_type) internal::mmh3_x86(t, strlen(t), UTB_CONFIG_BASIC_HASHMUL_VAL);
-		}
-    };
+    struct hash<const char*> : string_hash<> { };
 
     template<>
     struct hash<int8_t>{
 		hash_type operator () (int8_t n) const noexcept {
-			return static_cast<hash_type>(n) * UTB_CONFIG_BASIC_HASHMUL_VAL;
+			return static_cast<hash_type>(mix32(uint8_t(n)));
 		}
     };
 
@@ -117,7 +426,7 @@ namespace utb {
 	template<>
     struct hash<uint8_t>{
 		hash_type operator () (uint8_t n) const noexcept {
-			return static_cast<hash_type>(n) * UTB_CONFIG_BASIC_HASHMUL_VAL;
+			return static_cast<hash_type>(mix32(n));
 		}
     };
 
@@ -125,28 +434,28 @@ namespace utb {
 	template<>
     struct hash<int16_t>{
 		hash_type operator () (int16_t n) const noexcept {
-			return static_cast<hash_type>(n) * UTB_CONFIG_BASIC_HASHMUL_VAL;
+			return static_cast<hash_type>(mix32(uint16_t(n)));
 		}
     };
 
 	template<>
     struct hash<uint16_t>{
 		hash_type operator () (uint16_t n) const noexcept {
-			return static_cast<hash_type>(n) * UTB_CONFIG_BASIC_HASHMUL_VAL;
+			return static_cast<hash_type>(mix32(n));
 		}
     };
 
 	template<>
     struct hash<int32_t>{
 		hash_type operator () (int32_t n) const noexcept {
-			return static_cast<hash_type>(n) * UTB_CONFIG_BASIC_HASHMUL_VAL;
+			return static_cast<hash_type>(mix32(uint32_t(n)));
 		}
     };
 
 	template<>
     struct hash<uint32_t>{
 		hash_type operator () (uint32_t n) const noexcept {
-			return static_cast<hash_type>(n) * UTB_CONFIG_BASIC_HASHMUL_VAL;
+			return static_cast<hash_type>(mix32(n));
 		}
     };
 
@@ -154,7 +463,7 @@ namespace utb {
 	template<>
     struct hash<int64_t>{
 		hash_type operator () (int64_t n) const noexcept {
-			return static_cast<hash_type>(n) * UTB_CONFIG_BASIC_HASHMUL_VAL;
+			return internal::fold_hash(mix64(uint64_t(n)));
 		}
     };
 
@@ -162,24 +471,78 @@ namespace utb {
 	template<>
     struct hash<uint64_t>{
 		hash_type operator () (const uint64_t n) const noexcept {
-			return static_cast<hash_type>(n) * UTB_CONFIG_BASIC_HASHMUL_VAL;
+			return internal::fold_hash(mix64(n));
 		}
     };
 
-    template <class T>
+    /**
+     * @brief How a hash is reduced to a bucket index in [0, n).
+     *
+     * The % of the old hash_function is a hardware division, on AVR and Cortex-M0 a call into
+     * the software division. mask and fastrange need one AND or one multiply. All policies take
+     * n as argument; basic_hash_table passes its constant capacity, so after inlining the choice
+     * of automatic is made by the compiler.
+     */
+    namespace hash_reduce {
+
+        /// h % n, any n, needs a division.
+        struct modulo {
+            static constexpr hash_type reduce(hash_type h, utb::size_t n) { return h % n; }
+        };
+
+        /// h & (n - 1), n must be a power of two, uses the low bits of the hash.
+        struct mask {
+            static constexpr hash_type reduce(hash_type h, utb::size_t n) { return h & (n - 1); }
+        };
+
+        /**
+         * @brief Lemire's fastrange: the high half of h * n, any n, uses the high bits of the hash.
+         * 64 bit hashes are folded to 32 bit first, so n must be below 2^32 (2^16 for 16 bit hash_type).
+         */
+        struct fastrange {
+            static constexpr hash_type reduce(hash_type h, utb::size_t n) {
+                return sizeof(hash_type) <= 2
+                    ? hash_type((uint32_t(uint16_t(h)) * uint32_t(n)) >> 16)
+                    : hash_type((uint64_t(uint32_t(h ^ (uint64_t(h) >> 16 >> 16))) * uint64_t(n)) >> 32);
+            }
+        };
+
+        /// mask for powers of two, fastrange otherwise.
+        struct automatic {
+            static constexpr hash_type reduce(hash_type h, utb::size_t n) {
+                return (n & (n - 1)) == 0 ? mask::reduce(h, n) : fastrange::reduce(h, n);
+            }
+        };
+    }
+
+    /**
+     * @brief Hash a key and reduce it to a bucket index, the THash of basic_hash_table.
+     * @tparam TReduce The reduction, one of utb::hash_reduce.
+     */
+    template <class T, class TReduce = hash_reduce::automatic>
 	struct hash_function {
 		hash_type operator () (T key, size_t maxValue) const noexcept {
-			return utb::hash<T>{}(key) % maxValue;
+			return TReduce::reduce(utb::hash<T>{}(key), maxValue);
 		}
 	};
 
 
-	template <>
-	struct hash_function<const char*> {
+	template <class TReduce>
+	struct hash_function<const char*, TReduce> {
+		hash_type operator () (const char* key, size_t maxValue) const noexcept {
+			return TReduce::reduce(utb::hash<const char*>{}(key), maxValue);
+		}
+	};
+
+	/**
+	 * @brief String hash_function with a selectable algorithm, for the THash of basic_hash_table.
+	 */
+	template <class TAlgorithm = hash_algorithm::default_algorithm, class TReduce = hash_reduce::automatic>
+	struct string_hash_function {
 		hash_type operator () (const char* key, size_t maxValue) const noexcept {
-			return (hash_type) internal::mmh3_x86(key, strlen(key), UTB_CONFIG_BASIC_HASHMUL_VAL);
+			return TReduce::reduce(string_hash<TAlgorithm>{}(key), maxValue);
 		}
 	};
 }
 
-#endif // __UTBHASH_H__
\ No newline at end of file
+#endif // __UTBHASH_H__
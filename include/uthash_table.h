@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_HASH_TABLE_H__
+#define __UT_HASH_TABLE_H__
+
+#include "utconfig.h"
+#include "uttypetraits.h"
+#include "utalgorithm.h"
+#include "uthash.h"
+
+#include <new>
+
+namespace utb {
+
+    /**
+     * @brief Fixed-capacity open-addressing hash table with Robin Hood probing.
+     *
+     * Keys and values are stored in two in-place arrays, next to a control array that holds the
+     * probe distance of every slot (0 = empty, n = n-1 slots away from the home slot). Lookups stop
+     * as soon as they reach a slot that is "richer" than the probed key, erase uses backward-shift
+     * deletion, so no tombstones are needed. The table never allocates.
+     *
+     * @tparam TKey The type for the key.
+     * @tparam TValue The type for the value.
+     * @tparam TCapacity The maximal number of entries.
+     * @tparam THash The hasher, called as THash{}(key, TCapacity) and must return the home slot.
+     * @tparam TKeyEqual The key compare functor.
+     */
+    template <class TKey, class TValue, utb::size_t TCapacity,
+              class THash = utb::hash_function<TKey>, class TKeyEqual = utb::equal_to<TKey> >
+    class basic_hash_table {
+        static_assert(TCapacity > 0, "Capacity must be greater than zero.");
+        static_assert(TCapacity < 0xFFFF, "Capacity must be less than 65535.");
+    public:
+        using key_type = TKey;
+        using mapped_type = TValue;
+        using hasher = THash;
+        using key_equal = TKeyEqual;
+
+        using iterator = TValue*;
+        using const_iterator = const TValue*;
+        using size_type = utb::size_t;
+
+        /// The control byte type: uint8_t as long as every probe distance fits in it.
+        using probe_type = typename utb::select<(TCapacity < 0xFF), uint8_t, uint16_t>::result;
+
+        using self_type = basic_hash_table<TKey, TValue, TCapacity, THash, TKeyEqual>;
+
+        basic_hash_table() noexcept
+            : m_sUsed(0) {
+            for (size_type i = 0; i < TCapacity; ++i)
+                m_ayProbe[i] = 0;
+        }
+
+        basic_hash_table(const self_type& other)
+            : m_sUsed(other.m_sUsed) {
+            for (size_type i = 0; i < TCapacity; ++i) {
+                m_ayProbe[i] = other.m_ayProbe[i];
+                if (m_ayProbe[i] != 0) {
+                    new (key_at(i)) key_type(*other.key_at(i));
+                    new (value_at(i)) mapped_type(*other.value_at(i));
+                }
+            }
+        }
+
+        ~basic_hash_table() {
+            clear();
+        }
+
+        self_type& operator=(const self_type& other) {
+            if (this == &other) return *this;
+
+            clear();
+            for (size_type i = 0; i < TCapacity; ++i) {
+                m_ayProbe[i] = other.m_ayProbe[i];
+                if (m_ayProbe[i] != 0) {
+                    new (key_at(i)) key_type(*other.key_at(i));
+                    new (value_at(i)) mapped_type(*other.value_at(i));
+                }
+            }
+            m_sUsed = other.m_sUsed;
+            return *this;
+        }
+
+        /**
+         * @brief Destroy all entries.
+         */
+        void clear() {
+            for (size_type i = 0; i < TCapacity; ++i) {
+                if (m_ayProbe[i] != 0) {
+                    utb::destruct(key_at(i));
+                    utb::destruct(value_at(i));
+                    m_ayProbe[i] = 0;
+                }
+            }
+            m_sUsed = 0;
+        }
+
+        /**
+         * @brief Finds an element with key equivalent to key.
+         * @param tKey The key value of the element to search for.
+         * @return Pointer to the value for this key, nullptr if the key does not exist.
+         */
+        iterator find(const key_type& tKey) noexcept {
+            size_type _index;
+            return lookup(tKey, _index) ? value_at(_index) : nullptr;
+        }
+
+        /**
+         * @brief Finds an element with key equivalent to key.
+         * @param tKey The key value of the element to search for.
+         * @return Pointer to the value for this key, nullptr if the key does not exist.
+         */
+        const_iterator find(const key_type& tKey) const noexcept {
+            size_type _index;
+            return lookup(tKey, _index) ? value_at(_index) : nullptr;
+        }
+
+        /**
+         * @brief Inserts tValue for tKey, if there is no element with this key.
+         * @param tKey The key to insert.
+         * @param tValue The value to insert.
+         * @param bInserted Set to true when the insertion took place.
+         * @return Pointer to the inserted value or to the value that prevented the insertion,
+         * nullptr when the table is full.
+         */
+        iterator insert(const key_type& tKey, const mapped_type& tValue, bool& bInserted) {
+            return insert_slot(tKey, tValue, bInserted);
+        }
+
+        /**
+         * @brief Inserts tValue for tKey by move, if there is no element with this key.
+         * @param bInserted Set to true when the insertion took place, tKey and tValue are moved from only then.
+         * @return Pointer to the inserted value or to the value that prevented the insertion,
+         * nullptr when the table is full.
+         */
+        iterator insert(key_type&& tKey, mapped_type&& tValue, bool& bInserted) {
+            return insert_slot(utb::move(tKey), utb::move(tValue), bInserted);
+        }
+
+        /**
+         * @brief Inserts tValue for tKey, if there is no element with this key.
+         * @return Pointer to the inserted value or to the value that prevented the insertion,
+         * nullptr when the table is full.
+         */
+        iterator insert(const key_type& tKey, const mapped_type& tValue) {
+            bool _inserted;
+            return insert(tKey, tValue, _inserted);
+        }
+
+        /**
+         * @brief Inserts tValue for tKey or overwrite the value when the key already exists.
+         * @return Pointer to the value, nullptr when the table is full.
+         */
+        iterator insert_or_assign(const key_type& tKey, const mapped_type& tValue) {
+            bool _inserted;
+            iterator _it = insert(tKey, tValue, _inserted);
+
+            if (_it != nullptr && !_inserted) *_it = tValue;
+            return _it;
+        }
+
+        /**
+         * @brief Removes the element with the key equivalent to tKey.
+         * @param tKey value of the elements to remove.
+         * @return Number of elements removed (0 or 1).
+         */
+        size_type erase(const key_type& tKey) {
+            size_type _index;
+            if (!lookup(tKey, _index)) return 0;
+
+            remove_at(_index);
+            return 1;
+        }
+
+        /**
+         * @brief Removes the element that pos points to.
+         * @param pos Pointer to the value of the element, as returned from find.
+         * @return Pointer to the first element at or behind the slot of pos, in slot order,
+         * nullptr when there is none or pos is not an element.
+         */
+        iterator erase(const_iterator pos) {
+            if (pos < value_at(0) || pos >= value_at(0) + TCapacity) return nullptr;
+
+            const size_type _index = size_type(pos - value_at(0));
+            if (m_ayProbe[_index] == 0) return nullptr;
+
+            remove_at(_index);
+            return first_used(_index);
+        }
+
+        /**
+         * @brief Removes every element whose slot lies in [first, last).
+         * @return Pointer to the first element at or behind the slot of first, in slot order,
+         * nullptr when there is none.
+         */
+        iterator erase(const_iterator first, const_iterator last) {
+            if (first < value_at(0)) first = value_at(0);
+            if (last > value_at(0) + TCapacity) last = value_at(0) + TCapacity;
+            if (first >= last) return nullptr;
+
+            const size_type _first = size_type(first - value_at(0));
+            const size_type _last = size_type(last - value_at(0));
+
+            for (size_type i = _first; i < _last; ++i) {
+                if (m_ayProbe[i] != 0) {
+                    utb::destruct(key_at(i));
+                    utb::destruct(value_at(i));
+                    m_ayProbe[i] = 0;
+                    --m_sUsed;
+                }
+            }
+
+            // Erasing slot by slot would shift followers into the range, so close the gap at once:
+            // re-seat every displaced follower behind it, each one lands at or before its old slot
+            size_type _index = (_last == TCapacity) ? 0 : _last;
+            while (m_ayProbe[_index] > 1) {
+                key_type _key(utb::move(*key_at(_index)));
+                mapped_type _value(utb::move(*value_at(_index)));
+
+                utb::destruct(key_at(_index));
+                utb::destruct(value_at(_index));
+                m_ayProbe[_index] = 0;
+                --m_sUsed;
+
+                bool _inserted;
+                insert_slot(utb::move(_key), utb::move(_value), _inserted);
+                _index = next(_index);
+            }
+            return first_used(_first);
+        }
+
+        /**
+         * @brief Call fn(key, value) for every entry in slot order.
+         */
+        template <class TFn>
+        void foreach(TFn fn) {
+            for (size_type i = 0; i < TCapacity; ++i) {
+                if (m_ayProbe[i] != 0) fn(*key_at(i), *value_at(i));
+            }
+        }
+
+        size_type count(const key_type& tKey) const {
+            return (find(tKey) != nullptr) ? 1 : 0;
+        }
+
+        void swap(self_type& other) {
+            self_type _tmp(other);
+            other = *this;
+            *this = _tmp;
+        }
+
+        constexpr bool empty() const noexcept           { return m_sUsed == 0; }
+        constexpr bool full() const noexcept            { return m_sUsed == TCapacity; }
+        constexpr size_type size() const noexcept       { return m_sUsed; }
+        constexpr size_type capacity() const noexcept   { return TCapacity; }
+
+    private:
+        size_type home_of(const key_type& tKey) const noexcept {
+            return size_type(hasher()(tKey, TCapacity));
+        }
+
+        static constexpr size_type next(size_type index) noexcept {
+            return (index + 1 == TCapacity) ? 0 : index + 1;
+        }
+
+        bool lookup(const key_type& tKey, size_type& index) const noexcept {
+            index = home_of(tKey);
+            probe_type _dist = 1;
+
+            while (m_ayProbe[index] >= _dist) {
+                if (m_ayProbe[index] == _dist && key_equal()(*key_at(index), tKey))
+                    return true;
+
+                index = next(index); ++_dist;
+            }
+            return false;
+        }
+
+        template <class TK, class TV>
+        iterator insert_slot(TK&& tKey, TV&& tValue, bool& bInserted) {
+            bInserted = false;
+
+            size_type _index = home_of(tKey);
+            probe_type _dist = 1;
+
+            // Lookup phase: a Robin Hood chain ends at the first slot that is closer to its home
+            while (m_ayProbe[_index] >= _dist) {
+                if (m_ayProbe[_index] == _dist && key_equal()(*key_at(_index), tKey))
+                    return value_at(_index);
+
+                _index = next(_index); ++_dist;
+            }
+            if (full()) return nullptr;
+
+            iterator _result = value_at(_index);
+
+            if (m_ayProbe[_index] == 0) {
+                new (key_at(_index)) key_type(utb::forward<TK>(tKey));
+                new (value_at(_index)) mapped_type(utb::forward<TV>(tValue));
+                m_ayProbe[_index] = _dist;
+            } else {
+                // Take the slot from the richer entry and push the evicted one forward
+                key_type _carryKey = utb::move(*key_at(_index));
+                mapped_type _carryValue = utb::move(*value_at(_index));
+                probe_type _carryDist = m_ayProbe[_index];
+
+                *key_at(_index) = utb::forward<TK>(tKey);
+                *value_at(_index) = utb::forward<TV>(tValue);
+                m_ayProbe[_index] = _dist;
+
+                _index = next(_index); ++_carryDist;
+
+                while (m_ayProbe[_index] != 0) {
+                    if (m_ayProbe[_index] < _carryDist) {
+                        utb::swap(_carryKey, *key_at(_index));
+                        utb::swap(_carryValue, *value_at(_index));
+                        utb::swap(_carryDist, m_ayProbe[_index]);
+                    }
+                    _index = next(_index); ++_carryDist;
+                }
+                new (key_at(_index)) key_type(utb::move(_carryKey));
+                new (value_at(_index)) mapped_type(utb::move(_carryValue));
+                m_ayProbe[_index] = _carryDist;
+            }
+
+            ++m_sUsed;
+            bInserted = true;
+            return _result;
+        }
+
+        iterator first_used(size_type index) noexcept {
+            for (; index < TCapacity; ++index) {
+                if (m_ayProbe[index] != 0) return value_at(index);
+            }
+            return nullptr;
+        }
+
+        void remove_at(size_type index) {
+            size_type _next = next(index);
+
+            // Backward shift: pull every displaced follower one slot closer to its home
+            while (m_ayProbe[_next] > 1) {
+                *key_at(index) = utb::move(*key_at(_next));
+                *value_at(index) = utb::move(*value_at(_next));
+                m_ayProbe[index] = m_ayProbe[_next] - 1;
+
+                index = _next;
+                _next = next(_next);
+            }
+            utb::destruct(key_at(index));
+            utb::destruct(value_at(index));
+            m_ayProbe[index] = 0;
+            --m_sUsed;
+        }
+
+        key_type* key_at(size_type i) noexcept                  { return reinterpret_cast<key_type*>(&m_ayKeys[i]); }
+        const key_type* key_at(size_type i) const noexcept      { return reinterpret_cast<const key_type*>(&m_ayKeys[i]); }
+        mapped_type* value_at(size_type i) noexcept             { return reinterpret_cast<mapped_type*>(&m_ayValues[i]); }
+        const mapped_type* value_at(size_type i) const noexcept { return reinterpret_cast<const mapped_type*>(&m_ayValues[i]); }
+
+    private:
+        probe_type m_ayProbe[TCapacity];
+        utb::aligned_storage_t<sizeof(key_type), alignof(key_type)> m_ayKeys[TCapacity];
+        utb::aligned_storage_t<sizeof(mapped_type), alignof(mapped_type)> m_ayValues[TCapacity];
+        size_type m_sUsed;
+    };
+
+    template <class TKey, class TValue, utb::size_t TCapacity>
+    using hash_table = basic_hash_table<TKey, TValue, TCapacity>;
+}
+
+#endif
@@ -1,4 +1,3 @@
-
 /*
  * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
  * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
@@ -15,123 +14,331 @@
 #include "utalgorithm.h"
 
 namespace utb {
-    template<typename T, utb::size_t N, bool IsIntegral = utb::is_integral<T>::value>
+    namespace internal {
+
+        /// Accumulator types of the history: wide integers for integral samples, T for floats.
+        template<typename T, bool IsFloat = utb::is_floating_point<T>::value>
+        struct history_traits {
+            using sum_type = typename utb::select<(sizeof(T) == 1),
+                                typename utb::select<utb::is_signed<T>::value, int32_t, uint32_t>::result,
+                                typename utb::select<utb::is_signed<T>::value, int64_t, uint64_t>::result>::result;
+            using square_type = typename utb::select<(sizeof(T) <= 2), uint64_t, double>::result;
+            using real_type = double;
+        };
+
+        template<typename T>
+        struct history_traits<T, true> {
+            using sum_type = T;
+            using square_type = T;
+            using real_type = T;
+        };
+
+        /// Fixed-size ring of slot indices, used as monotonic deque for the sliding min/max.
+        template<utb::size_t N>
+        class history_index_ring {
+        public:
+            using size_type = utb::size_t;
+
+            history_index_ring() : m_sFront(0), m_sCount(0) { }
+
+            bool empty() const          { return m_sCount == 0; }
+            size_type front() const     { return m_ayIndex[m_sFront]; }
+            size_type back() const      { return m_ayIndex[wrap(m_sFront + m_sCount - 1)]; }
+
+            void pop_front()            { m_sFront = wrap(m_sFront + 1); --m_sCount; }
+            void pop_back()             { --m_sCount; }
+            void push_back(size_type i) { m_ayIndex[wrap(m_sFront + m_sCount)] = i; ++m_sCount; }
+            void clear()                { m_sFront = 0; m_sCount = 0; }
+
+        private:
+            static constexpr size_type wrap(size_type i) { return i >= N ? i - N : i; }
+        private:
+            size_type m_ayIndex[N];
+            size_type m_sFront;
+            size_type m_sCount;
+        };
+
+        /**
+         * @brief Optional running statistics of history: sum of squares for the variance and an
+         * exponential moving average with alpha = 1 / 2^shift.
+         *
+         * Float samples are squared around a shift near the window mean, E[x^2] - mean^2 of the raw
+         * values cancels to nothing for a large offset (1000 + noise in float).
+         */
+        template<typename T, bool TEnabled>
+        class history_statistics {
+        public:
+            using traits = history_traits<T>;
+            using square_type = typename traits::square_type;
+            using real_type = typename traits::real_type;
+            using sum_type = typename traits::sum_type;
+
+            history_statistics() : m_vSquares(0), m_vShift(0), m_vEma(0), m_iEmaShift(3), m_bEmaValid(false), m_bShiftValid(false) { }
+
+            /**
+             * @brief Set the smoothing of ema(), alpha = 1 / 2^shift.
+             */
+            void set_ema_shift(uint8_t shift) { m_iEmaShift = shift; m_bEmaValid = false; }
+
+            /**
+             * @brief Get the exponential moving average over all pushed samples.
+             */
+            T ema() const { return ema_value(utb::int_to_type<utb::is_floating_point<T>::value>()); }
+
+        protected:
+            void on_push(const T& v, const T* pRemoved) {
+                // integral samples keep the shift 0, their squares are exact
+                if (!m_bShiftValid && utb::is_floating_point<T>::value) { m_vShift = v; m_bShiftValid = true; }
+
+                if (pRemoved) m_vSquares -= square(T(*pRemoved - m_vShift));
+                m_vSquares += square(T(v - m_vShift));
+                update_ema(v, utb::int_to_type<utb::is_floating_point<T>::value>());
+            }
+            void on_clear() { m_vSquares = 0; m_vShift = 0; m_vEma = 0; m_bEmaValid = false; m_bShiftValid = false; }
+
+            /// Rebuild the squares around the current mean, with the float resync of the sum.
+            void on_resync(const T* data, utb::size_t n, sum_type sum) {
+                m_vShift = T(sum / sum_type(n));
+                m_vSquares = 0;
+                for (utb::size_t i = 0; i < n; ++i) m_vSquares += square(T(data[i] - m_vShift));
+            }
+
+            real_type variance_of(real_type sum, utb::size_t n) const {
+                if (n == 0) return real_type(0);
+                const real_type _mean = (sum - real_type(n) * real_type(m_vShift)) / real_type(n);
+                const real_type _var = real_type(m_vSquares) / real_type(n) - _mean * _mean;
+                return _var < real_type(0) ? real_type(0) : _var;
+            }
+
+        private:
+            static square_type square(const T& v) {
+                return square_type(v) * square_type(v);
+            }
+
+            void update_ema(const T& v, utb::int_to_type<false>) {
+                // m_vEma holds ema << shift: acc += v - acc / 2^shift
+                if (!m_bEmaValid) { m_vEma = sum_type(v) * (sum_type(1) << m_iEmaShift); m_bEmaValid = true; return; }
+                m_vEma += sum_type(v) - (m_vEma >> m_iEmaShift);
+            }
+            void update_ema(const T& v, utb::int_to_type<true>) {
+                if (!m_bEmaValid) { m_vEma = v; m_bEmaValid = true; return; }
+                m_vEma += (v - m_vEma) / T(uint32_t(1) << m_iEmaShift);
+            }
+            T ema_value(utb::int_to_type<false>) const  { return T(m_vEma >> m_iEmaShift); }
+            T ema_value(utb::int_to_type<true>) const   { return m_vEma; }
+
+        private:
+            square_type m_vSquares;
+            T m_vShift;
+            typename utb::select<utb::is_floating_point<T>::value, T, sum_type>::result m_vEma;
+            uint8_t m_iEmaShift;
+            bool m_bEmaValid;
+            bool m_bShiftValid;
+        };
+
+        template<typename T>
+        class history_statistics<T, false> {
+        protected:
+            using real_type = typename history_traits<T>::real_type;
+
+            void on_push(const T&, const T*) { }
+            void on_clear() { }
+            template <typename TSum>
+            void on_resync(const T*, utb::size_t, TSum) { }
+        };
+    }
+
+    /**
+     * @brief A fixed-size sliding window over the last N samples.
+     *
+     * The samples are kept in a ring, push() only moves the write index. Index 0 is the newest
+     * sample and size() - 1 the oldest.
+     *
+     * @tparam T The sample type.
+     * @tparam N The window size.
+     * @tparam IsIntegral True for arithmetic samples: adds O(1) average() (running sum) and
+     *  sliding-window min()/max() (monotonic deques).
+     * @tparam TStatistics Only for arithmetic samples, adds O(1) variance() and ema().
+     */
+    template<typename T, utb::size_t N,
+             bool IsIntegral = utb::is_integral<T>::value || utb::is_floating_point<T>::value,
+             bool TStatistics = false>
     class history;
 
-    template<typename T, utb::size_t N>
-    class history<T, N, true> {
+    template<typename T, utb::size_t N, bool TStatistics>
+    class history<T, N, true, TStatistics> : public internal::history_statistics<T, TStatistics> {
+        static_assert(N > 0, "Size must be greater than zero.");
+
+        using base_type = internal::history_statistics<T, TStatistics>;
+        using traits = internal::history_traits<T>;
     public:
         using value_type = T;
         using pointer = T*;
         using const_pointer = const T*;
         using reference_type = T&;
         using const_reference_type = const T&;
-        using self_type = history<T, N, true>;
+        using self_type = history<T, N, true, TStatistics>;
         using size_type = utb::size_t;
+        using sum_type = typename traits::sum_type;
+        using real_type = typename traits::real_type;
 
-        constexpr history() : 
-            m_vMin(utb::numeric_limits<T>::max()), 
-            m_vMax(utb::numeric_limits<T>::min())   { 
-
-            utb::fill(m_data, m_data + N, 0);
+        history() : m_sHead(0), m_sSize(0), m_vSum(0) {
+            utb::fill(m_data, m_data + N, value_type(0));
         }
 
-        constexpr void push(const_reference_type v) {
-                // Array nach rechts schieben
-            for (size_type i = N - 1; i > 0; --i)
-                m_data[i] = m_data[i - 1];
+        void push(const_reference_type v) {
+            const size_type _slot = m_sHead;
+            const_pointer _removed = nullptr;
+
+            // The sample in _slot leaves the window, drop it from the deques and the sum
+            if (m_sSize == N) {
+                _removed = &m_data[_slot];
+                m_vSum -= sum_type(m_data[_slot]);
 
-            // Neuer Wert an Position 0
-            m_data[0] = v;
+                if (m_minIndex.front() == _slot) m_minIndex.pop_front();
+                if (m_maxIndex.front() == _slot) m_maxIndex.pop_front();
+            }
+            while (!m_minIndex.empty() && !(m_data[m_minIndex.back()] < v)) m_minIndex.pop_back();
+            while (!m_maxIndex.empty() && !(v < m_data[m_maxIndex.back()])) m_maxIndex.pop_back();
 
-            // Min/Max aktualisieren
-            if ( v < m_vMin) m_vMin = v;
-            if ( v > m_vMax) m_vMax = v;
+            base_type::on_push(v, _removed);
+
+            m_data[_slot] = v;
+            m_minIndex.push_back(_slot);
+            m_maxIndex.push_back(_slot);
+            m_vSum += sum_type(v);
+
+            m_sHead = (_slot + 1 == N) ? 0 : _slot + 1;
+            if (m_sSize < N) ++m_sSize;
+
+            resync(utb::int_to_type<utb::is_floating_point<T>::value>());
         }
 
+        void clear() {
+            m_sHead = 0; m_sSize = 0; m_vSum = 0;
+            m_minIndex.clear(); m_maxIndex.clear();
+            base_type::on_clear();
+        }
+
+        constexpr size_type size() const { return m_sSize; }
+        constexpr bool empty() const { return m_sSize == 0; }
+        constexpr bool full() const { return m_sSize == N; }
+
         // Neuester Wert
-        constexpr const_reference_type current() const {
-            return m_data[0];
+        const_reference_type current() const {
+            return (*this)[0];
         }
 
         // Wert davor
-        constexpr const_reference_type latest() const {
-            return m_data[1];
+        const_reference_type latest() const {
+            return (*this)[1];
         }
 
         // Ältester Wert
-        constexpr const_reference_type oldest() const {
-            return m_data[N - 1];
+        const_reference_type oldest() const {
+            return (*this)[m_sSize == 0 ? 0 : m_sSize - 1];
         }
 
-        constexpr value_type min() const { return m_vMin; }
-        constexpr value_type max() const { return m_vMax; }
+        /// Smallest sample in the window.
+        value_type min() const { return m_sSize ? m_data[m_minIndex.front()] : value_type(0); }
+        /// Largest sample in the window.
+        value_type max() const { return m_sSize ? m_data[m_maxIndex.front()] : value_type(0); }
 
-        constexpr value_type average() const {
-            value_type sum = 0;
+        /// Sum of the samples in the window.
+        sum_type sum() const { return m_vSum; }
 
-            for (size_type i = 0; i < N; ++i) {
-                sum += m_data[i];
-            }
-            return sum / N;
+        /// Average of the samples in the window.
+        value_type average() const {
+            return m_sSize ? value_type(m_vSum / sum_type(m_sSize)) : value_type(0);
+        }
+
+        /// Population variance of the samples in the window, needs TStatistics.
+        real_type variance() const {
+            static_assert(TStatistics, "variance() needs TStatistics = true");
+            return base_type::variance_of(real_type(m_vSum), m_sSize);
+        }
+
+        const_reference_type operator[](size_type i) const {
+            return m_data[slot(i)];
+        }
+
+    private:
+        /// Slot of the i-th newest sample.
+        size_type slot(size_type i) const {
+            return (m_sHead + N - 1 - i) % N;
         }
 
-        constexpr const_reference_type operator[](size_type i) const {
-            return m_data[i];
+        void resync(utb::int_to_type<false>) { }
+
+        /// Float sums drift, rebuild the sum and the squares once per window turn: amortized O(1).
+        void resync(utb::int_to_type<true>) {
+            if (m_sHead != 0 || m_sSize != N) return;
+
+            m_vSum = 0;
+            for (size_type i = 0; i < N; ++i) m_vSum += m_data[i];
+            base_type::on_resync(m_data, N, m_vSum);
         }
 
     private:
         value_type m_data[N];
-        value_type m_vMin;
-        value_type m_vMax;
+        internal::history_index_ring<N> m_minIndex;
+        internal::history_index_ring<N> m_maxIndex;
+        size_type m_sHead;
+        size_type m_sSize;
+        sum_type m_vSum;
     };
 
-    template<typename T, utb::size_t N>
-    class history<T, N, false> {
+    template<typename T, utb::size_t N, bool TStatistics>
+    class history<T, N, false, TStatistics> {
+        static_assert(N > 0, "Size must be greater than zero.");
     public:
-         using value_type = T;
+        using value_type = T;
         using pointer = T*;
         using const_pointer = const T*;
         using reference_type = T&;
         using const_reference_type = const T&;
-        using self_type = history<T, N, false>;
+        using self_type = history<T, N, false, TStatistics>;
         using size_type = utb::size_t;
 
-        constexpr history()  { }
+        history() : m_sHead(0), m_sSize(0) { }
 
-        constexpr void push(const_reference_type v) {
-                // Array nach rechts schieben
-            for (size_type i = N - 1; i > 0; --i)
-                m_data[i] = m_data[i - 1];
+        void push(const_reference_type v) {
+            m_data[m_sHead] = v;
 
-            // Neuer Wert an Position 0
-            m_data[0] = v;
+            m_sHead = (m_sHead + 1 == N) ? 0 : m_sHead + 1;
+            if (m_sSize < N) ++m_sSize;
         }
 
-        constexpr size_type size() const { return m_count; }
+        void clear() { m_sHead = 0; m_sSize = 0; }
+
+        constexpr size_type size() const { return m_sSize; }
+        constexpr bool empty() const { return m_sSize == 0; }
+        constexpr bool full() const { return m_sSize == N; }
 
         // Neuester Wert
-        constexpr const_reference_type current() const {
-            return m_data[0];
+        const_reference_type current() const {
+            return (*this)[0];
         }
 
         // Wert davor
-        constexpr const_reference_type lastest() const {
-            return m_data[1];
+        const_reference_type lastest() const {
+            return (*this)[1];
         }
 
         // Ältester Wert
-        constexpr const_reference_type oldest() const {
-            return m_data[m_count - 1];
+        const_reference_type oldest() const {
+            return (*this)[m_sSize == 0 ? 0 : m_sSize - 1];
         }
 
-        constexpr const_reference_type operator[](size_type i) const {
-            return m_data[i];
+        const_reference_type operator[](size_type i) const {
+            return m_data[(m_sHead + N - 1 - i) % N];
         }
 
     private:
         value_type m_data[N];
+        size_type m_sHead;
+        size_type m_sSize;
     };
 }
 
-#endif
\ No newline at end of file
+#endif
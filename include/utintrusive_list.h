@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_INTRUSIVE_LIST_H__
+#define __UT_INTRUSIVE_LIST_H__
+
+#include "utconfig.h"
+#include "utalgorithm.h"
+
+namespace utb {
+
+    /**
+     * @brief The links of an element in a basic_intrusive_list, embedded in the element as member
+     * or base class. An element can be in as many lists as it has hooks.
+     */
+    class intrusive_list_hook {
+        template <typename, class> friend class basic_intrusive_list;
+        template <typename, class> friend class basic_intrusive_list_iterator;
+    public:
+        intrusive_list_hook() noexcept : m_pNext(nullptr), m_pPrev(nullptr) { }
+
+        /// A hook is never copied, a copied element is not in the list of the original.
+        intrusive_list_hook(const intrusive_list_hook&) noexcept : m_pNext(nullptr), m_pPrev(nullptr) { }
+        intrusive_list_hook& operator=(const intrusive_list_hook&) noexcept { return *this; }
+
+        ~intrusive_list_hook()                                  { assert(!is_linked()); }
+
+        bool is_linked() const noexcept                         { return m_pNext != nullptr; }
+
+    private:
+        void link_before(intrusive_list_hook* pos) noexcept {
+            m_pNext = pos;
+            m_pPrev = pos->m_pPrev;
+            pos->m_pPrev->m_pNext = this;
+            pos->m_pPrev = this;
+        }
+        void unlink() noexcept {
+            m_pPrev->m_pNext = m_pNext;
+            m_pNext->m_pPrev = m_pPrev;
+            m_pNext = m_pPrev = nullptr;
+        }
+
+        intrusive_list_hook* m_pNext;
+        intrusive_list_hook* m_pPrev;
+    };
+
+    /**
+     * @brief Hook access for elements that derive from intrusive_list_hook.
+     */
+    template <typename T>
+    struct intrusive_base_hook {
+        static intrusive_list_hook* to_hook(T* p) noexcept                   { return static_cast<intrusive_list_hook*>(p); }
+        static T* to_value(intrusive_list_hook* h) noexcept                  { return static_cast<T*>(h); }
+    };
+
+    /**
+     * @brief Hook access for elements with an intrusive_list_hook member THook.
+     */
+    template <typename T, intrusive_list_hook T::*THook>
+    struct intrusive_member_hook {
+        static intrusive_list_hook* to_hook(T* p) noexcept                   { return &(p->*THook); }
+        static T* to_value(intrusive_list_hook* h) noexcept {
+            return reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(h) - offset());
+        }
+    private:
+        /// The offset of the hook, THook applied to an aligned dummy address that is never read,
+        /// so it costs no static object of sizeof(T) and folds to a constant.
+        static utb::size_t offset() noexcept {
+            T* const _t = reinterpret_cast<T*>(uintptr_t(alignof(T)));
+            return utb::size_t(reinterpret_cast<unsigned char*>(&(_t->*THook)) - reinterpret_cast<unsigned char*>(_t));
+        }
+    };
+
+    template <typename T, class THookAccess>
+    class basic_intrusive_list_iterator {
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using reference = T&;
+        using difference_type = ptrdiff_t;
+        using self_type = basic_intrusive_list_iterator<T, THookAccess>;
+
+        basic_intrusive_list_iterator() noexcept : m_pHook(nullptr) { }
+        explicit basic_intrusive_list_iterator(intrusive_list_hook* h) noexcept : m_pHook(h) { }
+
+        reference operator*() const                             { return *THookAccess::to_value(m_pHook); }
+        pointer operator->() const                              { return THookAccess::to_value(m_pHook); }
+
+        self_type& operator++()                                 { m_pHook = m_pHook->m_pNext; return *this; }
+        self_type& operator--()                                 { m_pHook = m_pHook->m_pPrev; return *this; }
+        self_type operator++(int)                               { self_type _copy(*this); ++(*this); return _copy; }
+        self_type operator--(int)                               { self_type _copy(*this); --(*this); return _copy; }
+
+        bool operator==(const self_type& rhs) const             { return m_pHook == rhs.m_pHook; }
+        bool operator!=(const self_type& rhs) const             { return m_pHook != rhs.m_pHook; }
+
+        intrusive_list_hook* hook() const                       { return m_pHook; }
+
+    private:
+        template <typename, class> friend class basic_intrusive_list;
+
+        intrusive_list_hook* m_pHook;
+    };
+
+    /**
+     * @brief Intrusive doubly linked list: the links live in the elements, the list never
+     * allocates.
+     *
+     * The list is circular around a sentinel hook inside the list object, so front(), back(),
+     * push/pop at both ends, erase of a known element and splice are O(1), and so is size().
+     * The list does not own the elements; they must stay alive while linked and be erased before
+     * they are destroyed (checked by an assert in the hook).
+     * @code
+     * struct timer { utb::intrusive_list_hook hook; uint32_t due; };
+     * utb::intrusive_list<timer, &timer::hook> pending;
+     *
+     * pending.push_back(t);
+     * pending.erase(t);
+     * @endcode
+     *
+     * @tparam T The element type.
+     * @tparam THookAccess intrusive_base_hook<T> or intrusive_member_hook<T, &T::hook>.
+     */
+    template <typename T, class THookAccess = intrusive_base_hook<T> >
+    class basic_intrusive_list {
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using reference = T&;
+        using const_reference = const T&;
+        using size_type = utb::size_t;
+        using iterator = basic_intrusive_list_iterator<T, THookAccess>;
+        using self_type = basic_intrusive_list<T, THookAccess>;
+
+        basic_intrusive_list() noexcept : m_sSize(0) {
+            m_head.m_pNext = m_head.m_pPrev = &m_head;
+        }
+
+        ~basic_intrusive_list() {
+            clear();
+            m_head.m_pNext = m_head.m_pPrev = nullptr;
+        }
+
+        basic_intrusive_list(const self_type&) = delete;
+        self_type& operator=(const self_type&) = delete;
+
+        void push_front(reference v)                            { insert(begin(), v); }
+        void push_back(reference v)                             { insert(end(), v); }
+
+        void pop_front()                                        { assert(!empty()); erase(begin()); }
+        void pop_back()                                         { assert(!empty()); erase(iterator(m_head.m_pPrev)); }
+
+        reference front()                                       { return *THookAccess::to_value(m_head.m_pNext); }
+        reference back()                                        { return *THookAccess::to_value(m_head.m_pPrev); }
+
+        /**
+         * @brief Link v before pos, v must not be linked.
+         * @return The iterator to v.
+         */
+        iterator insert(iterator pos, reference v) {
+            intrusive_list_hook* _hook = THookAccess::to_hook(&v);
+            assert(!_hook->is_linked());
+
+            _hook->link_before(pos.m_pHook);
+            ++m_sSize;
+            return iterator(_hook);
+        }
+
+        /**
+         * @brief Unlink the element at pos.
+         * @return The iterator to the element after it.
+         */
+        iterator erase(iterator pos) {
+            intrusive_list_hook* _next = pos.m_pHook->m_pNext;
+            pos.m_pHook->unlink();
+            --m_sSize;
+            return iterator(_next);
+        }
+
+        /**
+         * @brief Unlink v, which must be in this list.
+         */
+        void erase(reference v)                                 { erase(iterator_to(v)); }
+
+        /**
+         * @brief Move all elements of other before pos, O(1).
+         */
+        void splice(iterator pos, self_type& other) {
+            if (other.empty() || &other == this) return;
+
+            intrusive_list_hook* _first = other.m_head.m_pNext;
+            intrusive_list_hook* _last = other.m_head.m_pPrev;
+            intrusive_list_hook* _pos = pos.m_pHook;
+
+            _first->m_pPrev = _pos->m_pPrev;
+            _pos->m_pPrev->m_pNext = _first;
+            _last->m_pNext = _pos;
+            _pos->m_pPrev = _last;
+
+            m_sSize += other.m_sSize;
+            other.m_head.m_pNext = other.m_head.m_pPrev = &other.m_head;
+            other.m_sSize = 0;
+        }
+
+        /**
+         * @brief Move the element it of other before pos; nothing to do when it already is there
+         * (pos == it or pos == next(it)).
+         */
+        void splice(iterator pos, self_type& other, iterator it) {
+            iterator _next = it;
+            if (pos == it || pos == ++_next) return;
+
+            reference _v = *it;
+            other.erase(it);
+            insert(pos, _v);
+        }
+
+        /**
+         * @brief Unlink all elements, O(n).
+         */
+        void clear() {
+            while (!empty()) erase(begin());
+        }
+
+        /// The iterator to v, which must be in a list of this type.
+        static iterator iterator_to(reference v)                { return iterator(THookAccess::to_hook(&v)); }
+
+        iterator begin()                                        { return iterator(m_head.m_pNext); }
+        iterator end()                                          { return iterator(&m_head); }
+
+        size_type size() const noexcept                         { return m_sSize; }
+        bool empty() const noexcept                             { return m_sSize == 0; }
+
+    private:
+        intrusive_list_hook m_head;
+        size_type m_sSize;
+    };
+
+    /**
+     * @brief Intrusive list over the member hook THook of T, or over the base hook of T.
+     */
+    template <typename T, intrusive_list_hook T::*THook = nullptr>
+    using intrusive_list = basic_intrusive_list<T, typename utb::select<THook == nullptr, intrusive_base_hook<T>,
+                                                                        intrusive_member_hook<T, THook> >::result>;
+}
+
+#endif // __UT_INTRUSIVE_LIST_H__
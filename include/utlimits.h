@@ -115,6 +115,7 @@ namespace utb {
 	 */
 	template<>
   	class numeric_limits<char>  {
+	public:
   		using value_type = char;
 
 		static constexpr value_type min()        	{ return value_type(-128); }
@@ -139,6 +140,7 @@ namespace utb {
 	 */
 	template<>
   	class numeric_limits<unsigned char>  {
+	public:
   		using value_type = unsigned char;
 
 		static constexpr value_type min()        	{ return value_type(0U); }
@@ -163,6 +165,7 @@ namespace utb {
 	 */
 	template<>
   	class numeric_limits<signed char>  {
+	public:
   		using value_type = signed char;
 
 		static constexpr value_type min()        	{ return value_type(-128); }
@@ -187,6 +190,7 @@ namespace utb {
 	 */
 	template<>
   	class numeric_limits<short>  {
+	public:
   		using value_type = short;
 
 		static constexpr value_type min()        	{ return value_type(-32768); }
@@ -211,6 +215,7 @@ namespace utb {
 	 */
 	template<>
   	class numeric_limits<unsigned short>  {
+	public:
   		using value_type = unsigned short;
 
 		static constexpr value_type min()        	{ return value_type(0U); }
@@ -235,6 +240,7 @@ namespace utb {
 	 */
 	template<>
   	class numeric_limits<int>  {
+	public:
   		using value_type = int;
 
 		static constexpr value_type min()        	{ return value_type(-2147483648); }
@@ -259,6 +265,7 @@ namespace utb {
 	 */
 	template<>
   	class numeric_limits<unsigned int>  {
+	public:
   		using value_type = unsigned int;
 
 		static constexpr value_type min()        	{ return value_type(0U); }
@@ -283,6 +290,7 @@ namespace utb {
 	 */
 	template<>
   	class numeric_limits<long>  {
+	public:
   		using value_type = long;
 
 		static constexpr value_type min()        	{ return value_type(-9223372036854775807 - 1L); }
@@ -307,6 +315,7 @@ namespace utb {
 	 */
 	template<>
   	class numeric_limits<unsigned long>  {
+	public:
   		using value_type = unsigned long;
 
 		static constexpr value_type min()        	{ return value_type(0U); }
@@ -331,6 +340,7 @@ namespace utb {
 	 */
 	template<>
   	class numeric_limits<long long>  {
+	public:
   		using value_type = long long;
 
 		static constexpr value_type min()        	{ return value_type(-9223372036854775807LL - 1LL); }
@@ -355,6 +365,7 @@ namespace utb {
 	 */
 	template<>
   	class numeric_limits<unsigned long long>  {
+	public:
   		using value_type = unsigned long long;
 
 		static constexpr value_type min()        	{ return value_type(0U); }
@@ -380,6 +391,7 @@ namespace utb {
 	 */
 	template<>
   	class numeric_limits<float> {
+	public:
   		using value_type = float;
 
 		static constexpr value_type min()        	{ return __FLT_MIN__; }
@@ -427,6 +439,7 @@ namespace utb {
 	 */
 	template<>
   	class numeric_limits<double> {
+	public:
   		using value_type = double;
 
 		static constexpr value_type min()        	{ return __DBL_MIN__; }
@@ -473,6 +486,7 @@ namespace utb {
 	 */
 	template<>
   	class numeric_limits<long double> {
+	public:
   		using value_type = long double;
 
 		static constexpr value_type min()        	{ return __LDBL_MIN__; }
@@ -513,6 +527,49 @@ namespace utb {
 
 		static 				value_type round_error() 	{ return value_type(0.5); }
   	};
+
+	namespace fixed_point {
+		template <utb::size_t TIntBits, utb::size_t TFracBits, class TOverflow, class TRounding>
+		class fixed;
+	}
+
+	/**
+	 * @brief Spezial version for utb::fixed (utfixed.h)
+	 */
+	template <utb::size_t I, utb::size_t F, class O, class R>
+  	class numeric_limits<fixed_point::fixed<I, F, O, R>> {
+	public:
+  		using value_type = fixed_point::fixed<I, F, O, R>;
+
+		/// The smallest positive value, like float.
+		static constexpr value_type min()        	{ return value_type::from_raw(1); }
+		static constexpr value_type max()        	{ return value_type::from_raw(value_type::raw_max); }
+
+		static constexpr value_type lowest() 		{ return value_type::from_raw(value_type::raw_min); }
+		static constexpr value_type epsilon() 		{ return value_type::from_raw(1); }
+		static constexpr value_type round_error() 	{ return value_type::from_raw(value_type::rounding ? typename value_type::raw_type(value_type::one / 2) : typename value_type::raw_type(value_type::one)); }
+		static constexpr value_type denorm_min() 	{ return value_type::from_raw(1); }
+		static constexpr value_type infinity() 		{ return value_type::from_raw(0); }
+		static constexpr value_type quiet_NaN() 	{ return value_type::from_raw(0); }
+		static constexpr value_type signaling_NaN() { return value_type::from_raw(0); }
+
+		static constexpr 	int  digits    			= int(I + F - 1);
+		static constexpr 	int  digits10  			= ((digits * 301) / 1000);
+
+    	static constexpr 	bool is_specialized    = true;
+		static constexpr 	bool is_signed         = true;
+		static constexpr 	bool is_integer        = false;
+		static constexpr 	bool is_exact          = true;
+		static constexpr 	int radix              = 2;
+		static constexpr 	bool has_infinity      = false;
+		static constexpr 	bool has_quiet_NaN     = false;
+		static constexpr 	bool has_signaling_NaN = false;
+		static constexpr 	bool is_bounded        = true;
+		static constexpr 	bool is_modulo         = !value_type::saturating;
+		static constexpr 	float_denorm_style has_denorm = float_denorm_style::absent;
+		static constexpr 	float_round_style round_style = value_type::rounding ? float_round_style::to_nearest
+																					 : float_round_style::toward_neg_infinity;
+  	};
 }
 
 #endif
\ No newline at end of file
@@ -10,17 +10,22 @@
 #define __UT_MAP__
 
 #include "utpair.h"
-#include "utvector.h"
+#include "uthash_table.h"
 
 namespace utb {
     /**
      * @brief  Lightweight c++11 dictionary map implementation.
      *
+     * The entries are held by TBackend, by default a fixed-capacity open-addressing hash table
+     * (@see utb::basic_hash_table), so find, insert and erase are O(1) on average.
+     *
      * @tparam TKey The type for the key.
      * @tparam TValue The type for the value.
      * @tparam TMapSize The Max Entry of this map
+     * @tparam TBackend The storage backend, must provide the basic_hash_table interface.
      */
-    template <class TKey, class TValue, utb::size_t TMapSize = UTB_MAX_MAP_ENTRYS>
+    template <class TKey, class TValue, utb::size_t TMapSize = UTB_MAX_MAP_ENTRYS,
+              class TBackend = basic_hash_table<TKey, TValue, TMapSize> >
     class light_map {
     public:
         using mapped_type = TValue;
@@ -38,10 +43,10 @@ namespace utb {
         using iterator = TValue*;
         using const_iterator = const TValue*;
 
-        using self_type = light_map < TKey, TValue, TMapSize>;
+        using backend_type = TBackend;
+        using self_type = light_map < TKey, TValue, TMapSize, TBackend>;
 
-        light_map(const size_type start_size = UTB_MAX_MAP_ENTRYS) noexcept
-            :  m_ayKeyValue(start_size) { }
+        light_map() noexcept { }
 
         ~light_map() {
             m_ayKeyValue.clear();
@@ -54,25 +59,27 @@ namespace utb {
 
         template< class... Args >
         utb::pair<iterator, bool> assign(const key_type& key, Args && ... args) {
-            value_type _value(key, utb::forward<Args>(args)...);
+            const mapped_type _value(utb::forward<Args>(args)...);
 
-            return assign(_value);
+            return assign(key, _value);
         }
 
         utb::pair<iterator, bool> assign(const value_type& vValue) {
-            utb::pair<iterator, bool> _ret(vValue.seconde, false);
-
-            for(typename TContainer::iterator it = m_ayKeyValue.begin();
-                        it != m_ayKeyValue.end(); it++) {
-                value_type _pair = *it;
-
-                if(_pair.first == vValue.first) {
-                    m_ayKeyValue.erase(it);
-                    m_ayKeyValue.insert(vValue);
-                    _ret->second = true;
-                }
-            }
-            return _ret;
+            return assign(vValue.first(), vValue.second());
+        }
+
+        /**
+         * @brief Overwrite the value of an existing key.
+         * @return Returns a pair consisting of an iterator to the element and a bool denoting
+         *	whether the assignment took place (false if the key does not exist).
+            */
+        utb::pair<iterator, bool> assign(const key_type& key, const mapped_type& value) {
+            iterator _it = m_ayKeyValue.find(key);
+
+            if(_it == nullptr) return utb::pair<iterator, bool>(_it, false);
+
+            *_it = value;
+            return utb::pair<iterator, bool>(_it, true);
         }
 
         /**
@@ -86,9 +93,10 @@ namespace utb {
             */
         template< class... Args >
         utb::pair<iterator, bool> emplace(const key_type& key, Args && ... args) {
-            value_type _value = value_type(key, utb::forward<Args>(args)...);
+            bool _inserted;
+            iterator _it = m_ayKeyValue.insert(key, mapped_type(utb::forward<Args>(args)...), _inserted);
 
-            return insert(_value);
+            return utb::pair<iterator, bool>(_it, _inserted);
         }
 
         /**
@@ -98,26 +106,15 @@ namespace utb {
                     prevented the insertion) and a bool denoting whether the insertion took place.
             */
         utb::pair<iterator, bool> insert( const value_type& value ) {
-            utb::pair<iterator, bool> result(&value, false);
+            bool _inserted;
+            iterator _it = m_ayKeyValue.insert(value.first(), value.second(), _inserted);
 
-            if(find(value.first) == nullptr) {
-                m_ayKeyValue.push_back(value);
-                result.second = find(value.first) != nullptr;
-            }
-
-            return result;
+            return utb::pair<iterator, bool>(_it, _inserted);
         }
 
         template< class... Args >
         void insert_or_assign(const key_type& key, Args && ... args) {
-            value_type _value(key, utb::forward<Args>(args)...);
-
-            auto iter = find(key);
-            if(iter == nullptr)
-                insert(_value);
-            else
-                assign(_value);
-
+            m_ayKeyValue.insert_or_assign(key, mapped_type(utb::forward<Args>(args)...));
         }
 
         /**
@@ -127,26 +124,29 @@ namespace utb {
             *	 - False: The key already exists, no change is made
             */
         bool insert(const key_type& key, const mapped_type& value) {
-            return insert(value_type(key, value)).second;
+            bool _inserted;
+            m_ayKeyValue.insert(key, value, _inserted);
+
+            return _inserted;
         }
 
         /**
-         * @brief insert key_type key with mapped_type value.
+         * @brief insert key_type key with mapped_type value, both are moved into the map.
          * @return
          *	 - True: The key doesn't exist, the data is added to the map
             *	 - False: The key already exists, no change is made
             */
         bool insert(key_type&& key, mapped_type&& value) {
-            return insert(value_type( utb::forward(key), utb::forward(value)) ).second;
-        }
-
-
+            bool _inserted;
+            m_ayKeyValue.insert(utb::move(key), utb::move(value), _inserted);
 
+            return _inserted;
+        }
 
         /**
          * @brief Removes specified elements from the container.
          * @param pos Iterator to the element to remove.
-         * @return Return the the last removed iterator.
+         * @return Iterator to the first element at or behind pos in slot order, nullptr if there is none.
          */
         iterator erase( const_iterator pos ) {
             return m_ayKeyValue.erase(pos);
@@ -156,69 +156,35 @@ namespace utb {
          * @brief Removes specified elements from the container.
          * @param first The start of the range of elements to remove.
          * @param last The end of the range of elements to remove.
-         * @return Return the the last removed iterator.
+         * @return Iterator to the first element at or behind first in slot order, nullptr if there is none.
          */
         iterator erase( const_iterator first, const_iterator last ) {
             return m_ayKeyValue.erase(first, last);
         }
+
         /**
          * @brief Removes the element with the key equivalent to tKey.
          * @param tKey value of the elements to remove.
          * @return Number of elements removed (0 or 1).
          */
         size_type erase( const key_type& tKey ) {
-            if(empty()) return 0;
-
-            for(typename TContainer::iterator it = m_ayKeyValue.begin();
-                        it != m_ayKeyValue.end(); it++) {
-                value_type _pair = *it;
-
-                if(_pair.first == tKey) {
-                    utb::destruct<TContainer::iterator>(it);
-                    return 1;
-                }
-            }
-
-            return 0;
+            return m_ayKeyValue.erase(tKey);
         }
         /**
          * @brief Finds an element with key equivalent to key.
          * @param tKey 	The key value of the element to search for.
-         * @return The associerte value with this key, when not exist then return the end();
+         * @return The associerte value with this key, when not exist then return nullptr;
          */
         iterator find(const key_type& tKey) noexcept {
-            if(empty()) return nullptr;
-
-            for(typename TContainer::iterator it = m_ayKeyValue.begin();
-                        it != m_ayKeyValue.end(); it++) {
-                value_type _pair = *it;
-
-                if(_pair.first == tKey) {
-                    return &(_pair.second);
-                }
-            }
-
-            return nullptr;
+            return m_ayKeyValue.find(tKey);
         }
         /**
          * @brief Finds an element with key equivalent to key.
          * @param tKey 	The key value of the element to search for.
-         * @return The associerte value with this key, when not exist then return the
-         * setted alternative value.
+         * @return The associerte value with this key, when not exist then return nullptr;
          */
         const_iterator find(const key_type& tKey) const noexcept {
-            if(empty()) return nullptr;
-
-            for(typename TContainer::iterator it = m_ayKeyValue.begin();
-                        it != m_ayKeyValue.end(); it++) {
-                value_type _pair = *it;
-
-                if(_pair.first == tKey) {
-                    return &(_pair.second);
-                }
-            }
-
-            return nullptr;
+            return m_ayKeyValue.find(tKey);
         }
 
         /**
@@ -226,7 +192,7 @@ namespace utb {
          * @return If true then is the map empty and if false then not.
          */
         constexpr bool empty() const noexcept {
-            return m_ayKeyValue.is_empty();
+            return m_ayKeyValue.empty();
         }
 
         /**
@@ -234,7 +200,7 @@ namespace utb {
          * @return The number of map entries.
          */
         constexpr size_type size() const noexcept {
-            return m_ayKeyValue.get_used();
+            return m_ayKeyValue.size();
         }
 
         /**
@@ -252,14 +218,13 @@ namespace utb {
          * @param other Container to exchange the contents with.
          */
         void swap( self_type& other ) {
-            swap(m_ayKeyValue, other.m_ayKeyValue);
+            m_ayKeyValue.swap(other.m_ayKeyValue);
         }
 
         /**
          * @brief Read value of map for given key.
          * @param tKey The key.
-         * @return The associerte value with this key, when not exist then return the
-         * setted alternative value.
+         * @return The associerte value with this key, when not exist then return nullptr.
          */
         iterator operator[](const key_type& tKey) noexcept {
             return find(tKey);
@@ -267,14 +232,13 @@ namespace utb {
         /**
          * @brief Read value of map for given key.
          * @param tKey The key.
-         * @return The associerte value with this key, when not exist then return the
-         * setted alternative value.
+         * @return The associerte value with this key, when not exist then return nullptr.
          */
         const_iterator operator[](const key_type& tKey) const noexcept {
             return find(tKey);
         }
     private:
-        vector<TPairType, TMapSize> m_ayKeyValue;
+        backend_type m_ayKeyValue;
     };
 
     /**
@@ -11,17 +11,28 @@
 
 #include "utconfig.h"
 #include "utalgorithm.h"
+#include "uttypes.h"
 
 namespace utb {
     namespace math {
+        namespace internal {
+            /// 0! to 20!, all exact in double; 20! is the largest that fits in 64 bits.
+            static constexpr double factorial_table[21] = {
+                1.0, 1.0, 2.0, 6.0, 24.0, 120.0, 720.0, 5040.0, 40320.0, 362880.0, 3628800.0,
+                39916800.0, 479001600.0, 6227020800.0, 87178291200.0, 1307674368000.0,
+                20922789888000.0, 355687428096000.0, 6402373705728000.0, 121645100408832000.0,
+                2432902008176640000.0 };
+        }
+
+        /// p! from a table up to 20!, only larger p multiply the rest.
         template <typename T>
         inline T factorial(T p) {
-            if ( p == 0 || p == 1 ) return 1;
-            else if ( p < 0 ) return 0;
+            if ( p < 0 ) return 0;
+            if ( p <= 20 ) return T(internal::factorial_table[int(p)]);
+
+            T f = T(internal::factorial_table[20]);
+            for(; p > 20; p--) f *= p;
 
-            T f = 1;
-            for(; p > 1; p--) f *= p;
-              
             return f;
         }
         template <typename T>
@@ -68,12 +79,12 @@ namespace utb {
         template <typename T>
         inline T degrees (T radians)
         {
-            return radians * (180/ PI);
+            return radians * T(180 / pi);
         }
         template <typename T>
-        inline float radians (float degrees)
+        inline T radians (T degrees)
         {
-            return degrees * (PI / 180);
+            return degrees * T(pi / 180);
         }
     }
 }
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_MPMC_QUEUE_H__
+#define __UT_MPMC_QUEUE_H__
+
+#include "utconfig.h"
+#if UTB_CONFIG_ENABLE_ATOMIC == UTB_YES
+
+#include "utalgorithm.h"
+#include "atomic/utatomic_types.h"
+
+namespace utb {
+
+    /**
+     * @brief Bounded multi-producer/multi-consumer queue (Vyukov).
+     *
+     * Every slot carries a sequence number. A producer may write slot i when its sequence equals the
+     * enqueue position, a consumer may read it when the sequence equals the dequeue position + 1.
+     * The positions are claimed with a compare-exchange, the slot is handed over with a release
+     * store of the next sequence, so there is no lock and no shared counter besides the two positions.
+     *
+     * @tparam T The element type, must be default constructible and copy assignable.
+     * @tparam TCapacity The number of slots, must be a power of two.
+     */
+    template <typename T, utb::size_t TCapacity>
+    class basic_mpmc_queue {
+        static_assert(TCapacity > 1, "Capacity must be greater than one.");
+        static_assert((TCapacity & (TCapacity - 1)) == 0, "Capacity must be a power of two.");
+    public:
+        using value_type = T;
+        using reference = T&;
+        using const_reference = const T&;
+        using size_type = utb::size_t;
+        using difference_type = ptrdiff_t;
+        using self_type = basic_mpmc_queue<T, TCapacity>;
+
+        using atomic_index = utb::atomic::gcc_atomic_type<size_type>;
+
+        basic_mpmc_queue() noexcept
+            : m_sEnqueuePos(0), m_sDequeuePos(0) {
+            for (size_type i = 0; i < TCapacity; ++i)
+                atomic_index::store(&m_ayCells[i].sequence, i, memory_order::Relaxed);
+        }
+
+        basic_mpmc_queue(const self_type&) = delete;
+        self_type& operator=(const self_type&) = delete;
+
+        /**
+         * @brief Append an element, callable from any number of producers.
+         * @return True when the element was pushed, false when the queue is full.
+         */
+        bool try_push(const_reference value) noexcept {
+            size_type _pos = atomic_index::load(&m_sEnqueuePos, memory_order::Relaxed);
+            cell_type* _cell;
+
+            for (;;) {
+                _cell = &m_ayCells[_pos & mask];
+                const size_type _seq = atomic_index::load(&_cell->sequence, memory_order::Acquire);
+                const difference_type _diff = difference_type(_seq) - difference_type(_pos);
+
+                if (_diff == 0) {
+                    size_type _next = _pos + 1;
+                    if (atomic_index::compare_exchange_n(&m_sEnqueuePos, _pos, _next, true, memory_order::Relaxed))
+                        break;
+                } else if (_diff < 0) {
+                    return false;
+                } else {
+                    _pos = atomic_index::load(&m_sEnqueuePos, memory_order::Relaxed);
+                }
+            }
+            _cell->data = value;
+            atomic_index::store(&_cell->sequence, _pos + 1, memory_order::Release);
+            return true;
+        }
+
+        /**
+         * @brief Remove the oldest element, callable from any number of consumers.
+         * @return True when an element was popped to value, false when the queue is empty.
+         */
+        bool try_pop(reference value) noexcept {
+            size_type _pos = atomic_index::load(&m_sDequeuePos, memory_order::Relaxed);
+            cell_type* _cell;
+
+            for (;;) {
+                _cell = &m_ayCells[_pos & mask];
+                const size_type _seq = atomic_index::load(&_cell->sequence, memory_order::Acquire);
+                const difference_type _diff = difference_type(_seq) - difference_type(_pos + 1);
+
+                if (_diff == 0) {
+                    size_type _next = _pos + 1;
+                    if (atomic_index::compare_exchange_n(&m_sDequeuePos, _pos, _next, true, memory_order::Relaxed))
+                        break;
+                } else if (_diff < 0) {
+                    return false;
+                } else {
+                    _pos = atomic_index::load(&m_sDequeuePos, memory_order::Relaxed);
+                }
+            }
+            value = _cell->data;
+            atomic_index::store(&_cell->sequence, _pos + mask + 1, memory_order::Release);
+            return true;
+        }
+
+        /**
+         * @brief Get the approximate number of elements.
+         */
+        size_type size_approx() const noexcept {
+            const size_type _head = atomic_index::load(const_cast<volatile size_type*>(&m_sDequeuePos), memory_order::Relaxed);
+            const size_type _tail = atomic_index::load(const_cast<volatile size_type*>(&m_sEnqueuePos), memory_order::Relaxed);
+            return (_tail - _head) > TCapacity ? 0 : _tail - _head;
+        }
+
+        bool empty_approx() const noexcept                  { return size_approx() == 0; }
+        constexpr size_type capacity() const noexcept       { return TCapacity; }
+
+    private:
+        static constexpr size_type mask = TCapacity - 1;
+
+        struct cell_type {
+            volatile size_type sequence;
+            value_type data;
+        };
+
+        alignas(UTB_CONFIG_CACHE_LINE_SIZE) cell_type m_ayCells[TCapacity];
+        alignas(UTB_CONFIG_CACHE_LINE_SIZE) volatile size_type m_sEnqueuePos;
+        alignas(UTB_CONFIG_CACHE_LINE_SIZE) volatile size_type m_sDequeuePos;
+    };
+
+    template <typename T, utb::size_t TCapacity>
+    using mpmc_queue = basic_mpmc_queue<T, TCapacity>;
+}
+
+#endif // UTB_CONFIG_ENABLE_ATOMIC
+#endif // __UT_MPMC_QUEUE_H__
@@ -130,17 +130,32 @@ namespace utb {
             reverse_iterator    rend()          { return reverse_iterator( root() ); }
             const_iterator      cend() const    { return const_iterator( last() ); }
 
+            /**
+             * @brief The first node, O(n); walks iteratively and stops on a circular chain.
+             * Use utb::basic_intrusive_list for O(1) ends.
+             */
             self_type*   root() {
-                return (Prev != 0) ? Prev->root() : this;
+                self_type* _node = this;
+                while (_node->Prev != 0 && _node->Prev != this) _node = _node->Prev;
+                return _node;
             }
             const self_type* root() const {
-                return (Prev != 0) ? Prev->root() : this;
+                const self_type* _node = this;
+                while (_node->Prev != 0 && _node->Prev != this) _node = _node->Prev;
+                return _node;
             }
+            /**
+             * @brief The last node, O(n), see root().
+             */
             self_type*   last() {
-                return (Next != 0) ? Next->last() : this;
+                self_type* _node = this;
+                while (_node->Next != 0 && _node->Next != this) _node = _node->Next;
+                return _node;
             }
             const self_type* last() const {
-                return (Next != 0) ? Next->last() : this;
+                const self_type* _node = this;
+                while (_node->Next != 0 && _node->Next != this) _node = _node->Next;
+                return _node;
             }
 
             /**
@@ -216,6 +231,25 @@ namespace utb {
                 pFirst->Prev->Next = pFinal->Next;
             }
 
+            /**
+             * @brief Create a standalone node in an allocator with create()/destroy(), e.g. utb::pool.
+             * @return The node, nullptr when the allocator is exhausted.
+             */
+            template <class TAllocator>
+            static self_type* create(TAllocator& allocator, const value_type& value) {
+                self_type* _node = allocator.create(value);
+                if (_node) _node->Next = _node->Prev = _node;
+                return _node;
+            }
+            /**
+             * @brief Unlink this node and give it back to the allocator it was created in.
+             */
+            template <class TAllocator>
+            void destroy(TAllocator& allocator) {
+                if (Next != 0 && Next != this) remove();
+                allocator.destroy(this);
+            }
+
             value_type get() { return m_tValue; }
 
             bool operator == (const self_type& rhs) const {
@@ -64,7 +64,7 @@ namespace utb {
     	 * @brief Resets the basic_optional.
     	 */
     	void reset() noexcept {
-        	if ( has_value() & utb::is_class<T>::value))
+        	if ( has_value() && utb::is_class<T>::value)
                 	m_tValue.~value_type();
 
         	m_bHasValue = false;
@@ -16,6 +16,7 @@ namespace utb {
 
     template <typename T, typename U, typename = void>
 	class pair  {
+	public:
         using self_type = pair<T, U>;
 
 		using first_type  		 		= typename type_traits<T>::value_type;
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_PERFECT_HASH_H__
+#define __UT_PERFECT_HASH_H__
+
+#include "utconfig.h"
+#include "uthash.h"
+
+namespace utb {
+
+    /// One key of a perfect hash table and the value it maps to.
+    template <typename TValue>
+    struct perfect_hash_entry {
+        const char* key;
+        TValue value;
+    };
+
+    namespace internal {
+        constexpr utb::size_t perfect_hash_pow2(utb::size_t n) {
+            utb::size_t _p = 1;
+            while (_p < n) _p <<= 1;
+            return _p;
+        }
+
+        constexpr bool perfect_hash_equal(const char* a, const char* b) {
+            while (*a && *a == *b) { ++a; ++b; }
+            return *a == *b;
+        }
+
+        constexpr bool perfect_hash_equal(const char* a, const char* b, utb::size_t n) {
+            for (utb::size_t i = 0; i < n; ++i) if (a[i] != b[i] || a[i] == '\0') return false;
+            return b[n] == '\0';
+        }
+
+        /// The slot of a key: its string hash mixed with the displacement of its bucket.
+        constexpr uint32_t perfect_hash_slot(uint32_t h, uint16_t displacement) {
+            uint32_t _x = h ^ (uint32_t(displacement) * 0x9E3779B9U);
+            _x ^= _x >> 16; _x *= 0x7feb352dU;
+            _x ^= _x >> 15; _x *= 0x846ca68bU;
+            _x ^= _x >> 16;
+            return _x;
+        }
+    }
+
+    /**
+     * @brief A collision-free string to value table, built by the compiler from a fixed key set.
+     *
+     * Hash and displace: the keys are spread over TN / 2 buckets, then every bucket, largest first,
+     * gets the smallest displacement that moves all its keys to free slots. A lookup is one pass
+     * over the key (hash_literal), one mix, one table read and one string compare; there is no
+     * probing and no setup at runtime. Declared constexpr the table ends up in .rodata, i.e. in
+     * flash on ARM and ESP32 (on AVR .rodata is copied to RAM).
+     * @code
+     * static constexpr utb::perfect_hash_entry<handler_t> cmds[] = { { "led", &on_led }, { "reset", &on_reset } };
+     * static constexpr auto table = utb::make_perfect_hash(cmds);
+     * static_assert(table.valid(), "duplicate command");
+     *
+     * if (const handler_t* h = table.find(token)) (*h)();
+     * @endcode
+     *
+     * @tparam TValue The mapped type, must be a literal type.
+     * @tparam TN The number of keys.
+     */
+    template <typename TValue, utb::size_t TN>
+    class basic_perfect_hash {
+    public:
+        using value_type = TValue;
+        using entry_type = perfect_hash_entry<TValue>;
+        using size_type = utb::size_t;
+        using index_type = typename utb::select<(TN < 255), uint8_t, uint16_t>::result;
+        using self_type = basic_perfect_hash<TValue, TN>;
+
+        static constexpr size_type slots = internal::perfect_hash_pow2(TN + TN / 2 + 1);
+        static constexpr size_type buckets = internal::perfect_hash_pow2(TN / 2 + 1);
+        static constexpr index_type empty = index_type(~index_type(0));
+        static constexpr uint16_t max_displacement = 0xFFFF;
+
+        constexpr basic_perfect_hash(const entry_type (&entries)[TN])
+            : m_ayEntries(), m_ayDisplacement(), m_aySlots(), m_bValid(true) {
+
+            uint32_t _hashes[TN] = {};
+            size_type _bucketSize[buckets] = {};
+
+            for (size_type i = 0; i < TN; ++i) {
+                m_ayEntries[i] = entries[i];
+                _hashes[i] = hash_literal(entries[i].key);
+                ++_bucketSize[_hashes[i] & (buckets - 1)];
+
+                for (size_type k = 0; k < i; ++k)
+                    if (internal::perfect_hash_equal(entries[k].key, entries[i].key)) m_bValid = false;
+            }
+            for (size_type s = 0; s < slots; ++s) m_aySlots[s] = empty;
+            if (!m_bValid) return;
+
+            // the buckets with the most keys first, they are the hardest to place
+            size_type _order[buckets] = {};
+            for (size_type b = 0; b < buckets; ++b) _order[b] = b;
+            for (size_type b = 0; b < buckets; ++b)
+                for (size_type c = b + 1; c < buckets; ++c)
+                    if (_bucketSize[_order[c]] > _bucketSize[_order[b]]) {
+                        const size_type _t = _order[b]; _order[b] = _order[c]; _order[c] = _t;
+                    }
+
+            for (size_type b = 0; b < buckets && _bucketSize[_order[b]] != 0; ++b) {
+                if (!place_bucket(_order[b], _hashes)) { m_bValid = false; return; }
+            }
+        }
+
+        /**
+         * @brief Find the value of a zero terminated key.
+         * @return The value or nullptr when key is not in the table.
+         */
+        constexpr const TValue* find(const char* key) const {
+            const size_type _i = index_of(key);
+            return _i == TN ? nullptr : &m_ayEntries[_i].value;
+        }
+
+        /**
+         * @brief Find the value of a key given by its first n chars.
+         */
+        constexpr const TValue* find(const char* key, size_type n) const {
+            const size_type _i = index_of(key, n);
+            return _i == TN ? nullptr : &m_ayEntries[_i].value;
+        }
+
+        /**
+         * @brief The position of key in the entry list, size() when key is not in the table.
+         */
+        constexpr size_type index_of(const char* key) const {
+            const size_type _i = candidate(hash_literal(key));
+            return (_i != TN && internal::perfect_hash_equal(m_ayEntries[_i].key, key)) ? _i : TN;
+        }
+
+        /// @copydoc index_of
+        constexpr size_type index_of(const char* key, size_type n) const {
+            const size_type _i = candidate(hash_literal(key, n, 0));
+            return (_i != TN && internal::perfect_hash_equal(key, m_ayEntries[_i].key, n)) ? _i : TN;
+        }
+
+        constexpr bool contains(const char* key) const          { return index_of(key) != TN; }
+
+        /**
+         * @brief False when the key set had duplicates or no displacement was found, check it with
+         * static_assert.
+         */
+        constexpr bool valid() const                            { return m_bValid; }
+
+        constexpr size_type size() const                        { return TN; }
+        constexpr const entry_type& operator[](size_type i) const { return m_ayEntries[i]; }
+        constexpr const entry_type* begin() const               { return m_ayEntries; }
+        constexpr const entry_type* end() const                 { return m_ayEntries + TN; }
+
+    private:
+        constexpr size_type candidate(uint32_t h) const {
+            const uint32_t _slot = internal::perfect_hash_slot(h, m_ayDisplacement[h & (buckets - 1)]) & (slots - 1);
+            return m_aySlots[_slot] == empty ? TN : size_type(m_aySlots[_slot]);
+        }
+
+        constexpr bool place_bucket(size_type bucket, const uint32_t (&hashes)[TN]) {
+            for (uint32_t d = 0; d <= max_displacement; ++d) {
+                size_type _taken[TN] = {};
+                size_type _count = 0;
+                bool _ok = true;
+
+                for (size_type i = 0; i < TN && _ok; ++i) {
+                    if ((hashes[i] & (buckets - 1)) != bucket) continue;
+
+                    const size_type _slot = internal::perfect_hash_slot(hashes[i], uint16_t(d)) & (slots - 1);
+                    if (m_aySlots[_slot] != empty) _ok = false;
+                    for (size_type k = 0; k < _count && _ok; ++k)
+                        if (_taken[k] == _slot) _ok = false;
+                    _taken[_count++] = _slot;
+                }
+                if (!_ok) continue;
+
+                m_ayDisplacement[bucket] = uint16_t(d);
+                for (size_type i = 0, k = 0; i < TN; ++i)
+                    if ((hashes[i] & (buckets - 1)) == bucket) m_aySlots[_taken[k++]] = index_type(i);
+                return true;
+            }
+            return false;
+        }
+
+    private:
+        entry_type m_ayEntries[TN];
+        uint16_t m_ayDisplacement[buckets];
+        index_type m_aySlots[slots];
+        bool m_bValid;
+    };
+
+    /**
+     * @brief Build a basic_perfect_hash from an entry array, the size is deduced.
+     */
+    template <typename TValue, utb::size_t TN>
+    constexpr basic_perfect_hash<TValue, TN> make_perfect_hash(const perfect_hash_entry<TValue> (&entries)[TN]) {
+        return basic_perfect_hash<TValue, TN>(entries);
+    }
+}
+
+#endif
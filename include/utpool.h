@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_POOL_H__
+#define __UT_POOL_H__
+
+#include "utconfig.h"
+#include "utalgorithm.h"
+
+#if UTB_CONFIG_ENABLE_ATOMIC == UTB_YES
+    #include "atomic/utatomic_types.h"
+#endif
+
+namespace utb {
+
+    namespace internal {
+        /// One block of a pool: the object or, while free, the link to the next free block.
+        template <typename T, typename TLink>
+        union pool_block {
+            TLink next;
+            alignas(T) unsigned char data[sizeof(T)];
+        };
+    }
+
+    /**
+     * @brief Fixed-block pool: TCount blocks for objects of type T in a static array.
+     *
+     * allocate() and deallocate() are O(1). The blocks are handed out in order first and then
+     * taken from the free list, so the constructor does not walk the array. Not thread safe,
+     * see basic_atomic_pool.
+     *
+     * The pool is an allocator for a single type:
+     * @code
+     * static utb::pool<message, 16> messages;
+     *
+     * message* m = messages.create(id, payload);
+     * ...
+     * messages.destroy(m);
+     * @endcode
+     *
+     * @tparam T The object type.
+     * @tparam TCount The number of blocks.
+     */
+    template <typename T, utb::size_t TCount>
+    class basic_pool {
+        static_assert(TCount > 0, "A pool needs at least one block.");
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using size_type = utb::size_t;
+        using self_type = basic_pool<T, TCount>;
+
+        basic_pool() noexcept
+            : m_pFree(nullptr), m_sFresh(0), m_sUsed(0), m_sHighWatermark(0) { }
+
+        basic_pool(const self_type&) = delete;
+        self_type& operator=(const self_type&) = delete;
+
+        /**
+         * @brief Get an uninitialized block.
+         * @return The block, nullptr when the pool is exhausted.
+         */
+        void* allocate() noexcept {
+            block_type* _block;
+
+            if (m_pFree != nullptr) {
+                _block = m_pFree;
+                m_pFree = static_cast<block_type*>(_block->next);
+            } else if (m_sFresh < TCount) {
+                _block = &m_ayBlocks[m_sFresh++];
+            } else {
+                return nullptr;
+            }
+            if (++m_sUsed > m_sHighWatermark) m_sHighWatermark = m_sUsed;
+            return _block->data;
+        }
+
+        /**
+         * @brief Give a block back, p must come from allocate() of this pool.
+         */
+        void deallocate(void* p) noexcept {
+            if (p == nullptr) return;
+            assert(owns(p));
+
+            block_type* _block = static_cast<block_type*>(p);
+            _block->next = m_pFree;
+            m_pFree = _block;
+            --m_sUsed;
+        }
+
+        /**
+         * @brief Allocate a block and construct a T in it.
+         * @return The object, nullptr when the pool is exhausted.
+         */
+        template <typename... TArgs>
+        pointer create(TArgs&&... args) {
+            void* _p = allocate();
+            return _p ? new (_p) T(utb::forward<TArgs>(args)...) : nullptr;
+        }
+
+        /**
+         * @brief Destruct the object and give its block back.
+         */
+        void destroy(pointer p) {
+            if (p == nullptr) return;
+            p->~T();
+            deallocate(p);
+        }
+
+        /**
+         * @brief True when p points to a block of this pool.
+         */
+        bool owns(const void* p) const noexcept {
+            const unsigned char* _p = static_cast<const unsigned char*>(p);
+            const unsigned char* _first = reinterpret_cast<const unsigned char*>(m_ayBlocks);
+
+            return _p >= _first && _p < _first + sizeof(m_ayBlocks) &&
+                   size_type(_p - _first) % sizeof(block_type) == 0;
+        }
+
+        /// The number of blocks in use.
+        size_type size() const noexcept                         { return m_sUsed; }
+        /// The number of free blocks.
+        size_type available() const noexcept                    { return TCount - m_sUsed; }
+        /// The most blocks that were in use at the same time.
+        size_type high_watermark() const noexcept               { return m_sHighWatermark; }
+        void reset_high_watermark() noexcept                    { m_sHighWatermark = m_sUsed; }
+
+        bool empty() const noexcept                             { return m_sUsed == 0; }
+        bool full() const noexcept                              { return m_sUsed == TCount; }
+        constexpr size_type capacity() const noexcept           { return TCount; }
+
+    private:
+        using block_type = internal::pool_block<T, void*>;
+
+        block_type m_ayBlocks[TCount];
+        block_type* m_pFree;
+        size_type m_sFresh;
+        size_type m_sUsed;
+        size_type m_sHighWatermark;
+    };
+
+#if UTB_CONFIG_ENABLE_ATOMIC == UTB_YES
+    /**
+     * @brief Lock-free variant of basic_pool, allocate() and deallocate() may be called from any
+     * number of threads and from interrupts.
+     *
+     * The free list is a Treiber stack over block indices. The head holds the index in its low
+     * half and a tag in its high half that changes on every pop, so a block that was popped and
+     * pushed again in between (ABA) makes the compare-exchange fail. The constructor links all
+     * blocks, O(TCount).
+     *
+     * @tparam T The object type.
+     * @tparam TCount The number of blocks, below 65535.
+     */
+    template <typename T, utb::size_t TCount>
+    class basic_atomic_pool {
+        static_assert(TCount > 0, "A pool needs at least one block.");
+        static_assert(TCount < 0xFFFF, "The lock-free pool indexes its blocks with 16 bit.");
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using size_type = utb::size_t;
+        using self_type = basic_atomic_pool<T, TCount>;
+
+        basic_atomic_pool() noexcept
+            : m_iHead(0), m_sUsed(0), m_sHighWatermark(0) {
+            for (size_type i = 0; i < TCount; ++i)
+                m_ayBlocks[i].next = uint16_t(i + 1 < TCount ? i + 1 : nil);
+        }
+
+        basic_atomic_pool(const self_type&) = delete;
+        self_type& operator=(const self_type&) = delete;
+
+        /// @copydoc basic_pool::allocate
+        void* allocate() noexcept {
+            uint32_t _head = atomic_head::load(&m_iHead, memory_order::Acquire);
+
+            for (;;) {
+                const uint16_t _index = uint16_t(_head);
+                if (_index == nil) return nullptr;
+
+                // the block may be taken and written by another thread meanwhile, then the
+                // link is garbage but the tag has changed and the compare-exchange fails
+                const uint16_t _link = atomic_link::load(&m_ayBlocks[_index].next, memory_order::Relaxed);
+                uint32_t _next = ((_head & 0xFFFF0000U) + 0x10000U) | _link;
+                if (atomic_head::compare_exchange_n(&m_iHead, _head, _next, true, memory_order::AcqRel))
+                    break;
+            }
+            size_type _used = atomic_size::add_fetch(&m_sUsed, 1, memory_order::Relaxed);
+            size_type _high = atomic_size::load(&m_sHighWatermark, memory_order::Relaxed);
+            while (_used > _high &&
+                   !atomic_size::compare_exchange_n(&m_sHighWatermark, _high, _used, true, memory_order::Relaxed)) { }
+
+            return m_ayBlocks[uint16_t(_head)].data;
+        }
+
+        /// @copydoc basic_pool::deallocate
+        void deallocate(void* p) noexcept {
+            if (p == nullptr) return;
+            assert(owns(p));
+
+            const uint16_t _index = uint16_t(static_cast<block_type*>(p) - m_ayBlocks);
+            uint32_t _head = atomic_head::load(&m_iHead, memory_order::Relaxed);
+
+            for (;;) {
+                atomic_link::store(&m_ayBlocks[_index].next, uint16_t(_head), memory_order::Relaxed);
+                uint32_t _next = (_head & 0xFFFF0000U) | _index;
+                if (atomic_head::compare_exchange_n(&m_iHead, _head, _next, true, memory_order::Release))
+                    break;
+            }
+            atomic_size::sub_fetch(&m_sUsed, 1, memory_order::Relaxed);
+        }
+
+        /// @copydoc basic_pool::create
+        template <typename... TArgs>
+        pointer create(TArgs&&... args) {
+            void* _p = allocate();
+            return _p ? new (_p) T(utb::forward<TArgs>(args)...) : nullptr;
+        }
+
+        /// @copydoc basic_pool::destroy
+        void destroy(pointer p) {
+            if (p == nullptr) return;
+            p->~T();
+            deallocate(p);
+        }
+
+        /// @copydoc basic_pool::owns
+        bool owns(const void* p) const noexcept {
+            const unsigned char* _p = static_cast<const unsigned char*>(p);
+            const unsigned char* _first = reinterpret_cast<const unsigned char*>(m_ayBlocks);
+
+            return _p >= _first && _p < _first + sizeof(m_ayBlocks) &&
+                   size_type(_p - _first) % sizeof(block_type) == 0;
+        }
+
+        size_type size() const noexcept {
+            return atomic_size::load(const_cast<volatile size_type*>(&m_sUsed), memory_order::Relaxed);
+        }
+        size_type available() const noexcept                    { return TCount - size(); }
+        size_type high_watermark() const noexcept {
+            return atomic_size::load(const_cast<volatile size_type*>(&m_sHighWatermark), memory_order::Relaxed);
+        }
+
+        bool empty() const noexcept                             { return size() == 0; }
+        bool full() const noexcept                              { return size() == TCount; }
+        constexpr size_type capacity() const noexcept           { return TCount; }
+
+    private:
+        using block_type = internal::pool_block<T, uint16_t>;
+        using atomic_head = utb::atomic::gcc_atomic_type<uint32_t>;
+        using atomic_link = utb::atomic::gcc_atomic_type<uint16_t>;
+        using atomic_size = utb::atomic::gcc_atomic_type<size_type>;
+
+        static constexpr uint16_t nil = 0xFFFF;
+
+        block_type m_ayBlocks[TCount];
+        volatile uint32_t m_iHead;
+        volatile size_type m_sUsed;
+        volatile size_type m_sHighWatermark;
+    };
+#endif // UTB_CONFIG_ENABLE_ATOMIC
+
+    /**
+     * @brief Deleter that gives an object back to its pool, for basic_node::destroy(); the
+     * shared pointers of make_pooled() use shared_block_deleter (utshared_ptr.h).
+     */
+    template <class TPool>
+    struct pool_deleter {
+        TPool* pool;
+
+        pool_deleter(TPool* p = nullptr) noexcept : pool(p) { }
+
+        void operator()(typename TPool::pointer p) const {
+            if (pool != nullptr) pool->destroy(p);
+        }
+    };
+
+    template <typename T, utb::size_t TCount>
+    using pool = basic_pool<T, TCount>;
+
+#if UTB_CONFIG_ENABLE_ATOMIC == UTB_YES
+    template <typename T, utb::size_t TCount>
+    using atomic_pool = basic_atomic_pool<T, TCount>;
+#endif
+}
+
+#endif // __UT_POOL_H__
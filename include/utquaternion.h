@@ -12,16 +12,26 @@
 #include "utvector4.h"
 #include "utvector3.h"
 #include "utalgorithm.h"
-#include "utmap.h"
 #include "utfunctional.h"
+#include "utfastmath.h"
 
 #include <cfloat>
+#include <math.h>
 
 namespace utb {
     /// @brief Mathematical utilities namespace
     namespace math {
+        namespace internal {
+            /// The scalar functions of the quaternion functions, from utfastmath.h at full precision;
+            /// float and utb::fixed take the polynomial paths, every other type the C library.
+            template <typename T> inline T quat_sin(T v)            { return fast_sin<approx_full>(v); }
+            template <typename T> inline T quat_cos(T v)            { return fast_cos<approx_full>(v); }
+            template <typename T> inline T quat_abs(T v)            { return v < T(0) ? -v : v; }
+            template <typename T> inline T quat_acos(T v)           { return fast_atan2<approx_full>(fast_sqrt<approx_full>(T(T(1) - v * v)), v); }
+        }
+
         /// @brief Quaternion class for 3D rotations and orientations
-        /// @tparam T Scalar type (float, double, etc.)
+        /// @tparam T Scalar type (float, double, utb::fixed, etc.)
         template <typename T>
         class quaternion {
         public:
@@ -37,58 +47,56 @@ namespace utb {
                     value_type y;
                     value_type z;
                     value_type s;
-                }
-		        float qu[4];
+                };
+                value_type qu[4];
             };
 
-            quaternion() : vec(vector4<value_type>(0.0f))	{}
+            quaternion() : x(0), y(0), z(0), s(0)	{}
 
-            quaternion(value_type fs, value_type x, value_type y, value_type z) 
-                : x(x), y(y), z(z), s(fs)	{}
+            quaternion(value_type fs, value_type _x, value_type _y, value_type _z)
+                : x(_x), y(_y), z(_z), s(fs)	{}
+            quaternion(value_type fs, const vector3<value_type>& v)
+                : x(v.x), y(v.y), z(v.z), s(fs)	{}
+            /// From the euler angles in axis (radians).
             quaternion(const vector3<value_type> &axis);
-            quaternion(float *pfs)  
-                : x(pfs[1]), y(pfs[2]), z(pfs[3]), s(pfs[0]))	{}
+            quaternion(const value_type *pfs)
+                : x(pfs[1]), y(pfs[2]), z(pfs[3]), s(pfs[0])	{}
 
             quaternion(const self_type& q) : x(q.x), y(q.y), z(q.z), s(q.s)	{}
-            quaternion(self_type&& q) : x(utb::move(q.x)), y(utb::move(q.y)), z(utb::move(q.z)), s(utb::move(q.s))	{}
 
-            float s() const { return s; }
+            value_type scalar() const { return s; }
             vector3<value_type> v() const { return vector3<value_type>(x, y, z); }
 
             operator pointer ()		{ return (pointer)(qu); }
-            operator const_pointer () const	{ return (float*)qu; }
+            operator const_pointer () const	{ return (const_pointer)(qu); }
 
-            self_type& operator =  (const self_type& q)	{ 
-                vec = q.vec;  return *this; 
+            self_type& operator =  (const self_type& q)	{
+                x = q.x; y = q.y; z = q.z; s = q.s; return *this;
             }
             self_type& operator += (const self_type& q)	{
-                vec += q.vec;  return *this; 
+                x += q.x; y += q.y; z += q.z; s += q.s; return *this;
             }
             self_type& operator -= (const self_type& q)	{
-                vec -= q.vec;  return *this; 
-            }
-            self_type& operator -= (const self_type& q)		{
-                vec -= q.vec;  return *this; 
+                x -= q.x; y -= q.y; z -= q.z; s -= q.s; return *this;
             }
             self_type& operator *= (const self_type& b) {
-                s = ((s * b.s) - (x * b.x) - (y * b.y) - (z * b.z));
-                x = ((s * b.x) + (x * b.s) + (y * b.z) - (z * b.y));
-                y = ((s * b.y) - (x * b.z) + (y * b.s) + (z * b.x));
-                z = ((s * b.z) + (x * b.y) - (y * b.x) + (z * b.s));
+                const value_type _s = ((s * b.s) - (x * b.x) - (y * b.y) - (z * b.z));
+                const value_type _x = ((s * b.x) + (x * b.s) + (y * b.z) - (z * b.y));
+                const value_type _y = ((s * b.y) - (x * b.z) + (y * b.s) + (z * b.x));
+                const value_type _z = ((s * b.z) + (x * b.y) - (y * b.x) + (z * b.s));
+                s = _s; x = _x; y = _y; z = _z;
                 return *this;
             }
-            self_type& operator *= (const value_type f)    { 
-                vec *= f;  return *this; 
+            self_type& operator *= (const value_type f)    {
+                x *= f; y *= f; z *= f; s *= f; return *this;
             }
-            self_type& operator /= (const self_type& q)    {
-                vec /= q.vec;  return *this; 
+            self_type& operator /= (const self_type& q);
+            self_type& operator /= (const value_type f)    {
+                x /= f; y /= f; z /= f; s /= f; return *this;
             }
-            self_type& operator /= (const value_type f)    { 
-                vec /= f;  return *this; 
-            }
-            
+
             bool operator == (const self_type& q) const {
-                return vec == q.vec;
+                return (x == q.x) && (y == q.y) && (z == q.z) && (s == q.s);
             }
             bool operator != (const self_type& q) const {
                 return !(*this == q);
@@ -107,202 +115,237 @@ namespace utb {
             }
         };
 
-        template <typename T> 
-	    inline quaternion<T> identy() { return quaternion<T>(1.0f, 0.0f, 0.0f, 0.0f); }
+        template <typename T>
+	    inline quaternion<T> identy() { return quaternion<T>(T(1), T(0), T(0), T(0)); }
+
+        template <typename T>
+        inline quaternion<T> operator + (const quaternion<T>& a, const quaternion<T>& b)
+            { return quaternion<T>(a.s + b.s, a.x + b.x, a.y + b.y, a.z + b.z); }
+        template <typename T>
+        inline quaternion<T> operator - (const quaternion<T>& a, const quaternion<T>& b)
+            { return quaternion<T>(a.s - b.s, a.x - b.x, a.y - b.y, a.z - b.z); }
+        template <typename T>
+        inline quaternion<T> operator - (const quaternion<T>& a)
+            { return quaternion<T>(-a.s, -a.x, -a.y, -a.z); }
+        template <typename T>
+        inline quaternion<T> operator * (const quaternion<T>& a, const T& f)
+            { return quaternion<T>(a.s * f, a.x * f, a.y * f, a.z * f); }
+        template <typename T>
+        inline quaternion<T> operator * (const T& f, const quaternion<T>& a)
+            { return quaternion<T>(a.s * f, a.x * f, a.y * f, a.z * f); }
+        template <typename T>
+        inline quaternion<T> operator / (const quaternion<T>& a, const T& f)
+            { return quaternion<T>(a.s / f, a.x / f, a.y / f, a.z / f); }
+
+        template <typename T>
+        inline quaternion<T> operator * (const quaternion<T>& a,const quaternion<T>& b) {
+            quaternion<T> q;
+            q.s = ((a.s * b.s) - (a.x * b.x) - (a.y * b.y) - (a.z * b.z)); // Scalar part
+            q.x = ((a.s * b.x) + (a.x * b.s) + (a.y * b.z) - (a.z * b.y)); // Vector part x
+            q.y = ((a.s * b.y) - (a.x * b.z) + (a.y * b.s) + (a.z * b.x)); // Vector part y
+            q.z = ((a.s * b.z) + (a.x * b.y) - (a.y * b.x) + (a.z * b.s)); // Vector part z
+            return q;
+        }
 
-        template <typename T> 
-	    inline T lenght(const quaternion<T>& v)											
-            { return (T)sqrt((double)(v.v.w * v.v.w + v.v.x * v.v.x + v.v.y * v.v.y + v.v.z * v.v.z)); }
+        template <typename T>
+	    inline T lenghtSq(const quaternion<T>& v)
+            { return (v.s * v.s + v.x * v.x + v.y * v.y + v.z * v.z); }
 
-	    template <typename T> 
-        inline T lenghtSq(const quaternion<T>& v)										
-            { return (v.v.w * v.v.w + (T)v.v.x * (T)v.v.x + (T)v.v.y * (T)v.v.y + (T)v.v.z * (T)v.v.z); }
+        template <typename T>
+	    inline T lenght(const quaternion<T>& v)
+            { return internal::vec_sqrt(T(v.s * v.s + v.x * v.x + v.y * v.y + v.z * v.z)); }
+
+        namespace internal {
+            /// sin(q) and cos(q) in closed form, from one sincos of the scalar part and one exp of
+            /// the length l of the vector part v:
+            ///   sin(q) = sin(s) cosh(l) + cos(s) sinh(l)/l v
+            ///   cos(q) = cos(s) cosh(l) - sin(s) sinh(l)/l v
+            /// Below l = 0.1 cosh and sinh(l)/l come from their series, which avoids the cancellation.
+            template <typename T>
+            inline void quat_sincos(const quaternion<T>& q, quaternion<T>& qsin, quaternion<T>& qcos) {
+                const vector3<T> _v = q.v();
+                const T _l = lenght(_v);
+                T _s, _c, _cosh, _sinhl;
+                fast_sincos<approx_full>(q.s, _s, _c);
+
+                if (_l < T(0.1)) {
+                    const T _l2 = _l * _l;
+                    _cosh = T(1) + _l2 / T(2) * (T(1) + _l2 / T(12));
+                    _sinhl = T(1) + _l2 / T(6) * (T(1) + _l2 / T(20));
+                } else {
+                    const T _e = fast_exp<approx_full>(_l);
+                    const T _ie = T(1) / _e;
+                    _cosh = (_e + _ie) / T(2);
+                    _sinhl = (_e - _ie) / (T(2) * _l);
+                }
+                qsin = quaternion<T>(T(_s * _cosh), _v * T(_c * _sinhl));
+                qcos = quaternion<T>(T(_c * _cosh), _v * T(-_s * _sinhl));
+            }
+        }
 
         template <typename T>
-        inline quaternion<T> invert(const quaternion<T> &q)  {  
-            T temp = lenghtSq(q); quaternion<T> tq = q;  tq.v.w /= temp; tq.v.x /= -temp; tq.v.y /= -temp; tq.v.z /= -temp; return q; 
+        inline quaternion<T> conjugate(const quaternion<T>& v) {
+            return quaternion<T>(v.s, -v.x, -v.y, -v.z);
         }
-        
+
+        template <typename T>
+        inline quaternion<T> invert(const quaternion<T> &q)  {
+            return conjugate(q) / lenghtSq(q);
+        }
+
+        /// q * invert(b)
+        template <typename T>
+        inline quaternion<T> operator / (const quaternion<T>& a, const quaternion<T>& b)
+            { return a * invert(b); }
+
+        template <typename T>
+        inline quaternion<T>& quaternion<T>::operator /= (const quaternion<T>& q)    {
+            return *this = *this * invert(q);
+        }
+
         template <typename T>
         inline quaternion<T> exp(const quaternion<T>& v) {
             T Mul;
             quaternion<T> temp = v;
-            T Length = lenght(temp.v);
-
-            if (Length > 1.0e-4) Mul = sin(Length)/Length;
-            else Mul = 1.0;
+            T Length = lenght(temp.v());
 
-            temp.v.w = cos(Length); // Scalar part
+            T _sin;
+            fast_sincos<approx_full>(Length, _sin, temp.s); // Scalar part
+            if (Length > T(1.0e-4)) Mul = _sin / Length;
+            else Mul = T(1);
 
             // Vector part
-            temp.v.x *= Mul; 
-            temp.v.y *= Mul;
-            temp.v.z *= Mul;
+            temp.x *= Mul;
+            temp.y *= Mul;
+            temp.z *= Mul;
             return temp;
         }
         template <typename T>
         inline quaternion<T> log(const quaternion<T>& v){
-            T Length;
+            T Length, Mul;
 	        quaternion<T> temp = v;
 
-            Length = lenght(temp.v);
-            Length = atan(Length/temp.v.w);
+            Length = lenght(temp.v());
+            if (Length > T(1.0e-4)) Mul = fast_atan2<approx_full>(Length, temp.s) / Length;
+            else Mul = T(1);
 
-            temp.v.w = 0.0;
+            temp.s = T(0);
 
-            temp.v.x *= Length;
-            temp.v.y *= Length;
-            temp.v.z *= Length;
+            temp.x *= Mul;
+            temp.y *= Mul;
+            temp.z *= Mul;
 
             return temp;
         }
         template <typename T>
         inline quaternion<T> normalize(const quaternion<T>& v) {
             T norme = lenght(v);
-	        quaternion<T> temp = v;
 
-            if (norme == 0.0) {
-                temp.v.w = 1.0;
-                temp.v.x = 0.0;
-                temp.v.y = 0.0;
-                temp.v.z = 0.0;
-            } else {
-                float recip = 1.0/norme;
-
-                temp.v.w *= recip;
-                temp.v.x *= recip;
-                temp.v.y *= recip;
-                temp.v.z *= recip;
-            }
-            return temp;
-        }
-        template <typename T>
-        inline quaternion<T> conjugate(const quaternion<T>& v) {
-            quaternion<T> temp = v;
-
-            temp.v.w = -temp.v.w;
-            temp.v.x = -temp.v.x;
-            temp.v.y = -temp.v.y;
-            temp.v.z = -temp.v.z;
-
-            return temp;
+            if (norme == T(0)) return identy<T>();
+            return v / norme;
         }
         template <typename T>
         inline quaternion<T> pow(const quaternion<T>& v, const T exp){
-            if (fabs(v.s) > .9999)
+            if (internal::quat_abs(v.s) > T(.9999))
                 return v;
-            
-            T   alpha = acos(v.s);
+
+            T   alpha = internal::quat_acos(v.s);
             T   newAlpha = alpha * exp;
             quaternion<T> result;
-            result.v.w = cos(newAlpha);
+            result.s = internal::quat_cos(newAlpha);
 
-            float   mult = sin(newAlpha) / sin(alpha);
-            result.v.x = (float)v.v.x * mult;
-            result.v.y = (float)v.v.y * mult;
-            result.v.z = (float)v.v.z * mult;
+            T   mult = internal::quat_sin(newAlpha) / internal::quat_sin(alpha);
+            result.x = v.x * mult;
+            result.y = v.y * mult;
+            result.z = v.z * mult;
 
             return result;
         }
         template <typename T>
         inline T dot(const quaternion<T> &a, const quaternion<T> &b) {
-            return a.v.w*b.v.w + a.v.x*b.v.x + a.v.y*b.v.y + a.v.z*b.v.z;
+            return a.s*b.s + a.x*b.x + a.y*b.y + a.z*b.z;
         }
 
         template <typename T>
         inline quaternion<T> power(const quaternion<T>& qu, T degree) {
-                if ( degree == 0 ) return quaternion<T>((T)1.0, 0, 0, 0);
+                if ( degree == T(0) ) return identy<T>();
                 quaternion<T> tmp_qu = qu ;
 
-                for ( float f = 1 ; f < abs(degree) ; f++ )
+                const int _n = int(internal::quat_abs(degree));
+                for ( int i = 1 ; i < _n ; i++ )
                         tmp_qu *= qu ;
 
-                if ( degree < 0 )
-                    return ( 1.0f / tmp_qu );
+                if ( degree < T(0) )
+                    return invert( tmp_qu );
 
                 return tmp_qu ;
         }
 
         template <typename T>
         inline quaternion<T> sin(const quaternion<T> &q) {
-            quaternion<T> s;
-
-            for( float n = 0; n < 6.0f; n++ )
-		    s += pow( -1.0f ,n ) * (power( q , 2.0f * n + 1.0f ) ) /
-                        ( utb::factorial<T>( 2.0f * n + 1.0f ) );
-
-            return s ;
+            quaternion<T> _sin, _cos;
+            internal::quat_sincos(q, _sin, _cos);
+            return _sin;
         }
 
         template <typename T>
         inline quaternion<T> cos(const quaternion<T> &q) {
-            quaternion<T> s;
-
-            for( T n = 1.0f; n <= 6.0f; n++ )
-		        s += pow( -1.0f ,n ) * power( q , 2.0f * n ) /
-                        factorial<T>( 2.0f * n ) ;
-
-            return s ;
+            quaternion<T> _sin, _cos;
+            internal::quat_sincos(q, _sin, _cos);
+            return _cos;
         }
 
-         template <typename T>
+        template <typename T>
         inline quaternion<T> tan(const quaternion<T> &q) {
-            if ( lenghtSq(q) == 0.0 ) return quaternion<T>(1, 0, 0, 0) ;
-            return sin( q ) / cos( q ) ;
+            if ( lenghtSq(q) == T(0) ) return identy<T>() ;
+            quaternion<T> _sin, _cos;
+            internal::quat_sincos(q, _sin, _cos);
+            return _sin / _cos ;
         }
         template <typename T>
         inline quaternion<T> ctan(const quaternion<T> &q)
         {
-            if ( lenghtSq(q) == 0 ) return quaternion<T>(1.0, 0.0, 0.0, 0.0) ;
-            return cos( q ) / sin( q ) ;
+            if ( lenghtSq(q) == T(0) ) return identy<T>() ;
+            quaternion<T> _sin, _cos;
+            internal::quat_sincos(q, _sin, _cos);
+            return _cos / _sin ;
         }
 
         template <typename T>
-        inline quaternion<T> operator * (const quaternion<T>& a,const quaternion<T>& b) {
-            quaternion<T> q;
-            q.v.w =   ((a.v.w * b.v.w) - (a.v.x * b.v.x) - (a.v.y * b.v.y) - (a.v.z * b.v.z)); // Scalar part
-            q.v.x = ((a.v.w * b.v.x) + (a.v.x * b.v.w) + (a.v.y * b.v.y) - (a.v.z * b.v.y)); // Vector part x
-            q.v.y = ((a.v.w * b.v.y) - (a.v.x * b.v.z) + (a.v.y * b.v.w) + (a.v.z * b.v.x)); // Vector part y
-            q.v.z = ((a.v.w * b.v.z) + (a.v.x * b.v.y) - (a.v.y * b.v.x) + (a.v.z * b.v.w)); // Vector part z
-            return q;
-        } 
-
-        template <typename T>
-        inline quaternion<T> quaternion_fromaxis(const float angle, vector3<T> axis)
+        inline quaternion<T> quaternion_fromaxis(const T angle, vector3<T> axis)
         {
             T omega, s = lenght(axis), c;
             vector3<T> vt = axis;
-            quaternion<T>  _ret;
 
-            if (fabs(s) > FLT_EPSILON) {
-                c = 1.0f/s;
+            if (internal::quat_abs(s) > T(FLT_EPSILON)) {
+                c = T(1) / s;
                 vt *= c;
 
-                omega = -0.5f * angle;
-                s = (T)sin(omega);
+                omega = T(-0.5) * angle;
+                s = internal::quat_sin(omega);
 
-                quaternion<T> temp(cos(omega), s*vt.x, s*vt.y, s*vt.z);
+                quaternion<T> temp(internal::quat_cos(omega), s*vt.x, s*vt.y, s*vt.z);
                 return normalize(temp);
-            } 
-            quaternion<T> temp(1.0, vector3<T>(0.0f));
-            return normalize(temp);
+            }
+            return identy<T>();
         }
 
-        template <typename T> 
+        template <typename T>
         quaternion<T>::quaternion(const vector3<value_type> &axis) {
-            value_type cos_z_2 = (value_type)cos(0.5*axis.z);
-            value_type cos_y_2 = (value_type)cos(0.5*axis.y);
-            value_type cos_x_2 = (value_type)cos(0.5*axis.x);
+            const value_type _half(0.5);
+            value_type cos_z_2 = internal::quat_cos(value_type(_half*axis.z));
+            value_type cos_y_2 = internal::quat_cos(value_type(_half*axis.y));
+            value_type cos_x_2 = internal::quat_cos(value_type(_half*axis.x));
 
-            value_type sin_z_2 = (value_type)sin(0.5*axis.z);
-            value_type sin_y_2 = (value_type)sin(0.5*axis.y);
-            value_type sin_x_2 = (value_type)sin(0.5*axis.x);
+            value_type sin_z_2 = internal::quat_sin(value_type(_half*axis.z));
+            value_type sin_y_2 = internal::quat_sin(value_type(_half*axis.y));
+            value_type sin_x_2 = internal::quat_sin(value_type(_half*axis.x));
 
             // and now compute quaternion
-            v.w  = cos_z_2*cos_y_2*cos_x_2 + sin_z_2*sin_y_2*sin_x_2;
-            v.x = cos_z_2*cos_y_2*sin_x_2 - sin_z_2*sin_y_2*cos_x_2;
-            v.y = cos_z_2*sin_y_2*cos_x_2 + sin_z_2*cos_y_2*sin_x_2;
-            v.z = sin_z_2*cos_y_2*cos_x_2 - cos_z_2*sin_y_2*sin_x_2;
+            s = cos_z_2*cos_y_2*cos_x_2 + sin_z_2*sin_y_2*sin_x_2;
+            x = cos_z_2*cos_y_2*sin_x_2 - sin_z_2*sin_y_2*cos_x_2;
+            y = cos_z_2*sin_y_2*cos_x_2 + sin_z_2*cos_y_2*sin_x_2;
+            z = sin_z_2*cos_y_2*cos_x_2 - cos_z_2*sin_y_2*sin_x_2;
         }
 
 
@@ -313,4 +356,4 @@ namespace utb {
     }
 }
 
-#endif // __UTQUATERNION_H__
\ No newline at end of file
+#endif // __UTQUATERNION_H__
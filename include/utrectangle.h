@@ -10,6 +10,7 @@
 #define __UT_RECTANGLE_H__
 
 #include "utconfig.h"
+#include "utalgorithm.h"
 #include "utvector2.h"
 
 namespace utb {
@@ -28,10 +29,6 @@ namespace utb {
                     value_type width;
                     value_type height;
                 };
-                struct {
-                    vector2<T> position;
-                    vector2<T> size;
-                };
                 value_type c[4];
             };
 
@@ -48,18 +45,22 @@ namespace utb {
             rectangle(rectangle&& rect) noexcept
                 : x(utb::move(rect.x)), y(utb::move(rect.y)), width(utb::move(rect.width)), height(utb::move(rect.height)) { }
 
-            
-            const value_type& top() { return y; }
+            self_type& operator = (const self_type& r) {
+                x = r.x; y = r.y; width = r.width; height = r.height; return *this;
+            }
+
+            const value_type& top() const { return y; }
             void top(const value_type& t) { y = t; }
             
-            const value_type& left() { return x; }
+            const value_type& left() const { return x; }
             void left(const value_type& t) { x = t; }
             
-            const value_type& bottom() { return y + height; }
-            const value_type& right() { return x + width; }
+            value_type bottom() const { return y + height; }
+            value_type right() const { return x + width; }
             
-            vector2<value_type> center() { return vector2<T>(x + width / 2, y + height / 2); }
-            vector2<value_type> size() { return vector2<value_type>(width, height); }
+            vector2<value_type> center() const { return vector2<T>(x + width / value_type(2), y + height / value_type(2)); }
+            vector2<value_type> position() const { return vector2<value_type>(x, y); }
+            vector2<value_type> size() const { return vector2<value_type>(width, height); }
             
             rectangle<value_type> inflate (value_type leftRight, value_type topBottom) {
 	            x -= leftRight;
@@ -69,24 +70,24 @@ namespace utb {
 
                 return *this;
             }
-            bool contains(self_type r) {
+            bool contains(self_type r) const {
                return r.left() >= left() && r.right() <= right() &&
                        r.top() >= top() && r.bottom() <= bottom();
             }
-            self_type& intersect(const self_type& r1, const self_type& r2)  {
-                int x = utb::max<value_type> (r1.x, r2.x);
-                int y = utb::max<value_type> (r1.y, r2.y);
-                int w = utb::min<value_type> (r1.right(), r2.right()) - x;
-                int h = utb::min<value_type> (r1.bottom(), r2.bottom()) - y;
+            self_type intersect(const self_type& r1, const self_type& r2) const {
+                value_type _x = utb::max<value_type> (r1.x, r2.x);
+                value_type _y = utb::max<value_type> (r1.y, r2.y);
+                value_type _w = utb::min<value_type> (r1.right(), r2.right()) - _x;
+                value_type _h = utb::min<value_type> (r1.bottom(), r2.bottom()) - _y;
 
-                return self_type(x,y,w,h);
+                return self_type(_x, _y, _w, _h);
             }
-            bool intersects(const self_type& r) {
-                int w = utb::min<value_type> (r.right(), right()) - utb::max<value_type> (r.x, x);
-		        int h = utb::min<value_type> (r.bottom(), bottom()) - utb::max<value_type> (r.y, y);
-		        return w > 0 && h > 0;
+            bool intersects(const self_type& r) const {
+                value_type _w = utb::min<value_type> (r.right(), right()) - utb::max<value_type> (r.x, x);
+		        value_type _h = utb::min<value_type> (r.bottom(), bottom()) - utb::max<value_type> (r.y, y);
+		        return _w > value_type(0) && _h > value_type(0);
             }
-            void offset(float offx, float offy) {
+            void offset(value_type offx, value_type offy) {
                 x += offx;
                 y += offy;
             }
@@ -98,11 +99,11 @@ namespace utb {
                 return !(*this == r);
             }
             bool is_valid() const {
-                return (width > 0) && (height > 0);
+                return (width > value_type(0)) && (height > value_type(0));
             }
-            pointer operator pointer ()		{ return (pointer)(c); }
+            operator pointer ()		{ return (pointer)(c); }
 
-            self_type& copy() {
+            self_type copy() const {
                 return self_type(x, y, width, height);
             }
             self_type& swap(self_type& other) noexcept {
@@ -114,14 +115,14 @@ namespace utb {
                 }
                 return *this;
             }
-            self_type& scale(int scale) {
+            self_type scale(int scale) const {
                 value_type nx = x * scale;
                 value_type ny = y * scale;
                 value_type nwidth = width * scale;
                 value_type nheight = height * scale;
                 return self_type(nx, ny, nwidth, nheight);
             }
-            self_type& scale(int scalex, int scaley) {
+            self_type scale(int scalex, int scaley) const {
                 value_type nx = x * scalex;
                 value_type ny = y * scaley;
                 value_type nwidth = width * scalex;
@@ -129,14 +130,14 @@ namespace utb {
                 return self_type(nx, ny, nwidth, nheight);
             }
             
-            self_type& scale(float scale) {
+            self_type scale(float scale) const {
                 value_type nx = static_cast<value_type>(x * scale);
                 value_type ny = static_cast<value_type>(y * scale);
                 value_type nwidth = static_cast<value_type>(width * scale);
                 value_type nheight = static_cast<value_type>(height * scale);
                 return self_type(nx, ny, nwidth, nheight);
             }
-            self_type& scale(float scalex, float scaley) {
+            self_type scale(float scalex, float scaley) const {
                 value_type nx = static_cast<value_type>(x * scalex);
                 value_type ny = static_cast<value_type>(y * scaley);
                 value_type nwidth = static_cast<value_type>(width * scalex);
@@ -150,4 +151,4 @@ namespace utb {
     }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_SCHEDULER_H__
+#define __UT_SCHEDULER_H__
+
+#include "utconfig.h"
+#include "utalgorithm.h"
+#include "utbenchmark.h"
+#include "utfunction.h"
+#include "utintrusive_list.h"
+#include "uttimer_wheel.h"
+
+#if UTB_CONFIG_ENABLE_ATOMIC == UTB_YES
+    #include "atomic/utatomic_types.h"
+#endif
+
+namespace utb {
+
+    /// Handle of a task in a basic_scheduler.
+    using task_id = uint16_t;
+    constexpr task_id invalid_task = 0xFFFF;
+
+    /**
+     * @brief The runtime accounting of one task, in units of the scheduler clock.
+     */
+    template <typename TValue>
+    struct basic_task_stats {
+        uint32_t runs;
+        TValue total;
+        TValue max;
+
+        TValue average() const                                  { return runs ? TValue(total / runs) : TValue(0); }
+    };
+
+    /**
+     * @brief Cooperative run-to-completion scheduler with static storage.
+     *
+     * A task is a callback with a priority (0 lowest, TPriorities - 1 highest). post() makes it
+     * ready, run_once() calls the highest ready task once; a task that should run again posts
+     * itself. Each priority has its own FIFO ready queue, a bitmap of the non-empty queues is
+     * resolved with nlz(), so picking the next task is O(1) whatever the number of tasks.
+     * Posting a task that is already ready does nothing, so events coalesce.
+     *
+     * defer() posts a task after a number of ticks through a basic_timer_wheel, tick() advances
+     * it. post_from_isr() only sets a bit in an atomic pending mask and is safe from interrupts
+     * and other threads; the mask is moved into the ready queues at the start of run_once().
+     * @code
+     * static utb::scheduler<8> sched;
+     *
+     * task_id blink = sched.create(1, []() { toggle_led(); sched.defer(sched.current(), 500); });
+     * task_id rx = sched.create(7, []() { handle_uart(); });
+     * sched.post(blink);
+     *
+     * void UART_IRQHandler() { sched.post_from_isr(rx); }
+     * void SysTick_Handler() { ms_elapsed = true; }
+     *
+     * for (;;) { if (ms_elapsed) { ms_elapsed = false; sched.tick(); } sched.run(); }
+     * @endcode
+     *
+     * @tparam TTasks The maximal number of tasks.
+     * @tparam TPriorities The number of priority levels, at most 32.
+     * @tparam TClock The clock for the runtime accounting, with value_type, static now() and static init(),
+     *  the constructor calls init() (e.g. enables the DWT cycle counter on Cortex-M).
+     * @tparam TTask The task callback, called as task().
+     */
+    template <utb::size_t TTasks, utb::size_t TPriorities = 8, class TClock = bench::cycle_counter,
+              class TTask = utb::function<void()> >
+    class basic_scheduler {
+        static_assert(TTasks > 0 && TTasks < invalid_task, "The number of tasks must be in 1 - 65534.");
+        static_assert(TPriorities > 0 && TPriorities <= 32, "At most 32 priorities are supported.");
+    public:
+        using task_type = TTask;
+        using clock_type = TClock;
+        using time_type = typename TClock::value_type;
+        using stats_type = basic_task_stats<time_type>;
+        using size_type = utb::size_t;
+        using tick_type = uint32_t;
+        using self_type = basic_scheduler<TTasks, TPriorities, TClock, TTask>;
+
+        basic_scheduler() noexcept : m_sTasks(0), m_iReady(0), m_iCurrent(invalid_task) {
+            clock_type::init();
+        #if UTB_CONFIG_ENABLE_ATOMIC == UTB_YES
+            for (size_type i = 0; i < pending_words; ++i) m_ayPending[i] = 0;
+        #endif
+        }
+
+        ~basic_scheduler() {
+            for (size_type p = 0; p < TPriorities; ++p) m_ayQueues[p].clear();
+        }
+
+        basic_scheduler(const self_type&) = delete;
+        self_type& operator=(const self_type&) = delete;
+
+        /**
+         * @brief Add a task, it is not ready until it is posted.
+         * @return The handle, invalid_task when all tasks are in use.
+         */
+        template <class TFn>
+        task_id create(uint8_t priority, TFn&& fn) {
+            assert(priority < TPriorities);
+            if (m_sTasks == TTasks) return invalid_task;
+
+            task_node& _t = m_ayTasks[m_sTasks];
+            _t.body = task_type(utb::forward<TFn>(fn));
+            _t.priority = priority;
+            _t.stats = stats_type{ 0, 0, 0 };
+            return task_id(m_sTasks++);
+        }
+
+        /**
+         * @brief Make a task ready, also while it is running.
+         * @return False when the task was ready already.
+         */
+        bool post(task_id id) {
+            assert(id < m_sTasks);
+            task_node& _t = m_ayTasks[id];
+            if (_t.is_linked()) return false;
+
+            m_ayQueues[_t.priority].push_back(_t);
+            m_iReady |= uint32_t(1) << _t.priority;
+            return true;
+        }
+
+    #if UTB_CONFIG_ENABLE_ATOMIC == UTB_YES
+        /**
+         * @brief Make a task ready from an interrupt or another thread, lock-free.
+         */
+        void post_from_isr(task_id id) {
+            assert(id < TTasks);
+            atomic_word::fetch_or(&m_ayPending[id / 32], uint32_t(1) << (id % 32), memory_order::Release);
+        }
+    #endif
+
+        /**
+         * @brief Post a task after delay ticks of tick().
+         * @return The timer, to cancel the deferral with cancel_deferred().
+         */
+        timer_id defer(task_id id, tick_type delay) {
+            assert(id < m_sTasks);
+            return m_timers.schedule(delay, deferred_post{ this, id });
+        }
+
+        bool cancel_deferred(timer_id timer)                    { return m_timers.cancel(timer); }
+
+        /**
+         * @brief Advance the time of the deferred tasks by n ticks.
+         * @return The number of deferred tasks that were posted.
+         */
+        size_type tick(tick_type n = 1)                         { return m_timers.advance(n); }
+
+        /**
+         * @brief Run the ready task with the highest priority once.
+         * @return False when no task was ready.
+         */
+        bool run_once() {
+        #if UTB_CONFIG_ENABLE_ATOMIC == UTB_YES
+            collect_pending();
+        #endif
+            if (m_iReady == 0) return false;
+
+            const size_type _priority = nlz(m_iReady);
+            list_type& _queue = m_ayQueues[_priority];
+
+            task_node& _t = _queue.front();
+            _queue.pop_front();
+            if (_queue.empty()) m_iReady &= ~(uint32_t(1) << _priority);
+
+            m_iCurrent = task_id(&_t - m_ayTasks);
+            const time_type _start = clock_type::now();
+            _t.body();
+            const time_type _elapsed = time_type(clock_type::now() - _start);
+            m_iCurrent = invalid_task;
+
+            ++_t.stats.runs;
+            _t.stats.total += _elapsed;
+            if (_elapsed > _t.stats.max) _t.stats.max = _elapsed;
+            return true;
+        }
+
+        /**
+         * @brief Run ready tasks until none is ready.
+         * @return The number of task runs.
+         */
+        size_type run() {
+            size_type _runs = 0;
+            while (run_once()) ++_runs;
+            return _runs;
+        }
+
+        /// The running task, invalid_task outside of a task.
+        task_id current() const noexcept                        { return m_iCurrent; }
+        bool is_ready(task_id id) const                         { return m_ayTasks[id].is_linked(); }
+        bool idle() const noexcept                              { return m_iReady == 0; }
+
+        const stats_type& stats(task_id id) const               { return m_ayTasks[id].stats; }
+        void reset_stats(task_id id)                            { m_ayTasks[id].stats = stats_type{ 0, 0, 0 }; }
+
+        size_type size() const noexcept                         { return m_sTasks; }
+        constexpr size_type capacity() const noexcept           { return TTasks; }
+
+    private:
+        struct task_node : intrusive_list_hook {
+            task_type body;
+            stats_type stats;
+            uint8_t priority;
+        };
+        using list_type = basic_intrusive_list<task_node>;
+
+        struct deferred_post {
+            self_type* scheduler;
+            task_id id;
+            void operator()() const                             { scheduler->post(id); }
+        };
+
+    #if UTB_CONFIG_ENABLE_ATOMIC == UTB_YES
+        static constexpr size_type pending_words = (TTasks + 31) / 32;
+        using atomic_word = utb::atomic::gcc_atomic_type<uint32_t>;
+
+        void collect_pending() {
+            for (size_type w = 0; w < pending_words; ++w) {
+                if (atomic_word::load(&m_ayPending[w], memory_order::Relaxed) == 0) continue;
+
+                uint32_t _bits = atomic_word::exchange(&m_ayPending[w], 0, memory_order::Acquire);
+                while (_bits) {
+                    const size_type _bit = nlz(_bits);
+                    _bits &= ~(uint32_t(1) << _bit);
+                    if (w * 32 + _bit < m_sTasks) post(task_id(w * 32 + _bit));
+                }
+            }
+        }
+
+        volatile uint32_t m_ayPending[pending_words];
+    #endif
+
+        task_node m_ayTasks[TTasks];
+        list_type m_ayQueues[TPriorities];
+        basic_timer_wheel<TTasks> m_timers;
+        size_type m_sTasks;
+        uint32_t m_iReady;
+        task_id m_iCurrent;
+    };
+
+    template <utb::size_t TTasks, utb::size_t TPriorities = 8>
+    using scheduler = basic_scheduler<TTasks, TPriorities>;
+}
+
+#endif // __UT_SCHEDULER_H__
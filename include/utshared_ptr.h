@@ -13,10 +13,70 @@
 #include "utconfig.h"
 #include "utatomic.h"
 #include "utfunctional.h"
+#include "utpool.h"
 
 namespace utb {
 
-    template < typename T, typename TRefType >
+    /**
+     * @brief The default deleter of basic_shared_ptr, calls delete on the object and on the
+     * reference counter.
+     */
+    template <typename T>
+    struct default_delete {
+        void operator()(T* p) const { delete p; }
+
+        template <typename TRefType>
+        void operator()(T* p, TRefType* count) const { delete p; delete count; }
+    };
+
+    /**
+     * @brief One pool block of make_pooled(): the reference counter next to the object, so a
+     * pooled shared pointer needs no heap.
+     * @code
+     * static utb::pool<utb::shared_block<message>, 16> messages;
+     * auto m = utb::make_pooled<message>(messages, id, payload);
+     * @endcode
+     */
+    template <typename T, typename TRefType = utb::size_t>
+    struct shared_block {
+        using value_type = T;
+        using count_type = TRefType;
+
+        count_type count;
+        value_type value;
+
+        template <typename... Args>
+        explicit shared_block(Args&&... args) : count(1), value(utb::forward<Args>(args)...) { }
+    };
+
+    /**
+     * @brief The deleter of make_pooled(): gives the whole shared_block back to its pool.
+     * Without a pool (e.g. after reset(new T)) it deletes the object and the counter like default_delete.
+     */
+    template <class TPool>
+    struct shared_block_deleter {
+        TPool* pool;
+        typename TPool::pointer block;
+
+        shared_block_deleter(TPool* p = nullptr, typename TPool::pointer b = nullptr) noexcept
+            : pool(p), block(b) { }
+
+        template <typename T, typename TRefType>
+        void operator()(T* p, TRefType* count) const {
+            if (pool != nullptr) pool->destroy(block);
+            else { delete p; delete count; }
+        }
+    };
+
+    /**
+     * @brief Shared pointer.
+     *
+     * All copies share one reference counter; the raw pointer constructor allocates it with new,
+     * make_pooled() keeps it in the pool block of the object.
+     * @tparam TDeleter Called as deleter(ptr, counter) when the last reference is gone, it frees
+     * the object and the counter.
+     */
+    template < typename T, typename TRefType, typename TDeleter = default_delete<T> >
     class basic_shared_ptr   {
     public:
         using value_type = T;
@@ -25,37 +85,63 @@ namespace utb {
         using const_value_type = const value_type;
         using pointer = value_type*;
         using ref_type = TRefType;
+        using deleter_type = TDeleter;
 
-        using self_type = basic_shared_ptr<value_type, ref_type>;
+        using self_type = basic_shared_ptr<value_type, ref_type, deleter_type>;
 
+        basic_shared_ptr() : m_ptr(0), m_pCount(0), m_deleter() { }
 
-        explicit basic_shared_ptr(pointer ptr )
-            : m_ref(1), m_ptr(ptr)  { }
+        explicit basic_shared_ptr(pointer ptr, const deleter_type& deleter = deleter_type() )
+            : m_ptr(ptr), m_pCount(ptr ? new ref_type(1) : 0), m_deleter(deleter)  { }
 
-        basic_shared_ptr(const self_type& sp) {
-            assert( (++m_ref != 0) );
-            m_ptr = sp.m_ptr;
+        /// Take ptr with an existing counter of 1, e.g. of a shared_block.
+        basic_shared_ptr(pointer ptr, ref_type* count, const deleter_type& deleter)
+            : m_ptr(ptr), m_pCount(count), m_deleter(deleter)  { }
+
+        basic_shared_ptr(const self_type& sp)
+            : m_ptr(sp.m_ptr), m_pCount(sp.m_pCount), m_deleter(sp.m_deleter) {
+            if (m_pCount != 0) ++(*m_pCount);
+        }
+
+        basic_shared_ptr(self_type&& sp)
+            : m_ptr(sp.m_ptr), m_pCount(sp.m_pCount), m_deleter(sp.m_deleter) {
+            sp.m_ptr = 0;
+            sp.m_pCount = 0;
         }
 
         ~basic_shared_ptr() {
-            if (--m_ref == 0) delete m_ptr;
+            release();
         }
 
+        /**
+         * @brief Drop this reference, the last one frees the object.
+         * @return The pointer this held.
+         */
         pointer release() {
             pointer __px = this->get();
-            if (--m_ref == 0) delete m_ptr;
+            if (m_pCount != 0 && --(*m_pCount) == 0) m_deleter(m_ptr, m_pCount);
 
+            m_ptr = 0;
+            m_pCount = 0;
             return __px;
         }
+        /// Take pValue with a new counter and a default deleter, the deleter of the old object stays with it.
         void reset( pointer pValue = 0)
-            { self_type(pValue).swap(*this); }
+            { self_type(pValue, deleter_type()).swap(*this); }
+
+        deleter_type& get_deleter() { return m_deleter; }
 
-        ref_type ref() {
-            return m_ref;
+        /// The number of basic_shared_ptr sharing the object, 0 when empty.
+        utb::size_t use_count() const {
+            return m_pCount != 0 ? utb::size_t(*m_pCount) : 0;
+        }
+        utb::size_t ref() const {
+            return use_count();
         }
         void swap(self_type& b) {
             utb::swap<pointer>(m_ptr, b.m_ptr);
-            utb::swap<ref_type >(m_ref, b.m_ref);
+            utb::swap<ref_type* >(m_pCount, b.m_pCount);
+            utb::swap<deleter_type >(m_deleter, b.m_deleter);
         }
 
         pointer get() const {
@@ -74,15 +160,18 @@ namespace utb {
             return m_ptr != 0;
         }
 
-        self_type& operator = (self_type& sp) {
-            release();
-            m_ptr = sp.m_ptr;
-            m_ref = sp.m_ref;
+        self_type& operator = (const self_type& sp) {
+            self_type(sp).swap(*this);
+            return *this;
+        }
+        self_type& operator = (self_type&& sp) {
+            self_type(utb::move(sp)).swap(*this);
             return *this;
         }
     private:
-        ref_type m_ref;
         pointer m_ptr;
+        ref_type* m_pCount;
+        deleter_type m_deleter;
     };
 
     #if UTB_ATOMIC == 1
@@ -97,6 +186,24 @@ namespace utb {
     inline shared_ptr<T>  make_shared(Args&&... args) {
         return shared_ptr<T>(new T (utb::forward<Args>(args)...) );
     }
+
+    /**
+     * @brief Create the object in a pool of shared_block<T, TRefType> (utpool.h), the last
+     * reference gives the block back.
+     * @return The pointer, empty when the pool is exhausted.
+     */
+    template<typename T, class TPool, typename... Args >
+    inline basic_shared_ptr<T, typename TPool::value_type::count_type, shared_block_deleter<TPool> >
+    make_pooled(TPool& pool, Args&&... args) {
+        using block_type = typename TPool::value_type;
+        using result_type = basic_shared_ptr<T, typename block_type::count_type, shared_block_deleter<TPool> >;
+        static_assert(utb::is_same<typename block_type::value_type, T>::value,
+                      "make_pooled<T> needs a pool of utb::shared_block<T>.");
+
+        block_type* _block = pool.create(utb::forward<Args>(args)...);
+        if (_block == nullptr) return result_type();
+        return result_type(&_block->value, &_block->count, shared_block_deleter<TPool>(&pool, _block));
+    }
 }
 
 #endif // __UTSHARED_PTR_H__
\ No newline at end of file
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_SIMD_H__
+#define __UT_SIMD_H__
+
+#include "utconfig.h"
+#include <stdint.h>
+#include <string.h>
+
+#if UTB_CONFIG_ENABLE_SIMD == UTB_YES
+    #if defined(__AVX2__)
+        #include <immintrin.h>
+        #define UTB_SIMD_AVX2 1
+        #define UTB_SIMD_SSE2 1
+    #elif defined(__SSE2__)
+        #include <emmintrin.h>
+        #define UTB_SIMD_SSE2 1
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>
+        #define UTB_SIMD_NEON 1
+    #endif
+#endif
+
+#ifndef UTB_SIMD_AVX2
+#define UTB_SIMD_AVX2 0
+#endif
+#ifndef UTB_SIMD_SSE2
+#define UTB_SIMD_SSE2 0
+#endif
+#ifndef UTB_SIMD_NEON
+#define UTB_SIMD_NEON 0
+#endif
+
+namespace utb {
+    namespace internal {
+        /**
+         * @brief Bulk memory kernels for trivially copyable data.
+         *
+         * Every kernel picks a path by size class:
+         *  - tiny  (< 16 bytes): inline byte/word loop, no call overhead
+         *  - small (< 256 bytes): unaligned 16/32 byte vectors, the tail is an overlapping vector store
+         *  - large: unaligned vector prologue up to the next aligned address, aligned stores, overlapping vector epilogue
+         * Without SSE2/AVX2 the small/large classes use word stores (fill) or the C library (copy/move).
+         */
+        namespace simd {
+            constexpr utb::size_t tiny_limit = 16;
+            constexpr utb::size_t small_limit = 256;
+
+        #if UTB_SIMD_AVX2
+            constexpr utb::size_t vector_size = 32;
+            using vector_type = __m256i;
+
+            inline vector_type load(const void* p)           { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+            inline void store(void* p, vector_type v)        { _mm256_storeu_si256(static_cast<__m256i*>(p), v); }
+            inline void store_aligned(void* p, vector_type v) { _mm256_store_si256(static_cast<__m256i*>(p), v); }
+            inline vector_type broadcast(uint64_t pattern)   { return _mm256_set1_epi64x(int64_t(pattern)); }
+        #elif UTB_SIMD_SSE2
+            constexpr utb::size_t vector_size = 16;
+            using vector_type = __m128i;
+
+            inline vector_type load(const void* p)           { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+            inline void store(void* p, vector_type v)        { _mm_storeu_si128(static_cast<__m128i*>(p), v); }
+            inline void store_aligned(void* p, vector_type v) { _mm_store_si128(static_cast<__m128i*>(p), v); }
+            inline vector_type broadcast(uint64_t pattern)   { return _mm_set1_epi64x(int64_t(pattern)); }
+        #endif
+
+            /// Repeat a 1, 2, 4 or 8 byte value to a 64 bit pattern.
+            inline uint64_t widen_pattern(const void* value, utb::size_t size) {
+                uint64_t _pattern = 0;
+                switch (size) {
+                    case 1: { uint8_t v;  memcpy(&v, value, 1); _pattern = v * 0x0101010101010101ULL; } break;
+                    case 2: { uint16_t v; memcpy(&v, value, 2); _pattern = v * 0x0001000100010001ULL; } break;
+                    case 4: { uint32_t v; memcpy(&v, value, 4); _pattern = v * 0x0000000100000001ULL; } break;
+                    default: memcpy(&_pattern, value, 8); break;
+                }
+                return _pattern;
+            }
+
+            /// The pattern as seen from byte offset, the fill keeps the phase of the byte index.
+            inline uint64_t rotate_pattern(uint64_t pattern, utb::size_t offset) {
+                const utb::size_t _k = offset & 7;
+                return _k ? (pattern >> (_k * 8)) | (pattern << ((8 - _k) * 8)) : pattern;
+            }
+
+            /**
+             * @brief Fill bytes bytes at dest with a 64 bit pattern, dest must be aligned to the element size.
+             */
+            inline void fill_pattern(void* dest, utb::size_t bytes, uint64_t pattern) {
+                uint8_t* _dst = static_cast<uint8_t*>(dest);
+                const uint8_t* _pat = reinterpret_cast<const uint8_t*>(&pattern);
+
+                if (bytes < tiny_limit) {
+                    for (utb::size_t i = 0; i < bytes; ++i) _dst[i] = _pat[i & 7];
+                    return;
+                }
+            #if UTB_SIMD_SSE2
+                if (bytes < vector_size) {
+                    for (utb::size_t i = 0; i < bytes; ++i) _dst[i] = _pat[i & 7];
+                    return;
+                }
+                const vector_type _v = broadcast(pattern);
+                // the last vector ends exactly at bytes and overlaps the ones before
+                const vector_type _vt = broadcast(rotate_pattern(pattern, bytes - vector_size));
+
+                if (bytes < small_limit || bytes < 2 * vector_size) {
+                    utb::size_t i = 0;
+                    for (; i + vector_size <= bytes; i += vector_size) store(_dst + i, _v);
+                    if (i < bytes) store(_dst + bytes - vector_size, _vt);
+                    return;
+                }
+                // prologue: one unaligned vector, then continue at the next aligned address
+                store(_dst, _v);
+                utb::size_t i = vector_size - (reinterpret_cast<uintptr_t>(_dst) & (vector_size - 1));
+                // i is a multiple of the element size, but maybe not of 8: rotate the pattern
+                const vector_type _va = broadcast(rotate_pattern(pattern, i));
+
+                for (; i + vector_size <= bytes; i += vector_size) store_aligned(_dst + i, _va);
+                // epilogue: the rest is shorter than one vector
+                if (i < bytes) store(_dst + bytes - vector_size, _vt);
+            #else
+                utb::size_t i = 0;
+                // byte prologue until dest is word aligned, so the word memcpy compiles to one aligned store;
+                // the pattern phase follows the byte index
+                for (; i < bytes && (reinterpret_cast<uintptr_t>(_dst + i) & (sizeof(uintptr_t) - 1)); ++i)
+                    _dst[i] = _pat[i & 7];
+
+                // words shorter than the 64 bit pattern cycle through its parts
+                constexpr utb::size_t _count = (sizeof(uintptr_t) < 8) ? 8 / sizeof(uintptr_t) : 1;
+                uintptr_t _words[_count];
+                for (utb::size_t k = 0; k < _count; ++k) {
+                    uint8_t* _w = reinterpret_cast<uint8_t*>(&_words[k]);
+                    for (utb::size_t b = 0; b < sizeof(uintptr_t); ++b)
+                        _w[b] = _pat[(i + k * sizeof(uintptr_t) + b) & 7];
+                }
+                for (utb::size_t k = 0; i + sizeof(uintptr_t) <= bytes; i += sizeof(uintptr_t)) {
+                    memcpy(_dst + i, &_words[k], sizeof(uintptr_t));
+                    if (++k == _count) k = 0;
+                }
+                for (; i < bytes; ++i) _dst[i] = _pat[i & 7];
+            #endif
+            }
+
+            /**
+             * @brief Copy n bytes, the ranges may not overlap.
+             */
+            inline void copy_bytes(void* dest, const void* src, utb::size_t bytes) {
+                uint8_t* _dst = static_cast<uint8_t*>(dest);
+                const uint8_t* _src = static_cast<const uint8_t*>(src);
+
+                if (bytes < tiny_limit) {
+                    for (utb::size_t i = 0; i < bytes; ++i) _dst[i] = _src[i];
+                    return;
+                }
+            #if UTB_SIMD_SSE2
+                if (bytes < vector_size) {
+                    memcpy(_dst, _src, bytes);
+                    return;
+                }
+                if (bytes < small_limit) {
+                    utb::size_t i = 0;
+                    for (; i + vector_size <= bytes; i += vector_size) store(_dst + i, load(_src + i));
+                    // overlapping tail, the last vector ends exactly at bytes
+                    if (i < bytes) store(_dst + bytes - vector_size, load(_src + bytes - vector_size));
+                    return;
+                }
+                const vector_type _head = load(_src);
+                const vector_type _tail = load(_src + bytes - vector_size);
+
+                utb::size_t i = vector_size - (reinterpret_cast<uintptr_t>(_dst) & (vector_size - 1));
+                for (; i + vector_size <= bytes; i += vector_size) store_aligned(_dst + i, load(_src + i));
+
+                store(_dst, _head);
+                store(_dst + bytes - vector_size, _tail);
+            #else
+                memcpy(_dst, _src, bytes);
+            #endif
+            }
+
+            /**
+             * @brief Copy n bytes, the ranges may overlap.
+             */
+            inline void move_bytes(void* dest, const void* src, utb::size_t bytes) {
+                uint8_t* _dst = static_cast<uint8_t*>(dest);
+                const uint8_t* _src = static_cast<const uint8_t*>(src);
+
+                if (_dst == _src || bytes == 0) return;
+
+                if (_dst + bytes <= _src || _src + bytes <= _dst) {
+                    copy_bytes(_dst, _src, bytes);
+                    return;
+                }
+            #if UTB_SIMD_SSE2
+                if (bytes >= vector_size) {
+                    // Load the first and last vector up front, then walk away from the overlap
+                    const vector_type _head = load(_src);
+                    const vector_type _tail = load(_src + bytes - vector_size);
+
+                    if (_dst < _src) {
+                        for (utb::size_t i = vector_size; i + vector_size < bytes; i += vector_size)
+                            store(_dst + i, load(_src + i));
+                    } else if (bytes >= 2 * vector_size) {
+                        // the second vector closes the gap the backward steps leave above the head
+                        const vector_type _second = load(_src + vector_size);
+
+                        for (utb::size_t i = bytes - 2 * vector_size; i > vector_size; i -= vector_size)
+                            store(_dst + i, load(_src + i));
+                        store(_dst + vector_size, _second);
+                    }
+                    store(_dst, _head);
+                    store(_dst + bytes - vector_size, _tail);
+                    return;
+                }
+            #endif
+                memmove(_dst, _src, bytes);
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_SPSC_QUEUE_H__
+#define __UT_SPSC_QUEUE_H__
+
+#include "utconfig.h"
+#if UTB_CONFIG_ENABLE_ATOMIC == UTB_YES
+
+#include "utalgorithm.h"
+#include "atomic/utatomic_types.h"
+
+namespace utb {
+
+    /**
+     * @brief Lock-free, fixed-capacity single-producer/single-consumer ring.
+     *
+     * One context (e.g. an ISR) may only push, one other context (e.g. the main loop) may only pop.
+     * The head and tail counters run freely and live on their own cache line, each side keeps a
+     * cached copy of the other side's counter and reloads it with acquire ordering only when the
+     * cached value says the queue is full or empty. Published counters are stored with release
+     * ordering, so the element data is visible before the counter moves.
+     *
+     * @tparam T The element type, must be default constructible and copy assignable.
+     * @tparam TCapacity The number of slots, must be a power of two.
+     */
+    template <typename T, utb::size_t TCapacity>
+    class basic_spsc_queue {
+        static_assert(TCapacity > 1, "Capacity must be greater than one.");
+        static_assert((TCapacity & (TCapacity - 1)) == 0, "Capacity must be a power of two.");
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using reference = T&;
+        using const_reference = const T&;
+        using size_type = utb::size_t;
+        using self_type = basic_spsc_queue<T, TCapacity>;
+
+        using atomic_index = utb::atomic::gcc_atomic_type<size_type>;
+
+        basic_spsc_queue() noexcept
+            : m_sHead(0), m_sTailCache(0), m_sTail(0), m_sHeadCache(0), m_ayData() { }
+
+        basic_spsc_queue(const self_type&) = delete;
+        self_type& operator=(const self_type&) = delete;
+
+        /**
+         * @brief Producer: append a single element.
+         * @return True when the element was pushed, false when the queue is full.
+         */
+        bool try_push(const_reference value) noexcept {
+            const size_type _tail = atomic_index::load(&m_sTail, memory_order::Relaxed);
+
+            if (_tail - m_sHeadCache == TCapacity) {
+                m_sHeadCache = atomic_index::load(&m_sHead, memory_order::Acquire);
+                if (_tail - m_sHeadCache == TCapacity) return false;
+            }
+            m_ayData[_tail & mask] = value;
+            atomic_index::store(&m_sTail, _tail + 1, memory_order::Release);
+            return true;
+        }
+
+        /**
+         * @brief Producer: append up to n elements with a single publish.
+         * @return The number of pushed elements.
+         */
+        size_type push_n(const_pointer pSource, size_type n) noexcept {
+            const size_type _tail = atomic_index::load(&m_sTail, memory_order::Relaxed);
+            size_type _free = TCapacity - (_tail - m_sHeadCache);
+
+            if (_free < n) {
+                m_sHeadCache = atomic_index::load(&m_sHead, memory_order::Acquire);
+                _free = TCapacity - (_tail - m_sHeadCache);
+            }
+            n = utb::min<size_type>(n, _free);
+            if (n == 0) return 0;
+
+            const size_type _index = _tail & mask;
+            const size_type _first = utb::min<size_type>(n, TCapacity - _index);
+
+            utb::copy_n(pSource, _first, m_ayData + _index);
+            if (n > _first) utb::copy_n(pSource + _first, n - _first, m_ayData);
+
+            atomic_index::store(&m_sTail, _tail + n, memory_order::Release);
+            return n;
+        }
+
+        /**
+         * @brief Consumer: remove the oldest element.
+         * @return True when an element was popped to value, false when the queue is empty.
+         */
+        bool try_pop(reference value) noexcept {
+            const size_type _head = atomic_index::load(&m_sHead, memory_order::Relaxed);
+
+            if (_head == m_sTailCache) {
+                m_sTailCache = atomic_index::load(&m_sTail, memory_order::Acquire);
+                if (_head == m_sTailCache) return false;
+            }
+            value = m_ayData[_head & mask];
+            atomic_index::store(&m_sHead, _head + 1, memory_order::Release);
+            return true;
+        }
+
+        /**
+         * @brief Consumer: remove up to n elements with a single publish.
+         * @return The number of popped elements.
+         */
+        size_type pop_n(pointer pDest, size_type n) noexcept {
+            const size_type _head = atomic_index::load(&m_sHead, memory_order::Relaxed);
+            size_type _used = m_sTailCache - _head;
+
+            if (_used < n) {
+                m_sTailCache = atomic_index::load(&m_sTail, memory_order::Acquire);
+                _used = m_sTailCache - _head;
+            }
+            n = utb::min<size_type>(n, _used);
+            if (n == 0) return 0;
+
+            const size_type _index = _head & mask;
+            const size_type _first = utb::min<size_type>(n, TCapacity - _index);
+
+            utb::copy_n(m_ayData + _index, _first, pDest);
+            if (n > _first) utb::copy_n(m_ayData, n - _first, pDest + _first);
+
+            atomic_index::store(&m_sHead, _head + n, memory_order::Release);
+            return n;
+        }
+
+        /**
+         * @brief Get the number of elements, exact only when called from the producer or the consumer.
+         */
+        size_type size() const noexcept {
+            const size_type _head = atomic_index::load(const_cast<volatile size_type*>(&m_sHead), memory_order::Acquire);
+            const size_type _tail = atomic_index::load(const_cast<volatile size_type*>(&m_sTail), memory_order::Acquire);
+            return _tail - _head;
+        }
+
+        bool empty() const noexcept                         { return size() == 0; }
+        bool full() const noexcept                          { return size() == TCapacity; }
+        constexpr size_type capacity() const noexcept       { return TCapacity; }
+
+    private:
+        static constexpr size_type mask = TCapacity - 1;
+
+        // consumer side
+        alignas(UTB_CONFIG_CACHE_LINE_SIZE) volatile size_type m_sHead;
+        size_type m_sTailCache;
+
+        // producer side
+        alignas(UTB_CONFIG_CACHE_LINE_SIZE) volatile size_type m_sTail;
+        size_type m_sHeadCache;
+
+        alignas(UTB_CONFIG_CACHE_LINE_SIZE) value_type m_ayData[TCapacity];
+    };
+
+    template <typename T, utb::size_t TCapacity>
+    using spsc_queue = basic_spsc_queue<T, TCapacity>;
+}
+
+#endif // UTB_CONFIG_ENABLE_ATOMIC
+#endif // __UT_SPSC_QUEUE_H__
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_TIMER_WHEEL_H__
+#define __UT_TIMER_WHEEL_H__
+
+#include "utconfig.h"
+#include "utfunction.h"
+#include "utintrusive_list.h"
+
+namespace utb {
+
+    /// Handle of a scheduled timer, 0 is never a valid handle.
+    using timer_id = uint32_t;
+    constexpr timer_id invalid_timer = 0;
+
+    /**
+     * @brief Hierarchical timing wheel for many software timers with static storage.
+     *
+     * TLevels wheels of 2^TSlotBits slots each; level l holds the timers that expire within
+     * 2^(TSlotBits * (l + 1)) ticks. schedule() and cancel() are O(1). tick() fires the whole
+     * level 0 slot of the new time; every 2^TSlotBits ticks one slot of the next level is moved
+     * down (cascaded), so the work per tick does not depend on the number of pending timers.
+     * Delays beyond the range of the top level are parked in the top level and re-placed when
+     * they cascade.
+     *
+     * The callbacks run inside tick() and may schedule or cancel timers, also their own.
+     * @code
+     * static utb::timer_wheel<256> timers;
+     *
+     * utb::timer_id retry = timers.schedule(50, []() { resend(); });
+     * ...
+     * timers.cancel(retry);
+     *
+     * void SysTick_Handler() { timers.tick(); }   // or from the main loop
+     * @endcode
+     *
+     * @tparam TCapacity The maximal number of pending timers, below 65536.
+     * @tparam TCallback The callback, called as cb().
+     * @tparam TLevels The number of wheels.
+     * @tparam TSlotBits log2 of the slots per wheel.
+     */
+    template <utb::size_t TCapacity, class TCallback = utb::function<void()>,
+              utb::size_t TLevels = 4, utb::size_t TSlotBits = 6>
+    class basic_timer_wheel {
+        static_assert(TCapacity > 0 && TCapacity < 0x10000, "The capacity must be in 1 - 65535.");
+        static_assert(TLevels > 0 && TSlotBits > 0 && TLevels * TSlotBits < 32, "The wheels must fit 32 bit ticks.");
+    public:
+        using callback_type = TCallback;
+        using size_type = utb::size_t;
+        using tick_type = uint32_t;
+        using self_type = basic_timer_wheel<TCapacity, TCallback, TLevels, TSlotBits>;
+
+        static constexpr size_type slots = size_type(1) << TSlotBits;
+        /// The longest delay that is placed directly, longer ones cascade through the top level.
+        static constexpr tick_type max_delay = (tick_type(1) << (TSlotBits * TLevels)) - 1;
+
+        basic_timer_wheel() noexcept : m_iNow(0) {
+            for (size_type i = 0; i < TCapacity; ++i) {
+                m_ayTimers[i].generation = 1;
+                m_free.push_back(m_ayTimers[i]);
+            }
+        }
+
+        basic_timer_wheel(const self_type&) = delete;
+        self_type& operator=(const self_type&) = delete;
+
+        ~basic_timer_wheel() {
+            for (size_type l = 0; l < TLevels; ++l)
+                for (size_type s = 0; s < slots; ++s) m_ayWheels[l][s].clear();
+            m_free.clear();
+        }
+
+        /**
+         * @brief Call fn after delay ticks, at least one.
+         * @return The handle, invalid_timer when all timers are in use.
+         */
+        template <class TFn>
+        timer_id schedule(tick_type delay, TFn&& fn) {
+            if (m_free.empty()) return invalid_timer;
+
+            timer_node& _t = m_free.front();
+            m_free.pop_front();
+
+            _t.callback = callback_type(utb::forward<TFn>(fn));
+            _t.expires = m_iNow + (delay == 0 ? 1 : delay);
+            place(_t);
+            return make_id(_t);
+        }
+
+        /**
+         * @brief Stop a pending timer.
+         * @return False when the timer has fired or was cancelled already.
+         */
+        bool cancel(timer_id id) {
+            const size_type _index = index_of(id);
+            if (_index == TCapacity) return false;
+
+            timer_node& _t = m_ayTimers[_index];
+            m_ayWheels[_t.level][_t.slot].erase(_t);
+            release(_t);
+            return true;
+        }
+
+        /**
+         * @brief The ticks until the timer fires, 0 when it is not pending.
+         */
+        tick_type remaining(timer_id id) const {
+            const size_type _index = index_of(id);
+            return _index == TCapacity ? 0 : tick_type(m_ayTimers[_index].expires - m_iNow);
+        }
+
+        bool pending(timer_id id) const                         { return remaining(id) != 0; }
+
+        /**
+         * @brief Advance the time by one tick and fire the timers that expire.
+         * @return The number of callbacks that were called.
+         */
+        size_type tick() {
+            ++m_iNow;
+
+            // move the due slot of each upper level down, as far as the lower level wrapped
+            for (size_type l = 1; l < TLevels; ++l) {
+                if (((m_iNow >> (TSlotBits * (l - 1))) & (slots - 1)) != 0) break;
+                cascade(l, (m_iNow >> (TSlotBits * l)) & (slots - 1));
+            }
+
+            list_type& _due = m_ayWheels[0][m_iNow & (slots - 1)];
+            size_type _fired = 0;
+
+            while (!_due.empty()) {
+                timer_node& _t = _due.front();
+                _due.pop_front();
+
+                _t.level = firing;
+                _t.callback();
+                release(_t);
+                ++_fired;
+            }
+            return _fired;
+        }
+
+        /**
+         * @brief Advance the time by n ticks.
+         * @return The number of callbacks that were called.
+         */
+        size_type advance(tick_type n) {
+            size_type _fired = 0;
+            while (n--) _fired += tick();
+            return _fired;
+        }
+
+        tick_type now() const noexcept                          { return m_iNow; }
+        size_type size() const noexcept                         { return TCapacity - m_free.size(); }
+        bool empty() const noexcept                             { return size() == 0; }
+        constexpr size_type capacity() const noexcept           { return TCapacity; }
+
+    private:
+        static constexpr uint8_t unused = 0xFF;
+        static constexpr uint8_t firing = 0xFE;
+
+        struct timer_node : intrusive_list_hook {
+            callback_type callback;
+            tick_type expires;
+            uint16_t generation;
+            uint8_t level;
+            uint8_t slot;
+
+            timer_node() : expires(0), generation(1), level(unused), slot(0) { }
+        };
+        using list_type = basic_intrusive_list<timer_node>;
+
+        void place(timer_node& t) {
+            tick_type _delta = t.expires - m_iNow;
+            tick_type _at = t.expires;
+
+            if (_delta > max_delay) { _delta = max_delay; _at = m_iNow + max_delay; }
+
+            size_type _level = 0;
+            while (_level + 1 < TLevels && _delta >= (tick_type(1) << (TSlotBits * (_level + 1)))) ++_level;
+
+            t.level = uint8_t(_level);
+            t.slot = uint8_t((_at >> (TSlotBits * _level)) & (slots - 1));
+            m_ayWheels[_level][t.slot].push_back(t);
+        }
+
+        void cascade(size_type level, size_type slot) {
+            list_type& _list = m_ayWheels[level][slot];
+            while (!_list.empty()) {
+                timer_node& _t = _list.front();
+                _list.pop_front();
+                place(_t);
+            }
+        }
+
+        void release(timer_node& t) {
+            t.callback = callback_type();
+            t.level = unused;
+            if (++t.generation == 0) t.generation = 1;
+            m_free.push_front(t);
+        }
+
+        timer_id make_id(const timer_node& t) const {
+            return (timer_id(t.generation) << 16) | timer_id(&t - m_ayTimers);
+        }
+
+        /// The index of the pending timer id, TCapacity when it is not pending.
+        size_type index_of(timer_id id) const {
+            const size_type _index = id & 0xFFFF;
+            if (id == invalid_timer || _index >= TCapacity) return TCapacity;
+
+            const timer_node& _t = m_ayTimers[_index];
+            return (_t.generation == uint16_t(id >> 16) && _t.level < TLevels) ? _index : TCapacity;
+        }
+
+        timer_node m_ayTimers[TCapacity];
+        list_type m_ayWheels[TLevels][slots];
+        list_type m_free;
+        tick_type m_iNow;
+    };
+
+    template <utb::size_t TCapacity>
+    using timer_wheel = basic_timer_wheel<TCapacity>;
+}
+
+#endif // __UT_TIMER_WHEEL_H__
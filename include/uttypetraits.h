@@ -81,7 +81,7 @@ namespace utb {
 		using value_type = T*;
 		using const_type = const T*;
 		using reference = T*&;
-		using const_reference = const T*&;
+		using const_reference = T* const&;
 		using pointer = T*;
 		using const_pointer = const T*;
 	};
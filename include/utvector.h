@@ -12,6 +12,7 @@
 #include "utconfig.h"
 #include "utalgorithm.h"
 #include "utalignment.h"
+#include "uttypetraits.h"
 
 namespace utb {
 
@@ -39,26 +40,28 @@ namespace utb {
         using size_type = size_t;
         using self_type = basic_vector<T, TCapacity>;
 
-        explicit basic_fixed_vector()
-            : m_begin((pointer)&m_data[0]),
+        static constexpr size_type npos = size_type(-1);
+
+        basic_vector()
+            : m_begin(reinterpret_cast<pointer>(&m_data[0])),
                 m_end(m_begin),
                 m_capacityEnd(m_begin + TCapacity),
-                m_max_size(0) { } 
+                m_max_size(TCapacity) { } 
 
-        explicit basic_fixed_vector(size_type initialSize)
-            : m_begin((pointer)&m_data[0]),
+        explicit basic_vector(size_type initialSize)
+            : m_begin(reinterpret_cast<pointer>(&m_data[0])),
                 m_end(m_begin),
                 m_capacityEnd(m_begin + TCapacity),
                 m_max_size(TCapacity)  { resize(initialSize); }
 
-        basic_fixed_vector(const pointer first, const pointer last)
-            : m_begin((pointer)&m_data[0]),
+        basic_vector(const_pointer first, const_pointer last)
+            : m_begin(reinterpret_cast<pointer>(&m_data[0])),
                 m_end(m_begin),
                 m_capacityEnd(m_begin + TCapacity),
                 m_max_size(TCapacity) { assign(first, last); }
 
-        basic_fixed_vector(const self_type& rhs)
-            : m_begin((pointer)&m_data[0]),
+        basic_vector(const self_type& rhs)
+            : m_begin(reinterpret_cast<pointer>(&m_data[0])),
                 m_end(m_begin),
                 m_capacityEnd(m_begin + TCapacity),
                 m_max_size(TCapacity) { 
@@ -69,25 +72,28 @@ namespace utb {
             m_end = m_begin + rhs.size();
             assert(invariant());
         }
+
+        ~basic_vector() {
+            shrink(0);
+        }
+
         iterator  		begin() noexcept 			        { return m_begin; }
         constexpr const_iterator 	begin() const noexcept  { return m_begin; }
 
         iterator  		end() noexcept 				        { return m_end; }
         constexpr const_iterator 	end() const noexcept    { return m_end; }
 
-        reference 		front() noexcept 			        { return m_begin; }
-        const_reference front() const noexcept		        { return m_begin; }
+        reference 		front() noexcept 			        { return *m_begin; }
+        const_reference front() const noexcept		        { return *m_begin; }
 
-        reference 		back() noexcept 			        { return m_end; }
-        const_reference back() const noexcept 		        { return m_end; }
+        reference 		back() noexcept 			        { return *(m_end - 1); }
+        const_reference back() const noexcept 		        { return *(m_end - 1); }
 
         size_type 		size() const noexcept 		        { return size_type(m_end - m_begin); }
-
-        size_type size() const                              { return size_type(m_end - m_begin); }
         bool empty() const                                  { return m_begin == m_end; }
         bool full() const                                   { return (m_end == m_capacityEnd); }
 
-        size_type capacity()                                { return size_type(m_capacityEnd - m_begin); }
+        size_type capacity() const                          { return size_type(m_capacityEnd - m_begin); }
 
         void push_back(const_reference v) {
             if (full()) return;
@@ -95,7 +101,8 @@ namespace utb {
         }
         inline void	 push_back (value_type&& v)	{
             if (full()) return;
-            utb::copy_construct(m_end++, utb::move(v));
+            ::new (static_cast<void*>(m_end)) value_type(utb::move(v));
+            ++m_end;
         }
 
         void push_back() {
@@ -104,11 +111,15 @@ namespace utb {
         }
         void pop_back() {
             assert(!empty()); --m_end;
-            utb::destruct<iterator>(m_end);
+            utb::destruct(m_end);
         }
 
-        size_type index_of(const reference item, size_type index = 0) const {
-            assert(index >= 0 && index < size());
+        void assign(const_pointer first, const_pointer last) {
+            shrink(0);
+            for (; first != last && !full(); ++first) push_back(*first);
+        }
+
+        size_type index_of(const_reference item, size_type index = 0) const {
             size_type _pos = npos;
 
             for ( ; index < size(); ++index) {
@@ -119,7 +130,7 @@ namespace utb {
             return _pos;
         }
 
-        iterator find(const reference item) {
+        iterator find(const_reference item) {
             iterator itEnd = end();
 
             for (iterator it = begin(); it != itEnd; ++it)
@@ -130,27 +141,32 @@ namespace utb {
             return it >= begin() && it <= end();
         }
 
-        
-
         void clear() {
             shrink(0);
             assert(invariant());
         }
         void resize(size_type n) {
-            if (n > size()) insert(m_end, n - size(), value_type());
-            else shrink(n);
+            if (n > capacity()) n = capacity();
+            while (size() < n) push_back();
+            shrink(n);
         }
 
         basic_vector& operator=(const basic_vector& rhs) {
-            copy(rhs);
+            if (this == &rhs) return *this;
+
+            shrink(0);
+            utb::copy_construct_n(rhs.m_begin, rhs.size(), m_begin);
+            m_end = m_begin + rhs.size();
             return *this;
         }
         reference operator[](size_type i) {
-            return at(i);
+            assert(i < size());
+            return m_begin[i];
         }
 
-        const reference operator[](size_type i) const {
-            return at(i);
+        const_reference operator[](size_type i) const {
+            assert(i < size());
+            return m_begin[i];
         }
         inline void destroy(pointer ptr, size_type n) {
             utb::destruct_n(ptr, n);
@@ -159,29 +175,48 @@ namespace utb {
             return m_end >= m_begin;
         }
 
-        void insert(iterator it, size_type n, const reference val) {
+        /**
+         * @brief Insert n copies of val before it, as many as fit.
+         */
+        void insert(iterator it, size_type n, const_reference val) {
             assert(validate_iterator(it));
             assert(invariant());
-            insert(size_type(it - m_begin), n, val);
+
+            const size_type _free = capacity() - size();
+            if (n > _free) n = _free;
+            if (n == 0) return;
+
+            const value_type _val(val);     // val may be an element of this vector
+            const size_type _tail = size_type(m_end - it);
+
+            // shift the tail from the back: into raw slots by construction, else by assignment
+            for (size_type i = _tail; i > 0; --i) {
+                pointer _src = it + i - 1, _dst = _src + n;
+                if (_dst >= m_end) utb::copy_construct(_dst, *_src);
+                else *_dst = *_src;
+            }
+            for (size_type i = 0; i < n; ++i) {
+                if (it + i < m_end) it[i] = _val;
+                else utb::copy_construct(it + i, _val);
+            }
+            m_end += n;
+            assert(invariant());
         }
 
         iterator insert(iterator it, const_reference val) {
             assert(validate_iterator(it));
             assert(invariant());
 
-            const size_type index = (size_type)(it - m_begin);
-            if (full()) return;
-
-            utb::construct(m_end);
-            
-            if (m_end > it) {
+            if (full()) return end();
 
-                const size_type prevSize = size();
-                assert(index <= prevSize);
-                const size_type toMove = prevSize - index;
-
-                utb::move_n(it, toMove, it + 1);
+            if (it == m_end) {
+                push_back(val);
+                return it;
             }
+            // the last element moves into the raw slot, the rest is shifted by assignment
+            utb::copy_construct(m_end, *(m_end - 1));
+            utb::move_n(it, size_type(m_end - 1 - it), it + 1);
+
             *it = val;
             ++m_end;
             assert(invariant());
@@ -189,15 +224,28 @@ namespace utb {
             return it;
         }
 
+        /**
+         * @brief Exchange the elements: the common part is swapped, the rest of the longer
+         * vector is moved over; nothing is copied.
+         */
         void swap( self_type& other ) {
-            utb::swap(m_begin, 		other.m_begin);
-            utb::swap(m_end, 		other.m_end);
-            utb::swap(m_capacityEnd, other.m_capacityEnd);
-            utb::swap_n<value_type, TCapacity> (m_data, 	other.m_data);
+            if (this == &other) return;
+
+            self_type& _short = size() < other.size() ? *this : other;
+            self_type& _long = size() < other.size() ? other : *this;
+            const size_type _common = _short.size();
+
+            for (size_type i = 0; i < _common; ++i)
+                utb::swap(m_begin[i], other.m_begin[i]);
+            for (size_type i = _common; i < _long.size(); ++i) {
+                ::new (static_cast<void*>(_short.m_end)) value_type(utb::move(_long.m_begin[i]));
+                ++_short.m_end;
+            }
+            _long.shrink(_common);
         }
     private:
         inline void shrink(size_type newSize) {
-            assert(newSize <= size());
+            if (newSize >= size()) return;
             const size_type toShrink = size() - newSize;
             utb::destruct_n(m_begin + newSize, toShrink);
             m_end = m_begin + newSize;
@@ -205,13 +253,13 @@ namespace utb {
     private:
         pointer m_begin;
         pointer m_end;
-        value_type m_data[(TCapacity];
+        utb::aligned_storage_t<sizeof(value_type), alignof(value_type)> m_data[TCapacity];
         pointer m_capacityEnd;
         size_type  m_max_size;
     };
 
     template<typename T, int TCapacity>
-	using vector =  basic_fixed_vector<T, TCapacity>;
+	using vector =  basic_vector<T, TCapacity>;
 }
 
 
@@ -16,6 +16,13 @@
 
 namespace utb {
     namespace math {
+        namespace internal {
+            /// sqrt in the precision of T; utb::sqrt (utfunctional.h) hides ::sqrt in this namespace.
+            inline float vec_sqrt(float v)                          { return ::sqrtf(v); }
+            inline double vec_sqrt(double v)                        { return ::sqrt(v); }
+            template < typename T >
+            inline T vec_sqrt(T v)                                  { using ::sqrt; return T(sqrt(v)); }
+        }
 
         template < typename T >
         class vector2 {
@@ -132,19 +139,19 @@ namespace utb {
         
         template < typename T >
         inline T	 lenght(const  vector2<T>& v)									
-            { return (T)(v.x * v.x + v.y * v.y ); }
+            { return internal::vec_sqrt(T(v.x * v.x + v.y * v.y )); }
 
 	    template < typename T >
         inline T	 lenghtSq(const vector2<T>& v)									
-            { return (T)sqrt(v.x * v.x + v.y * v.y ); }
+            { return (T)(v.x * v.x + v.y * v.y ); }
 
 	    template < typename T >
         inline vector2<T> normalize(const vector2<T>& v)									
-            { return v / (T)sqrt(v.x * v.x + v.y * v.y ); }
+            { return v / internal::vec_sqrt(T(v.x * v.x + v.y * v.y )); }
 
 	    template < typename T >
         inline vector2<T> normalizeEx(const vector2<T>& v)								
-            { return v / (T)sqrt((v.x * v.x + v.y * v.y ) + 0.0001f); }
+            { return v / internal::vec_sqrt(T((v.x * v.x + v.y * v.y ) + 0.0001f)); }
 
         template < typename T >
 	    inline T dot(const vector2<T>& v1, const vector2<T>& v2)					
@@ -153,7 +160,7 @@ namespace utb {
         template < typename T >
 	    inline T angle(const vector2<T>& v1, const vector2<T>& v2)  { 
             return (T)acos((v1.x * v2.x + v1.y * v2.y ) /
-	               (T)sqrt((v1.x * v1.x + v1.y * v1.y ) * (v2.x * v2.x + v2.y * v2.y))); 
+	               internal::vec_sqrt(T((v1.x * v1.x + v1.y * v1.y ) * (v2.x * v2.x + v2.y * v2.y)))); 
         }
 
         template < typename T >
@@ -114,13 +114,13 @@ namespace utb {
             { return (v.x * v.x + v.y * v.y + v.z * v.z); }
         template < typename T >
 	    inline T lenght(const vector3<T>& v)									
-            { return sqrtf(v.x * v.x + v.y * v.y + v.z * v.z); }
+            { return internal::vec_sqrt(T(v.x * v.x + v.y * v.y + v.z * v.z)); }
         template < typename T >
 	    inline vector3<T> normalize(const vector3<T>& v)									
-            { return v / (T)sqrt(double(v.x * v.x + v.y * v.y + v.z * v.z)); }
+            { return v / internal::vec_sqrt(T(v.x * v.x + v.y * v.y + v.z * v.z)); }
         template < typename T >
 	    inline vector3<T> normalizex(const vector3<T>& v)								
-            { return v / (T)(sqrt(double(v.x * v.x + v.y * v.y + v.z * v.z)) + 0.0001); }
+            { return v / T(internal::vec_sqrt(T(v.x * v.x + v.y * v.y + v.z * v.z)) + 0.0001); }
         template < typename T >
 	    inline vector3<T> cross(const vector3<T>& v1, vector3<T>& v2)						
             { return vector3<T>(v1.y * v2.z - v1.z * v2.y, v1.z * v2.x - v1.x * v2.z, v1.x * v2.y - v1.y * v2.x); }
@@ -129,8 +129,8 @@ namespace utb {
             { return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;}
 	    template < typename T >
         inline T angle(const vector3<T>& v1, const vector3<T>& v2)				
-            { return (T)(acos(double((v1.x * v2.x + v1.y * v2.y + v1.z * v2.z)) /
-                        sqrt((double)((v1.x * v1.x + v1.y * v1.y + v1.z * v1.z)) * T((v2.x * v2.x + v2.y * v2.y + v2.z * v2.z))))); }
+            { return (T)acos(double(v1.x * v2.x + v1.y * v2.y + v1.z * v2.z) /
+                        ::sqrt(double(v1.x * v1.x + v1.y * v1.y + v1.z * v1.z) * double(v2.x * v2.x + v2.y * v2.y + v2.z * v2.z))); }
 	    template < typename T >
         inline vector3<T> interpolate_coords(const vector3<T>& v1, const vector3<T>& v2, const float p)								
             { return v1 + p * (v2 - v1); }
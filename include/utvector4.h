@@ -119,13 +119,13 @@ namespace utb {
 
         template < typename T >
 	    inline T lenght(const vector4<T>& v)									
-            { return sqrtf(v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w); }
+            { return internal::vec_sqrt(T(v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w)); }
         template < typename T >
 	    inline vector4<T> normalize(const vector4<T>& v)									
-            { return v / (T)sqrt(double(v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w)); }
+            { return v / internal::vec_sqrt(T(v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w)); }
         template < typename T >
 	    inline vector4<T> normalizex(const vector4<T>& v)								
-            { return v / (T)(sqrt(double(v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w)) + 0.0001); }
+            { return v / T(internal::vec_sqrt(T(v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w)) + 0.0001); }
 
         template < typename T >
 	    inline vector4<T> cross(const vector4<T>& v1, vector4<T>& v2)						
@@ -135,8 +135,8 @@ namespace utb {
             { return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z + v1.w * v2.w; }
 	    template < typename T >
         inline T angle(const vector4<T>& v1, const vector4<T>& v2)				
-            { return (T)(acos(double((v1.x * v2.x + v1.y * v2.y + v1.z * v2.z + v1.w * v2.w)) /
-                        sqrt((double)((v1.x * v1.x + v1.y * v1.y + v1.z * v1.z + v1.w * v1.w)) * T((v2.x * v2.x + v2.y * v2.y + v2.z * v2.z + v2.w * v2.w))))); }
+            { return (T)acos(double(v1.x * v2.x + v1.y * v2.y + v1.z * v2.z + v1.w * v2.w) /
+                        ::sqrt(double(v1.x * v1.x + v1.y * v1.y + v1.z * v1.z + v1.w * v1.w) * double(v2.x * v2.x + v2.y * v2.y + v2.z * v2.z + v2.w * v2.w))); }
 	    template < typename T >
         inline vector4<T> interpolate_coords(const vector4<T>& v1, const vector4<T>& v2, const float p)								
             { return v1 + p * (v2 - v1); }
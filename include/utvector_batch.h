@@ -0,0 +1,608 @@
+/*
+ * Copyright (c) 2026 Amber-Sophia Schröck. Licensed under the EUPL, Version 1.2 or as soon they will be approved by the
+ * European Commission - subsequent versions of the EUPL (the "Licence"); You may not use this work except in compliance
+ * with the Licence. You may obtain a copy of the Licence at: http://joinup.ec.europa.eu/software/page/eupl Unless
+ * required by applicable law or agreed to in writing, software distributed under the Licence is distributed on an
+ * "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the Licence for the
+ * specific language governing permissions and limitations under the Licence.
+ */
+#ifndef __UT_VECTOR_BATCH_H__
+#define __UT_VECTOR_BATCH_H__
+
+#include "utconfig.h"
+#include "utalgorithm.h"
+#include "utsimd.h"
+#include "utfastmath.h"
+#include "utvector2.h"
+#include "utvector3.h"
+#include "utvector4.h"
+
+#include <math.h>
+#include <string.h>
+
+/**
+ * Batch operations over arrays of vector2/vector3/vector4: dot_n, cross_n, length_n, normalize_n
+ * and rotate_n. Every operation takes either an AoS array (vector3<T>* and a count) or SoA views
+ * (one array per component, basic_soa_view). All kernels are written once against a lane type:
+ *
+ *  - float with SSE2:  4 lanes, AoS input is transposed in registers
+ *  - float with NEON:  4 lanes, AoS input is de-interleaved by vld2/vld3/vld4
+ *  - everything else:  1 lane, the plain scalar loop; also the tail of the SIMD paths
+ *
+ * length_n and normalize_n take an accuracy policy for the inverse square root. Zero vectors have
+ * length 0 and stay zero when normalized.
+ * @code
+ * static utb::math::vector3<float> gyro[256];
+ * utb::math::vector4<float> attitude(0.0f, 0.0f, 0.7071f, 0.7071f);   // x, y, z, w
+ *
+ * utb::math::rotate_n(attitude, gyro, gyro, 256);
+ * utb::math::normalize_n<utb::math::rsqrt_fast>(gyro, gyro, 256);
+ * @endcode
+ */
+
+namespace utb {
+    namespace math {
+
+        /**
+         * @brief Accuracy policies of rsqrt(), length_n() and normalize_n() for float.
+         *
+         * max_error is the bound of the relative error on every float path (scalar, SSE, NEON).
+         * Other value types always compute exactly.
+         */
+        struct rsqrt_exact      { static constexpr float max_error = 3e-7f; };
+        /// Hardware estimate or bit trick, refined by Newton steps.
+        struct rsqrt_precise    { static constexpr float max_error = 1e-5f; };
+        /// The bare hardware estimate, or the bit trick with one Newton step.
+        struct rsqrt_fast       { static constexpr float max_error = 2e-3f; };
+
+        namespace internal {
+            inline float scalar_rsqrt(float x, rsqrt_fast) noexcept    { return rsqrt_newton(x, rsqrt_guess(x)); }
+            inline float scalar_rsqrt(float x, rsqrt_precise) noexcept {
+                return rsqrt_newton(x, rsqrt_newton(x, rsqrt_guess(x)));
+            }
+            template <typename T, class TPolicy>
+            inline T scalar_rsqrt(T x, TPolicy) noexcept                { return T(1) / vec_sqrt(x); }
+
+            /**
+             * @brief One lane of T, the fallback of every kernel and the tail of the SIMD paths.
+             */
+            template <typename T>
+            struct scalar_lanes {
+                using type = T;
+                static constexpr utb::size_t width = 1;
+
+                static type splat(T v) noexcept                         { return v; }
+                static type load(const T* p) noexcept                   { return *p; }
+                static void store(T* p, type v) noexcept                { *p = v; }
+
+                static type add(type a, type b) noexcept                { return a + b; }
+                static type sub(type a, type b) noexcept                { return a - b; }
+                static type mul(type a, type b) noexcept                { return a * b; }
+                static type sqrt(type v) noexcept                       { return vec_sqrt(v); }
+                /// v where test > 0, 0 elsewhere.
+                static type keep_positive(type v, type test) noexcept   { return test > T(0) ? v : T(0); }
+
+                template <class TPolicy>
+                static type rsqrt(type v, TPolicy p) noexcept           { return scalar_rsqrt(v, p); }
+
+                template <utb::size_t TDim>
+                static void load_aos(const T* p, type (&v)[TDim]) noexcept {
+                    for (utb::size_t d = 0; d < TDim; ++d) v[d] = p[d];
+                }
+                template <utb::size_t TDim>
+                static void store_aos(T* p, const type (&v)[TDim]) noexcept {
+                    for (utb::size_t d = 0; d < TDim; ++d) p[d] = v[d];
+                }
+            };
+
+        #if UTB_SIMD_SSE2
+            /**
+             * @brief Four float lanes in an SSE register.
+             */
+            struct sse_lanes {
+                using type = __m128;
+                static constexpr utb::size_t width = 4;
+
+                static type splat(float v) noexcept                     { return _mm_set1_ps(v); }
+                static type load(const float* p) noexcept               { return _mm_loadu_ps(p); }
+                static void store(float* p, type v) noexcept            { _mm_storeu_ps(p, v); }
+
+                static type add(type a, type b) noexcept                { return _mm_add_ps(a, b); }
+                static type sub(type a, type b) noexcept                { return _mm_sub_ps(a, b); }
+                static type mul(type a, type b) noexcept                { return _mm_mul_ps(a, b); }
+                static type sqrt(type v) noexcept                       { return _mm_sqrt_ps(v); }
+                static type keep_positive(type v, type test) noexcept {
+                    return _mm_and_ps(v, _mm_cmpgt_ps(test, _mm_setzero_ps()));
+                }
+
+                static type rsqrt(type v, rsqrt_exact) noexcept         { return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(v)); }
+                static type rsqrt(type v, rsqrt_precise) noexcept {
+                    const type _y = _mm_rsqrt_ps(v);        // 12 bits
+                    const type _yyx = _mm_mul_ps(_mm_mul_ps(_y, _y), v);
+                    return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), _y), _mm_sub_ps(_mm_set1_ps(3.0f), _yyx));
+                }
+                static type rsqrt(type v, rsqrt_fast) noexcept          { return _mm_rsqrt_ps(v); }
+
+                static void load_aos(const float* p, type (&v)[1]) noexcept { v[0] = load(p); }
+                static void store_aos(float* p, const type (&v)[1]) noexcept { store(p, v[0]); }
+
+                // x0 y0 x1 y1 | x2 y2 x3 y3
+                static void load_aos(const float* p, type (&v)[2]) noexcept {
+                    const type _a = load(p), _b = load(p + 4);
+                    v[0] = _mm_shuffle_ps(_a, _b, _MM_SHUFFLE(2, 0, 2, 0));
+                    v[1] = _mm_shuffle_ps(_a, _b, _MM_SHUFFLE(3, 1, 3, 1));
+                }
+                static void store_aos(float* p, const type (&v)[2]) noexcept {
+                    store(p, _mm_unpacklo_ps(v[0], v[1]));
+                    store(p + 4, _mm_unpackhi_ps(v[0], v[1]));
+                }
+
+                // x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+                static void load_aos(const float* p, type (&v)[3]) noexcept {
+                    const type _a = load(p), _b = load(p + 4), _c = load(p + 8);
+                    v[0] = _mm_shuffle_ps(_mm_shuffle_ps(_a, _b, _MM_SHUFFLE(2, 2, 3, 0)),
+                                          _mm_shuffle_ps(_b, _c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 1, 0));
+                    v[1] = _mm_shuffle_ps(_mm_shuffle_ps(_a, _b, _MM_SHUFFLE(0, 0, 1, 1)),
+                                          _mm_shuffle_ps(_b, _c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+                    v[2] = _mm_shuffle_ps(_mm_shuffle_ps(_a, _b, _MM_SHUFFLE(1, 1, 2, 2)),
+                                          _mm_shuffle_ps(_c, _c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+                }
+                static void store_aos(float* p, const type (&v)[3]) noexcept {
+                    store(p, _mm_shuffle_ps(_mm_shuffle_ps(v[0], v[1], _MM_SHUFFLE(0, 0, 0, 0)),
+                                            _mm_shuffle_ps(v[2], v[0], _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+                    store(p + 4, _mm_shuffle_ps(_mm_shuffle_ps(v[1], v[2], _MM_SHUFFLE(1, 1, 1, 1)),
+                                                _mm_shuffle_ps(v[0], v[1], _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+                    store(p + 8, _mm_shuffle_ps(_mm_shuffle_ps(v[2], v[0], _MM_SHUFFLE(3, 3, 2, 2)),
+                                                _mm_shuffle_ps(v[1], v[2], _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+                }
+
+                static void load_aos(const float* p, type (&v)[4]) noexcept {
+                    v[0] = load(p); v[1] = load(p + 4); v[2] = load(p + 8); v[3] = load(p + 12);
+                    _MM_TRANSPOSE4_PS(v[0], v[1], v[2], v[3]);
+                }
+                static void store_aos(float* p, const type (&v)[4]) noexcept {
+                    type _r0 = v[0], _r1 = v[1], _r2 = v[2], _r3 = v[3];
+                    _MM_TRANSPOSE4_PS(_r0, _r1, _r2, _r3);
+                    store(p, _r0); store(p + 4, _r1); store(p + 8, _r2); store(p + 12, _r3);
+                }
+            };
+        #elif UTB_SIMD_NEON
+            /**
+             * @brief Four float lanes in a NEON register.
+             */
+            struct neon_lanes {
+                using type = float32x4_t;
+                static constexpr utb::size_t width = 4;
+
+                static type splat(float v) noexcept                     { return vdupq_n_f32(v); }
+                static type load(const float* p) noexcept               { return vld1q_f32(p); }
+                static void store(float* p, type v) noexcept            { vst1q_f32(p, v); }
+
+                static type add(type a, type b) noexcept                { return vaddq_f32(a, b); }
+                static type sub(type a, type b) noexcept                { return vsubq_f32(a, b); }
+                static type mul(type a, type b) noexcept                { return vmulq_f32(a, b); }
+                static type keep_positive(type v, type test) noexcept {
+                    return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(v), vcgtq_f32(test, vdupq_n_f32(0.0f))));
+                }
+
+                /// One Newton step, vrsqrts computes (3 - a * b) / 2.
+                static type newton(type v, type y) noexcept             { return vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(v, y), y)); }
+
+            #if defined(__aarch64__)
+                static type sqrt(type v) noexcept                       { return vsqrtq_f32(v); }
+                static type rsqrt(type v, rsqrt_exact) noexcept         { return vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(v)); }
+            #else
+                // ARMv7 NEON has no vector sqrt or division
+                static type sqrt(type v) noexcept {
+                    float _l[4];
+                    vst1q_f32(_l, v);
+                    for (utb::size_t i = 0; i < 4; ++i) _l[i] = ::sqrtf(_l[i]);
+                    return vld1q_f32(_l);
+                }
+                static type rsqrt(type v, rsqrt_exact) noexcept {
+                    float _l[4];
+                    vst1q_f32(_l, v);
+                    for (utb::size_t i = 0; i < 4; ++i) _l[i] = 1.0f / ::sqrtf(_l[i]);
+                    return vld1q_f32(_l);
+                }
+            #endif
+                static type rsqrt(type v, rsqrt_precise) noexcept       { return newton(v, newton(v, vrsqrteq_f32(v))); }
+                static type rsqrt(type v, rsqrt_fast) noexcept          { return newton(v, vrsqrteq_f32(v)); }
+
+                static void load_aos(const float* p, type (&v)[1]) noexcept { v[0] = vld1q_f32(p); }
+                static void store_aos(float* p, const type (&v)[1]) noexcept { vst1q_f32(p, v[0]); }
+
+                static void load_aos(const float* p, type (&v)[2]) noexcept {
+                    const float32x4x2_t _r = vld2q_f32(p);
+                    v[0] = _r.val[0]; v[1] = _r.val[1];
+                }
+                static void store_aos(float* p, const type (&v)[2]) noexcept {
+                    float32x4x2_t _r;
+                    _r.val[0] = v[0]; _r.val[1] = v[1];
+                    vst2q_f32(p, _r);
+                }
+                static void load_aos(const float* p, type (&v)[3]) noexcept {
+                    const float32x4x3_t _r = vld3q_f32(p);
+                    v[0] = _r.val[0]; v[1] = _r.val[1]; v[2] = _r.val[2];
+                }
+                static void store_aos(float* p, const type (&v)[3]) noexcept {
+                    float32x4x3_t _r;
+                    _r.val[0] = v[0]; _r.val[1] = v[1]; _r.val[2] = v[2];
+                    vst3q_f32(p, _r);
+                }
+                static void load_aos(const float* p, type (&v)[4]) noexcept {
+                    const float32x4x4_t _r = vld4q_f32(p);
+                    v[0] = _r.val[0]; v[1] = _r.val[1]; v[2] = _r.val[2]; v[3] = _r.val[3];
+                }
+                static void store_aos(float* p, const type (&v)[4]) noexcept {
+                    float32x4x4_t _r;
+                    _r.val[0] = v[0]; _r.val[1] = v[1]; _r.val[2] = v[2]; _r.val[3] = v[3];
+                    vst4q_f32(p, _r);
+                }
+            };
+        #endif
+
+            /// The widest lanes for T.
+            template <typename T>
+            struct batch_lanes { using type = scalar_lanes<T>; };
+        #if UTB_SIMD_SSE2
+            template <>
+            struct batch_lanes<float> { using type = sse_lanes; };
+        #elif UTB_SIMD_NEON
+            template <>
+            struct batch_lanes<float> { using type = neon_lanes; };
+        #endif
+
+            /// TDim interleaved components per element, as in vector3<T>[].
+            template <utb::size_t TDim, typename T>
+            struct aos_stream {
+                static constexpr utb::size_t dim = TDim;
+                T* p;
+
+                template <class TL>
+                void load(utb::size_t i, typename TL::type (&v)[TDim]) const    { TL::load_aos(p + i * TDim, v); }
+                template <class TL>
+                void store(utb::size_t i, const typename TL::type (&v)[TDim]) const { TL::store_aos(p + i * TDim, v); }
+            };
+
+            /// One array per component.
+            template <utb::size_t TDim, typename T>
+            struct soa_stream {
+                static constexpr utb::size_t dim = TDim;
+                T* c[TDim];
+
+                template <class TL>
+                void load(utb::size_t i, typename TL::type (&v)[TDim]) const {
+                    for (utb::size_t d = 0; d < TDim; ++d) v[d] = TL::load(c[d] + i);
+                }
+                template <class TL>
+                void store(utb::size_t i, const typename TL::type (&v)[TDim]) const {
+                    for (utb::size_t d = 0; d < TDim; ++d) TL::store(c[d] + i, v[d]);
+                }
+            };
+
+            template <class TL, class TKernel, class TIn, class TOut>
+            inline void batch_step(const TKernel& k, const TIn& in, const TOut& out, utb::size_t i) {
+                typename TL::type _a[TIn::dim], _r[TOut::dim];
+                in.template load<TL>(i, _a);
+                k.template apply<TL>(_a, _r);
+                out.template store<TL>(i, _r);
+            }
+
+            template <class TL, class TKernel, class TIn, class TOut>
+            inline void batch_step(const TKernel& k, const TIn& a, const TIn& b, const TOut& out, utb::size_t i) {
+                typename TL::type _a[TIn::dim], _b[TIn::dim], _r[TOut::dim];
+                a.template load<TL>(i, _a);
+                b.template load<TL>(i, _b);
+                k.template apply<TL>(_a, _b, _r);
+                out.template store<TL>(i, _r);
+            }
+
+            /// Run k over n elements, batch_lanes<T> wide, the rest one by one.
+            template <typename T, class TKernel, class TIn, class TOut>
+            inline void batch_run(const TKernel& k, const TIn& in, const TOut& out, utb::size_t n) {
+                using lanes = typename batch_lanes<T>::type;
+                const utb::size_t _body = n - n % lanes::width;
+                for (utb::size_t i = 0; i < _body; i += lanes::width) batch_step<lanes>(k, in, out, i);
+                for (utb::size_t i = _body; i < n; ++i) batch_step<scalar_lanes<T> >(k, in, out, i);
+            }
+
+            template <typename T, class TKernel, class TIn, class TOut>
+            inline void batch_run(const TKernel& k, const TIn& a, const TIn& b, const TOut& out, utb::size_t n) {
+                using lanes = typename batch_lanes<T>::type;
+                const utb::size_t _body = n - n % lanes::width;
+                for (utb::size_t i = 0; i < _body; i += lanes::width) batch_step<lanes>(k, a, b, out, i);
+                for (utb::size_t i = _body; i < n; ++i) batch_step<scalar_lanes<T> >(k, a, b, out, i);
+            }
+
+            template <class TL, utb::size_t TDim>
+            inline typename TL::type lanes_dot(const typename TL::type (&a)[TDim], const typename TL::type (&b)[TDim]) {
+                typename TL::type _s = TL::mul(a[0], b[0]);
+                for (utb::size_t d = 1; d < TDim; ++d) _s = TL::add(_s, TL::mul(a[d], b[d]));
+                return _s;
+            }
+
+            /// sqrt(sq) as sq / sqrt(sq), exact: the lane sqrt.
+            template <class TL, class TPolicy>
+            struct lanes_length {
+                static typename TL::type apply(typename TL::type sq) {
+                    return TL::keep_positive(TL::mul(sq, TL::rsqrt(sq, TPolicy())), sq);
+                }
+            };
+            template <class TL>
+            struct lanes_length<TL, rsqrt_exact> {
+                static typename TL::type apply(typename TL::type sq) { return TL::sqrt(sq); }
+            };
+
+            template <utb::size_t TDim>
+            struct dot_kernel {
+                template <class TL>
+                void apply(const typename TL::type (&a)[TDim], const typename TL::type (&b)[TDim],
+                           typename TL::type (&r)[1]) const {
+                    r[0] = lanes_dot<TL>(a, b);
+                }
+            };
+
+            struct cross_kernel {
+                template <class TL>
+                void apply(const typename TL::type (&a)[3], const typename TL::type (&b)[3], typename TL::type (&r)[3]) const {
+                    r[0] = TL::sub(TL::mul(a[1], b[2]), TL::mul(a[2], b[1]));
+                    r[1] = TL::sub(TL::mul(a[2], b[0]), TL::mul(a[0], b[2]));
+                    r[2] = TL::sub(TL::mul(a[0], b[1]), TL::mul(a[1], b[0]));
+                }
+            };
+
+            template <utb::size_t TDim, class TPolicy>
+            struct length_kernel {
+                template <class TL>
+                void apply(const typename TL::type (&a)[TDim], typename TL::type (&r)[1]) const {
+                    r[0] = lanes_length<TL, TPolicy>::apply(lanes_dot<TL>(a, a));
+                }
+            };
+
+            template <utb::size_t TDim, class TPolicy>
+            struct normalize_kernel {
+                template <class TL>
+                void apply(const typename TL::type (&a)[TDim], typename TL::type (&r)[TDim]) const {
+                    const typename TL::type _sq = lanes_dot<TL>(a, a);
+                    const typename TL::type _inv = TL::keep_positive(TL::rsqrt(_sq, TPolicy()), _sq);
+                    for (utb::size_t d = 0; d < TDim; ++d) r[d] = TL::mul(a[d], _inv);
+                }
+            };
+
+            /// v' = v + w t + u x t with t = 2 (u x v), for the unit quaternion (u, w).
+            template <typename T>
+            struct rotate_kernel {
+                T q[4];
+
+                template <class TL>
+                void apply(const typename TL::type (&v)[3], typename TL::type (&r)[3]) const {
+                    const typename TL::type _u[3] = { TL::splat(q[0]), TL::splat(q[1]), TL::splat(q[2]) };
+                    const typename TL::type _w = TL::splat(q[3]), _two = TL::splat(T(2));
+
+                    typename TL::type _t[3];
+                    cross_kernel().apply<TL>(_u, v, _t);
+                    for (utb::size_t d = 0; d < 3; ++d) _t[d] = TL::mul(_two, _t[d]);
+
+                    typename TL::type _ut[3];
+                    cross_kernel().apply<TL>(_u, _t, _ut);
+                    for (utb::size_t d = 0; d < 3; ++d) r[d] = TL::add(TL::add(v[d], TL::mul(_w, _t[d])), _ut[d]);
+                }
+            };
+
+            template <typename T>
+            inline aos_stream<2, const T> aos(const vector2<T>* v) {
+                static_assert(sizeof(vector2<T>) == 2 * sizeof(T), "vector2 must be packed.");
+                return aos_stream<2, const T>{ reinterpret_cast<const T*>(v) };
+            }
+            template <typename T>
+            inline aos_stream<3, const T> aos(const vector3<T>* v) {
+                static_assert(sizeof(vector3<T>) == 3 * sizeof(T), "vector3 must be packed.");
+                return aos_stream<3, const T>{ reinterpret_cast<const T*>(v) };
+            }
+            template <typename T>
+            inline aos_stream<4, const T> aos(const vector4<T>* v) {
+                static_assert(sizeof(vector4<T>) == 4 * sizeof(T), "vector4 must be packed.");
+                return aos_stream<4, const T>{ reinterpret_cast<const T*>(v) };
+            }
+            template <typename T>
+            inline aos_stream<2, T> aos(vector2<T>* v)          { return aos_stream<2, T>{ reinterpret_cast<T*>(v) }; }
+            template <typename T>
+            inline aos_stream<3, T> aos(vector3<T>* v)          { return aos_stream<3, T>{ reinterpret_cast<T*>(v) }; }
+            template <typename T>
+            inline aos_stream<4, T> aos(vector4<T>* v)          { return aos_stream<4, T>{ reinterpret_cast<T*>(v) }; }
+
+            template <typename T>
+            inline soa_stream<1, T> flat(T* p)                  { return soa_stream<1, T>{ { p } }; }
+        }
+
+        /**
+         * @brief 1 / sqrt(x) with the accuracy of TPolicy.
+         */
+        template <class TPolicy = rsqrt_exact, typename T>
+        inline T rsqrt(T x) noexcept                            { return internal::scalar_rsqrt(x, TPolicy()); }
+
+        /**
+         * @brief A structure-of-arrays view: TDim component arrays of size elements each.
+         */
+        template <typename T, utb::size_t TDim>
+        struct basic_soa_view {
+            T* c[TDim];
+            utb::size_t size;
+        };
+
+        template <typename T> using soa_view2 = basic_soa_view<T, 2>;
+        template <typename T> using soa_view3 = basic_soa_view<T, 3>;
+        template <typename T> using soa_view4 = basic_soa_view<T, 4>;
+
+        /**
+         * @brief Static storage for up to TCapacity vectors as TDim component arrays.
+         *
+         * assign() splits an array of vector2/vector3/vector4 into the components, copy_to() joins
+         * them again. Keep data in SoA form over several batch operations to skip the transposes.
+         */
+        template <typename T, utb::size_t TDim, utb::size_t TCapacity>
+        class basic_soa_array {
+        public:
+            using value_type = T;
+            using size_type = utb::size_t;
+            using view_type = basic_soa_view<T, TDim>;
+            using const_view_type = basic_soa_view<const T, TDim>;
+
+            basic_soa_array() noexcept : m_sSize(0) { }
+
+            /**
+             * @brief Copy the components of n vectors with TDim components of T.
+             * @return The number of vectors copied, at most TCapacity.
+             */
+            template <class TVec>
+            size_type assign(const TVec* v, size_type n) noexcept {
+                static_assert(sizeof(TVec) == TDim * sizeof(T), "The vector type does not match the columns.");
+                m_sSize = n < TCapacity ? n : TCapacity;
+                for (size_type i = 0; i < m_sSize; ++i)
+                    for (size_type d = 0; d < TDim; ++d) m_ayColumns[d][i] = v[i].c[d];
+                return m_sSize;
+            }
+
+            /// Write the size() vectors back to v.
+            template <class TVec>
+            void copy_to(TVec* v) const noexcept {
+                static_assert(sizeof(TVec) == TDim * sizeof(T), "The vector type does not match the columns.");
+                for (size_type i = 0; i < m_sSize; ++i)
+                    for (size_type d = 0; d < TDim; ++d) v[i].c[d] = m_ayColumns[d][i];
+            }
+
+            view_type view() noexcept {
+                view_type _v;
+                for (size_type d = 0; d < TDim; ++d) _v.c[d] = m_ayColumns[d];
+                _v.size = m_sSize;
+                return _v;
+            }
+            const_view_type view() const noexcept {
+                const_view_type _v;
+                for (size_type d = 0; d < TDim; ++d) _v.c[d] = m_ayColumns[d];
+                _v.size = m_sSize;
+                return _v;
+            }
+
+            T* column(size_type d) noexcept                     { return m_ayColumns[d]; }
+            const T* column(size_type d) const noexcept         { return m_ayColumns[d]; }
+
+            void resize(size_type n) noexcept                   { m_sSize = n < TCapacity ? n : TCapacity; }
+            void clear() noexcept                               { m_sSize = 0; }
+            size_type size() const noexcept                     { return m_sSize; }
+            constexpr size_type capacity() const noexcept       { return TCapacity; }
+
+        private:
+            alignas(16) T m_ayColumns[TDim][TCapacity];
+            size_type m_sSize;
+        };
+
+        template <typename T, utb::size_t TCapacity> using soa_array2 = basic_soa_array<T, 2, TCapacity>;
+        template <typename T, utb::size_t TCapacity> using soa_array3 = basic_soa_array<T, 3, TCapacity>;
+        template <typename T, utb::size_t TCapacity> using soa_array4 = basic_soa_array<T, 4, TCapacity>;
+
+        namespace internal {
+            template <typename T, utb::size_t TDim>
+            inline soa_stream<TDim, T> soa(const basic_soa_view<T, TDim>& v) {
+                soa_stream<TDim, T> _s;
+                for (utb::size_t d = 0; d < TDim; ++d) _s.c[d] = v.c[d];
+                return _s;
+            }
+        }
+
+        /**
+         * @brief out[i] = dot(a[i], b[i]) for n vectors.
+         */
+        template <typename T>
+        inline void dot_n(const vector2<T>* a, const vector2<T>* b, T* out, utb::size_t n) {
+            internal::batch_run<T>(internal::dot_kernel<2>(), internal::aos(a), internal::aos(b), internal::flat(out), n);
+        }
+        template <typename T>
+        inline void dot_n(const vector3<T>* a, const vector3<T>* b, T* out, utb::size_t n) {
+            internal::batch_run<T>(internal::dot_kernel<3>(), internal::aos(a), internal::aos(b), internal::flat(out), n);
+        }
+        template <typename T>
+        inline void dot_n(const vector4<T>* a, const vector4<T>* b, T* out, utb::size_t n) {
+            internal::batch_run<T>(internal::dot_kernel<4>(), internal::aos(a), internal::aos(b), internal::flat(out), n);
+        }
+        /// SoA form, a.size elements.
+        template <typename TIn, typename T, utb::size_t TDim>
+        inline void dot_n(const basic_soa_view<TIn, TDim>& a, const basic_soa_view<TIn, TDim>& b, T* out) {
+            assert(b.size >= a.size);
+            internal::batch_run<T>(internal::dot_kernel<TDim>(), internal::soa(a), internal::soa(b), internal::flat(out), a.size);
+        }
+
+        /**
+         * @brief out[i] = cross(a[i], b[i]) for n vectors, out may be a or b.
+         */
+        template <typename T>
+        inline void cross_n(const vector3<T>* a, const vector3<T>* b, vector3<T>* out, utb::size_t n) {
+            internal::batch_run<T>(internal::cross_kernel(), internal::aos(a), internal::aos(b), internal::aos(out), n);
+        }
+        template <typename TIn, typename T>
+        inline void cross_n(const basic_soa_view<TIn, 3>& a, const basic_soa_view<TIn, 3>& b, const basic_soa_view<T, 3>& out) {
+            assert(b.size >= a.size && out.size >= a.size);
+            internal::batch_run<T>(internal::cross_kernel(), internal::soa(a), internal::soa(b), internal::soa(out), a.size);
+        }
+
+        /**
+         * @brief out[i] = the length of v[i] for n vectors, with the accuracy of TPolicy.
+         */
+        template <class TPolicy = rsqrt_exact, typename T>
+        inline void length_n(const vector2<T>* v, T* out, utb::size_t n) {
+            internal::batch_run<T>(internal::length_kernel<2, TPolicy>(), internal::aos(v), internal::flat(out), n);
+        }
+        template <class TPolicy = rsqrt_exact, typename T>
+        inline void length_n(const vector3<T>* v, T* out, utb::size_t n) {
+            internal::batch_run<T>(internal::length_kernel<3, TPolicy>(), internal::aos(v), internal::flat(out), n);
+        }
+        template <class TPolicy = rsqrt_exact, typename T>
+        inline void length_n(const vector4<T>* v, T* out, utb::size_t n) {
+            internal::batch_run<T>(internal::length_kernel<4, TPolicy>(), internal::aos(v), internal::flat(out), n);
+        }
+        template <class TPolicy = rsqrt_exact, typename TIn, typename T, utb::size_t TDim>
+        inline void length_n(const basic_soa_view<TIn, TDim>& v, T* out) {
+            internal::batch_run<T>(internal::length_kernel<TDim, TPolicy>(), internal::soa(v), internal::flat(out), v.size);
+        }
+
+        /**
+         * @brief out[i] = v[i] / length(v[i]) for n vectors, out may be v; zero vectors stay zero.
+         */
+        template <class TPolicy = rsqrt_exact, typename T>
+        inline void normalize_n(const vector2<T>* v, vector2<T>* out, utb::size_t n) {
+            internal::batch_run<T>(internal::normalize_kernel<2, TPolicy>(), internal::aos(v), internal::aos(out), n);
+        }
+        template <class TPolicy = rsqrt_exact, typename T>
+        inline void normalize_n(const vector3<T>* v, vector3<T>* out, utb::size_t n) {
+            internal::batch_run<T>(internal::normalize_kernel<3, TPolicy>(), internal::aos(v), internal::aos(out), n);
+        }
+        template <class TPolicy = rsqrt_exact, typename T>
+        inline void normalize_n(const vector4<T>* v, vector4<T>* out, utb::size_t n) {
+            internal::batch_run<T>(internal::normalize_kernel<4, TPolicy>(), internal::aos(v), internal::aos(out), n);
+        }
+        template <class TPolicy = rsqrt_exact, typename TIn, typename T, utb::size_t TDim>
+        inline void normalize_n(const basic_soa_view<TIn, TDim>& v, const basic_soa_view<T, TDim>& out) {
+            assert(out.size >= v.size);
+            internal::batch_run<T>(internal::normalize_kernel<TDim, TPolicy>(), internal::soa(v), internal::soa(out), v.size);
+        }
+
+        /**
+         * @brief Rotate n vectors by the unit quaternion q, given as (x, y, z, w) with the real part
+         * in w; out may be v.
+         */
+        template <typename T>
+        inline void rotate_n(const vector4<T>& q, const vector3<T>* v, vector3<T>* out, utb::size_t n) {
+            const internal::rotate_kernel<T> _k = { { q.x, q.y, q.z, q.w } };
+            internal::batch_run<T>(_k, internal::aos(v), internal::aos(out), n);
+        }
+        template <typename TIn, typename T>
+        inline void rotate_n(const vector4<T>& q, const basic_soa_view<TIn, 3>& v, const basic_soa_view<T, 3>& out) {
+            assert(out.size >= v.size);
+            const internal::rotate_kernel<T> _k = { { q.x, q.y, q.z, q.w } };
+            internal::batch_run<T>(_k, internal::soa(v), internal::soa(out), v.size);
+        }
+    }
+}
+
+#endif // __UT_VECTOR_BATCH_H__
@@ -0,0 +1,83 @@
+#include <unity.h>
+#include "utarena.h"
+#include "utcolor_buffer.h"
+
+void test_arena_alignment_and_overflow() {
+    static utb::static_arena<256, 16> _arena;
+    _arena.reset();
+
+    char* _c = _arena.allocate_array<char>(3);
+    double* _d = _arena.allocate_array<double>(4);
+    void* _v = _arena.allocate(10, 16);
+
+    TEST_ASSERT_NOT_NULL(_c);
+    TEST_ASSERT_TRUE(utb::is_aligned(reinterpret_cast<uintptr_t>(_d), utb::alignment_of<double>::res));
+    TEST_ASSERT_TRUE(utb::is_aligned(reinterpret_cast<uintptr_t>(_v), 16));
+    TEST_ASSERT_TRUE(_arena.owns(_d));
+    TEST_ASSERT_FALSE(_arena.overflowed());
+
+    TEST_ASSERT_NULL(_arena.allocate(_arena.available() + 1, 1));
+    TEST_ASSERT_NULL(_arena.allocate_array<uint32_t>(utb::size_t(-1) / 2));
+    TEST_ASSERT_EQUAL(2, _arena.overflow_count());
+
+    // exactly the rest still fits
+    TEST_ASSERT_NOT_NULL(_arena.allocate(_arena.available(), 1));
+    TEST_ASSERT_EQUAL(0, _arena.available());
+    TEST_ASSERT_EQUAL(256, _arena.high_watermark());
+}
+
+void test_arena_scope_rewinds() {
+    utb::static_arena<1024> _arena;
+
+    _arena.allocate(100);
+    const utb::size_t _before = _arena.used();
+    {
+        utb::arena_scope _frame(_arena);
+        _arena.allocate(500);
+        {
+            utb::arena_scope _inner(_arena);
+            _arena.allocate(300);
+            TEST_ASSERT_TRUE(_arena.used() > 900);
+        }
+        TEST_ASSERT_TRUE(_arena.used() < 700);
+    }
+    TEST_ASSERT_EQUAL(_before, _arena.used());
+    TEST_ASSERT_TRUE(_arena.high_watermark() > 900);
+
+    const utb::basic_arena::marker _m = _arena.mark();
+    _arena.allocate(8);
+    _arena.rewind(_m);
+    TEST_ASSERT_EQUAL(_before, _arena.used());
+}
+
+void test_arena_vector_and_buffers() {
+    utb::static_arena<2048> _arena;
+    {
+        utb::arena_scope _frame(_arena);
+        utb::arena_vector<uint16_t> _v(_arena, 8);
+
+        for (uint16_t i = 0; i < 10; ++i) _v.push_back(i);
+        TEST_ASSERT_EQUAL(8, _v.size());
+        TEST_ASSERT_TRUE(_v.full());
+        TEST_ASSERT_EQUAL(7, _v.back());
+
+        utb::graphic::grb888_buffer<100>* _frameBuffer = _arena.create<utb::graphic::grb888_buffer<100> >();
+        TEST_ASSERT_NOT_NULL(_frameBuffer);
+        _frameBuffer->fill(utb::graphic::grb888(10, 20, 30));
+        TEST_ASSERT_EQUAL(20, (*_frameBuffer)[99].g);
+
+        utb::arena_vector<uint32_t> _tooLarge(_arena, 4096);
+        TEST_ASSERT_EQUAL(0, _tooLarge.capacity());
+        TEST_ASSERT_FALSE(_tooLarge.push_back(1));
+        TEST_ASSERT_TRUE(_arena.overflowed());
+    }
+    TEST_ASSERT_EQUAL(0, _arena.used());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_arena_alignment_and_overflow);
+    RUN_TEST(test_arena_scope_rewinds);
+    RUN_TEST(test_arena_vector_and_buffers);
+    return UNITY_END();
+}
@@ -0,0 +1,133 @@
+#include <unity.h>
+#include <string>
+#include "utbenchmark.h"
+
+// A counter that only moves when the benchmark body moves it.
+struct fake_counter {
+    using value_type = uint64_t;
+    static uint64_t ticks;
+    static constexpr const char* name()     { return "fake"; }
+    static constexpr const char* unit()     { return "ticks"; }
+    static void init()                      { ticks = 0; }
+    static value_type now()                 { return ticks; }
+};
+uint64_t fake_counter::ticks = 0;
+
+using runner_type = utb::bench::basic_runner<4, fake_counter>;
+
+static std::string text;
+static void writer(const char* s) { text += s; }
+
+void test_benchmark_run_min_and_mean() {
+    runner_type _bench;
+    uint64_t _cost = 10;
+
+    const utb::bench::result* _r = _bench.run("body", 4, [&_cost]() {
+        fake_counter::ticks += _cost;
+    }, 3);
+    TEST_ASSERT_NOT_NULL(_r);
+    TEST_ASSERT_EQUAL_FLOAT(10.0f, float(_r->min));
+    TEST_ASSERT_EQUAL_FLOAT(10.0f, float(_r->mean));
+
+    _r = _bench.run("steps", 2, [&_cost]() {
+        fake_counter::ticks += _cost;
+        if (fake_counter::ticks % 2 == 0) ++_cost;
+    }, 3);
+    TEST_ASSERT_TRUE(_r->min < _r->mean);
+    TEST_ASSERT_EQUAL(2, _bench.size());
+}
+
+void test_benchmark_rerun_keeps_min() {
+    runner_type _bench;
+    uint64_t _cost = 20;
+    auto _body = [&_cost]() { fake_counter::ticks += _cost; };
+
+    _bench.run("body", 10, _body, 2);
+    _cost = 5;
+    _bench.run("body", 10, _body, 2);
+    _cost = 40;
+    const utb::bench::result* _r = _bench.run("body", 10, _body, 4);
+
+    TEST_ASSERT_EQUAL(1, _bench.size());
+    TEST_ASSERT_EQUAL(8, _r->samples);
+    TEST_ASSERT_EQUAL_FLOAT(5.0f, float(_r->min));
+    TEST_ASSERT_EQUAL_FLOAT(26.25f, float(_r->mean));
+}
+
+void test_benchmark_write_json() {
+    runner_type _bench;
+
+    _bench.run("a", 4, []() { fake_counter::ticks += 3; }, 2);
+    _bench.run("b", 8, []() { fake_counter::ticks += 125; }, 1);
+
+    text.clear();
+    _bench.write_json(writer);
+    TEST_ASSERT_EQUAL_STRING(
+        "{\n"
+        "  \"counter\": \"fake\",\n"
+        "  \"unit\": \"ticks\",\n"
+        "  \"results\": [\n"
+        "    { \"name\": \"a\", \"iterations\": 4, \"samples\": 2, \"min\": 3.00, \"mean\": 3.00 },\n"
+        "    { \"name\": \"b\", \"iterations\": 8, \"samples\": 1, \"min\": 125.00, \"mean\": 125.00 }\n"
+        "  ]\n"
+        "}\n", text.c_str());
+
+    const utb::bench::baseline_entry _baseline[] = { { "b", 100.0, 0.0 } };
+    text.clear();
+    _bench.compare(_baseline, 1, 10, writer);
+    text.clear();
+    _bench.write_json(writer);
+    TEST_ASSERT_TRUE(text.find("\"min\": 125.00, \"mean\": 125.00, \"baseline\": 100.00, \"regression\": true }") != std::string::npos);
+    TEST_ASSERT_TRUE(text.find("\"mean\": 3.00 },") != std::string::npos);
+}
+
+void test_benchmark_compare() {
+    runner_type _bench;
+
+    _bench.run("fast", 10, []() { fake_counter::ticks += 105; }, 3);
+    _bench.run("slow", 10, []() { fake_counter::ticks += 125; }, 3);
+    _bench.run("noisy", 10, []() { fake_counter::ticks += 125; }, 3);
+
+    const utb::bench::baseline_entry _baseline[] = {
+        { "fast", 100.0, 0.0 },         // +5%, within the tolerance
+        { "slow", 100.0, 2.0 },         // +25%, over 10% plus the spread
+        { "noisy", 100.0, 20.0 },       // +25%, within 10% plus the spread of the baseline
+        { "unknown", 1.0, 0.0 },
+    };
+
+    text.clear();
+    TEST_ASSERT_EQUAL(1, _bench.compare(_baseline, 4, 10, writer));
+    TEST_ASSERT_EQUAL_STRING("regression: slow 100.00 -> 125.00 ticks\n", text.c_str());
+
+    TEST_ASSERT_FALSE(_bench[0].regression);
+    TEST_ASSERT_TRUE(_bench[1].regression);
+    TEST_ASSERT_FALSE(_bench[2].regression);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, float(_bench[2].baseline));
+
+    // a higher tolerance lets the slow one pass too
+    text.clear();
+    TEST_ASSERT_EQUAL(0, _bench.compare(_baseline, 4, 30, writer));
+    TEST_ASSERT_EQUAL(0, text.size());
+}
+
+void test_benchmark_capacity() {
+    runner_type _bench;
+    auto _body = []() { fake_counter::ticks += 1; };
+    const char* _names[] = { "0", "1", "2", "3", "4" };
+
+    for (int i = 0; i < 4; ++i) TEST_ASSERT_NOT_NULL(_bench.run(_names[i], 1, _body, 1));
+    TEST_ASSERT_NULL(_bench.run(_names[4], 1, _body, 1));
+    TEST_ASSERT_NOT_NULL(_bench.run(_names[2], 1, _body, 1));   // merged, needs no new slot
+    TEST_ASSERT_NULL(_bench.run(_names[0], 0, _body, 1));
+    TEST_ASSERT_EQUAL(4, _bench.size());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_benchmark_run_min_and_mean);
+    RUN_TEST(test_benchmark_rerun_keeps_min);
+    RUN_TEST(test_benchmark_write_json);
+    RUN_TEST(test_benchmark_compare);
+    RUN_TEST(test_benchmark_capacity);
+    return UNITY_END();
+}
@@ -0,0 +1,105 @@
+#include <unity.h>
+#include "utbuffer.h"
+
+static int g_raw5[5];
+static int g_raw8[8];
+
+// 5 wraps by compare and subtract, 8 by mask
+using ring5 = utb::ring_buffer<int, g_raw5, 5>;
+using ring8 = utb::ring_buffer<int, g_raw8, 8>;
+
+template <class TRing>
+static void expect(const TRing& ring, const int* values, utb::size_t n) {
+    TEST_ASSERT_EQUAL_UINT(n, ring.used());
+
+    utb::size_t i = 0;
+    for (typename TRing::const_iterator it = ring.begin(); it != ring.end(); ++it, ++i)
+        TEST_ASSERT_EQUAL_INT(values[i], *it);
+    TEST_ASSERT_EQUAL_UINT(n, i);
+    TEST_ASSERT_EQUAL_INT(int(n), ring.end() - ring.begin());
+
+    for (i = 0; i < n; ++i) TEST_ASSERT_EQUAL_INT(values[i], ring[i]);
+}
+
+template <class TRing>
+static void check_full_and_empty(TRing& ring, utb::size_t capacity) {
+    int v = 0;
+    TEST_ASSERT_TRUE(ring.is_empty());
+    TEST_ASSERT_FALSE(ring.is_full());
+    TEST_ASSERT_TRUE(ring.begin() == ring.end());
+    TEST_ASSERT_EQUAL_UINT(0, ring.read(&v, 1));
+    TEST_ASSERT_EQUAL_UINT(0, ring.skip(3));
+
+    for (utb::size_t i = 0; i < capacity; ++i) TEST_ASSERT_EQUAL_UINT(1, ring.write(int(i)));
+    TEST_ASSERT_TRUE(ring.is_full());
+    TEST_ASSERT_EQUAL_UINT(0, ring.free());
+
+    // a full ring rejects the write, the oldest element stays
+    TEST_ASSERT_EQUAL_UINT(0, ring.write(99));
+    TEST_ASSERT_EQUAL_UINT(0, ring.write(&v, 1));
+    TEST_ASSERT_EQUAL_UINT(0, ring.assign(&v, 1));
+    TEST_ASSERT_EQUAL_INT(0, ring.front());
+    TEST_ASSERT_EQUAL_INT(int(capacity - 1), ring.back());
+
+    for (utb::size_t i = 0; i < capacity; ++i) TEST_ASSERT_EQUAL_INT(int(i), ring.read());
+    TEST_ASSERT_TRUE(ring.is_empty());
+    ring.clear();
+}
+
+template <class TRing>
+static void check_wrap(TRing& ring, utb::size_t capacity) {
+    // move the head to every slot, fill the ring across the end and iterate over the wrap point
+    for (utb::size_t head = 0; head < 2 * capacity; ++head) {
+        ring.clear();
+        for (utb::size_t i = 0; i < head; ++i) { ring.write(-1); ring.read(); }
+
+        int _values[16];
+        for (utb::size_t i = 0; i < capacity; ++i) _values[i] = int(100 * head + i);
+
+        // two block writes, the second one is cut to the free space
+        TEST_ASSERT_EQUAL_UINT(capacity - 2, ring.write(_values, capacity - 2));
+        TEST_ASSERT_EQUAL_UINT(2, ring.write(_values + capacity - 2, 5));
+        TEST_ASSERT_TRUE(ring.is_full());
+        expect(ring, _values, capacity);
+
+        typename TRing::iterator _it = ring.begin() + (capacity - 1);
+        TEST_ASSERT_EQUAL_INT(_values[capacity - 1], *_it);
+        TEST_ASSERT_EQUAL_INT(_values[capacity - 2], *--_it);
+        TEST_ASSERT_EQUAL_INT(_values[1], ring.begin()[1]);
+
+        // block read across the wrap, then the rest one by one
+        int _out[16];
+        TEST_ASSERT_EQUAL_UINT(3, ring.read(_out, 3));
+        for (utb::size_t i = 0; i < 3; ++i) TEST_ASSERT_EQUAL_INT(_values[i], _out[i]);
+        expect(ring, _values + 3, capacity - 3);
+
+        ring.emplace_back(7);
+        TEST_ASSERT_EQUAL_INT(7, ring.back());
+        TEST_ASSERT_EQUAL_UINT(1, ring.skip(1));
+        TEST_ASSERT_EQUAL_INT(_values[4], ring.front());
+        TEST_ASSERT_EQUAL_UINT(capacity - 3, ring.read(_out, 16));
+        TEST_ASSERT_EQUAL_INT(7, _out[capacity - 4]);
+        TEST_ASSERT_TRUE(ring.is_empty());
+    }
+}
+
+void test_ring_buffer_full_and_empty() {
+    ring5 _r5;
+    ring8 _r8;
+    check_full_and_empty(_r5, 5);
+    check_full_and_empty(_r8, 8);
+}
+
+void test_ring_buffer_wrap() {
+    ring5 _r5;
+    ring8 _r8;
+    check_wrap(_r5, 5);
+    check_wrap(_r8, 8);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_ring_buffer_full_and_empty);
+    RUN_TEST(test_ring_buffer_wrap);
+    return UNITY_END();
+}
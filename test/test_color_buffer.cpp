@@ -0,0 +1,60 @@
+#include <unity.h>
+#include "utcolor_buffer.h"
+
+using namespace utb::graphic;
+
+void test_color_buffer_hsv_fixed() {
+    TEST_ASSERT_TRUE(from_hsv_fixed<rgb888>(0, 255, 255) == rgb888(255, 0, 0));
+    TEST_ASSERT_TRUE(from_hsv_fixed<rgb888>(0, 0, 77) == rgb888(77, 77, 77));
+
+    // hue 1/3 turn = green
+    const rgb161616 _g = from_hsv_fixed<rgb161616>(21845, 65535, 65535);
+    TEST_ASSERT_UINT16_WITHIN(2, 0, _g.r);
+    TEST_ASSERT_EQUAL_UINT16(65535, _g.g);
+    TEST_ASSERT_EQUAL_UINT16(0, _g.b);
+}
+
+void test_color_buffer_wire_order() {
+    grb888_buffer<4> frame;
+    frame.fill(grb888(1, 2, 3));
+
+    TEST_ASSERT_EQUAL_UINT(12, frame.bytes());
+    TEST_ASSERT_EQUAL_UINT8(2, frame.data()[0]);
+    TEST_ASSERT_EQUAL_UINT8(1, frame.data()[1]);
+    TEST_ASSERT_EQUAL_UINT8(3, frame.data()[11]);
+}
+
+void test_color_buffer_bulk_ops() {
+    grb888_buffer<8> a, b, c;
+    a.fill(grb888(255, 0, 10));
+    b.fill(grb888(0, 255, 200));
+
+    c.interpolate(a, b, 0);
+    TEST_ASSERT_TRUE(c[5] == a[5]);
+    c.interpolate(a, b, 255);
+    TEST_ASSERT_TRUE(c[5] == b[5]);
+
+    c.scale(255);
+    TEST_ASSERT_TRUE(c[5] == b[5]);
+    c.scale(0);
+    TEST_ASSERT_TRUE(c[5] == grb888());
+
+    uint8_t _invert[256];
+    for (int i = 0; i < 256; ++i) _invert[i] = uint8_t(255 - i);
+    c.apply_lut(_invert);
+    TEST_ASSERT_TRUE(c[7] == grb888(255, 255, 255));
+
+    // through the table object, which reads from flash when the tables live there
+    c.fill(grb888(10, 128, 200));
+    c.apply_lut(gamma_lut<22>::instance());
+    const gamma_lut<22>& _gamma = gamma_lut<22>::instance();
+    TEST_ASSERT_TRUE(c[7] == grb888(_gamma[10], _gamma[128], _gamma[200]));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_color_buffer_hsv_fixed);
+    RUN_TEST(test_color_buffer_wire_order);
+    RUN_TEST(test_color_buffer_bulk_ops);
+    return UNITY_END();
+}
@@ -0,0 +1,55 @@
+#include <unity.h>
+#include <math.h>
+#include "utcolor_buffer.h"
+
+using namespace utb::graphic;
+
+void test_color_lut_gamma() {
+    const gamma_lut<22>& _gamma = gamma_lut<22>::instance();
+    const srgb_lut& _srgb = srgb_lut::instance();
+
+    for (int i = 0; i < 256; ++i) {
+        const double _c = i / 255.0;
+        TEST_ASSERT_INT_WITHIN(1, int(255.0 * pow(_c, 2.2) + 0.5), _gamma[uint8_t(i)]);
+        TEST_ASSERT_INT_WITHIN(1, int(255.0 * (_c <= 0.04045 ? _c / 12.92 : pow((_c + 0.055) / 1.055, 2.4)) + 0.5),
+                               _srgb[uint8_t(i)]);
+    }
+    TEST_ASSERT_EQUAL_UINT8(0, _gamma[0]);
+    TEST_ASSERT_EQUAL_UINT8(255, _gamma[255]);
+}
+
+void test_color_lut_hsv_matches_float() {
+    for (float h = 0; h < 360.0f; h += 0.7f) {
+        for (float s = 0; s <= 1.0f; s += 0.25f) {
+            const color _exact = from_hsv<float>(h, s, 1.0f);
+            const color _lut = from_hsv<float, true>(h, s, 1.0f);
+
+            TEST_ASSERT_FLOAT_WITHIN(1.0f / 255, _exact.r, _lut.r);
+            TEST_ASSERT_FLOAT_WITHIN(1.0f / 255, _exact.g, _lut.g);
+            TEST_ASSERT_FLOAT_WITHIN(1.0f / 255, _exact.b, _lut.b);
+        }
+    }
+    for (int h = 0; h < 256; ++h)
+        TEST_ASSERT_TRUE((from_hsv_fixed<rgb888, true>(uint8_t(h), 200, 250) == from_hsv_fixed<rgb888>(uint8_t(h), 200, 250)));
+}
+
+void test_color_lut_yuv_matches_float() {
+    for (int y = 16; y < 236; y += 7) {
+        for (int u = 16; u < 241; u += 9) {
+            const color _exact = from_yuv<float>(float(y), float(u), 128.0f);
+            const color _lut = from_yuv<float, true>(float(y), float(u), 128.0f);
+
+            TEST_ASSERT_FLOAT_WITHIN(1.5f, _exact.r, _lut.r);
+            TEST_ASSERT_FLOAT_WITHIN(1.5f, _exact.g, _lut.g);
+            TEST_ASSERT_FLOAT_WITHIN(1.5f, _exact.b, _lut.b);
+        }
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_color_lut_gamma);
+    RUN_TEST(test_color_lut_hsv_matches_float);
+    RUN_TEST(test_color_lut_yuv_matches_float);
+    return UNITY_END();
+}
@@ -0,0 +1,158 @@
+#include <unity.h>
+#include "utcoroutine.h"
+#include "utscheduler.h"
+#include "uttimer_wheel.h"
+
+struct packet_reader {
+    utb::co_state co;
+    int available;
+    int steps;
+
+    bool step(uint32_t now) {
+        UTB_CO_BEGIN(co);
+        UTB_CO_WAIT_UNTIL(co, available >= 1);
+        ++steps;
+        UTB_CO_WAIT_TICKS(co, now, 5);
+        ++steps;
+        UTB_CO_YIELD(co);
+        ++steps;
+        UTB_CO_END(co);
+    }
+};
+
+void test_co_macros() {
+    packet_reader _r = packet_reader();
+    uint32_t _now = 0;
+
+    TEST_ASSERT_FALSE(_r.step(_now));
+    TEST_ASSERT_FALSE(_r.step(_now));
+    TEST_ASSERT_EQUAL(0, _r.steps);
+
+    _r.available = 1;
+    TEST_ASSERT_FALSE(_r.step(_now));      // waits for the ticks
+    TEST_ASSERT_EQUAL(1, _r.steps);
+    _now += 4;
+    TEST_ASSERT_FALSE(_r.step(_now));
+    TEST_ASSERT_EQUAL(1, _r.steps);
+    _now += 1;
+    TEST_ASSERT_FALSE(_r.step(_now));      // yields after the wait
+    TEST_ASSERT_EQUAL(2, _r.steps);
+    TEST_ASSERT_TRUE(_r.step(_now));
+    TEST_ASSERT_EQUAL(3, _r.steps);
+    TEST_ASSERT_TRUE(_r.co.done());
+    TEST_ASSERT_TRUE(_r.step(_now));
+}
+
+#if UTB_CONFIG_ENABLE_COROUTINE == UTB_YES
+using wheel_type = utb::basic_timer_wheel<8>;
+
+static utb::co_task blink(wheel_type& timers, int& toggles) {
+    for (int i = 0; i < 3; ++i) {
+        ++toggles;
+        co_await utb::co_sleep(timers, 10);
+    }
+}
+
+void test_co_task_sleep() {
+    wheel_type _timers;
+    int _toggles = 0;
+    {
+        utb::co_task _led = blink(_timers, _toggles);
+        TEST_ASSERT_TRUE(_led.valid());
+        TEST_ASSERT_EQUAL(0, _toggles);    // lazy start
+
+        _led.resume();
+        TEST_ASSERT_EQUAL(1, _toggles);
+        _timers.advance(9);
+        TEST_ASSERT_EQUAL(1, _toggles);
+        _timers.advance(1);
+        TEST_ASSERT_EQUAL(2, _toggles);
+        _timers.advance(20);
+        TEST_ASSERT_TRUE(_led.done());
+        TEST_ASSERT_EQUAL(3, _toggles);
+
+        utb::co_task _cancelled = blink(_timers, _toggles);
+        _cancelled.resume();
+        TEST_ASSERT_EQUAL(1, _timers.size());
+    }
+    // the destroyed task took its timer with it
+    TEST_ASSERT_TRUE(_timers.empty());
+    TEST_ASSERT_EQUAL(0, utb::coroutine_frames<>::pool().size());
+}
+
+static utb::co_task consumer(utb::co_event& ev, int& got) {
+    for (;;) {
+        co_await ev;
+        ev.reset();
+        ++got;
+    }
+}
+
+void test_co_event() {
+    utb::co_event _rx;
+    int _got = 0;
+
+    utb::co_task _a = consumer(_rx, _got);
+    utb::co_task _b = consumer(_rx, _got);
+    _a.resume();
+    _b.resume();
+    TEST_ASSERT_TRUE(_rx.has_waiters());
+
+    _rx.set();
+    TEST_ASSERT_EQUAL(2, _got);            // each waiter once, although it waits again at once
+    _rx.set();
+    TEST_ASSERT_EQUAL(4, _got);
+}
+
+using sched_type = utb::scheduler<4>;
+static sched_type sched;
+
+static utb::co_task driver(int& phase) {
+    ++phase;
+    co_await utb::co_defer(sched);         // behind the other ready tasks
+    ++phase;
+    co_await utb::co_defer(sched, 3);
+    ++phase;
+}
+
+void test_co_task_on_scheduler() {
+    int _phase = 0;
+    utb::co_task _driver = driver(_phase);
+    utb::task_id _id = sched.create(1, [&_driver]() { _driver.resume(); });
+
+    sched.post(_id);
+    TEST_ASSERT_EQUAL(2, sched.run());
+    TEST_ASSERT_EQUAL(2, _phase);
+
+    sched.tick(2);
+    TEST_ASSERT_EQUAL(0, sched.run());
+    sched.tick();
+    TEST_ASSERT_EQUAL(1, sched.run());
+    TEST_ASSERT_EQUAL(3, _phase);
+    TEST_ASSERT_TRUE(_driver.done());
+}
+
+void test_co_task_frame_exhausted() {
+    using tiny = utb::basic_co_task<utb::coroutine_frames<16, 1> >;
+    struct local {
+        static tiny body(int& x) { ++x; co_return; }
+    };
+    int _x = 0;
+    tiny _t = local::body(_x);
+    TEST_ASSERT_FALSE(_t.valid());
+    TEST_ASSERT_FALSE(_t.resume());
+    TEST_ASSERT_EQUAL(0, _x);
+}
+#endif
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_co_macros);
+#if UTB_CONFIG_ENABLE_COROUTINE == UTB_YES
+    RUN_TEST(test_co_task_sleep);
+    RUN_TEST(test_co_event);
+    RUN_TEST(test_co_task_on_scheduler);
+    RUN_TEST(test_co_task_frame_exhausted);
+#endif
+    return UNITY_END();
+}
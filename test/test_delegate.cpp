@@ -0,0 +1,108 @@
+#include <unity.h>
+#include "utdelegate.h"
+
+static int trace[32];
+static int trace_len;
+
+struct scaled {
+    int k;
+    void operator()(int x) const { trace[trace_len++] = k * x; }
+};
+
+static void record(int x) { trace[trace_len++] = -x; }
+
+static int live;
+struct tracked {
+    int tag;
+    explicit tracked(int t) : tag(t) { ++live; }
+    tracked(const tracked& o) : tag(o.tag) { ++live; }
+    tracked(tracked&& o) : tag(o.tag) { ++live; }
+    ~tracked() { --live; }
+    void operator()(int) const { trace[trace_len++] = tag; }
+};
+
+using delegate_type = utb::basic_multicast_delegate<void(int), 8, 3, 16>;
+
+void test_delegate_groups_by_type() {
+    delegate_type _d;
+    trace_len = 0;
+
+    _d.add(scaled{ 1 });
+    _d.add(&record);
+    _d.add(scaled{ 2 });
+    _d.add(&record);
+    TEST_ASSERT_EQUAL(4, _d.size());
+    TEST_ASSERT_EQUAL(2, _d.groups());
+
+    _d(5);
+    const int _expected[4] = { 5, 10, -5, -5 };
+    TEST_ASSERT_EQUAL(4, trace_len);
+    for (int i = 0; i < 4; ++i) TEST_ASSERT_EQUAL(_expected[i], trace[i]);
+}
+
+void test_delegate_non_trivial_and_capacity() {
+    live = 0;
+    {
+        delegate_type _d;
+        utb::delegate_id _first = _d.add(tracked(7));
+        _d.add(&record);
+        _d.add(tracked(8));                 // moves the record group up one slot
+        TEST_ASSERT_EQUAL(2, live);
+
+        trace_len = 0;
+        _d(1);
+        TEST_ASSERT_EQUAL(7, trace[0]);
+        TEST_ASSERT_EQUAL(8, trace[1]);
+        TEST_ASSERT_EQUAL(-1, trace[2]);
+
+        TEST_ASSERT_TRUE(_d.remove(_first));
+        TEST_ASSERT_FALSE(_d.remove(_first));
+        TEST_ASSERT_EQUAL(1, live);
+
+        // a third type fits, a fourth does not
+        TEST_ASSERT_NOT_EQUAL(utb::invalid_delegate, _d.add(scaled{ 3 }));
+        TEST_ASSERT_EQUAL(utb::invalid_delegate, _d.add([](int) { }));
+        while (!_d.full()) _d.add(&record);
+        TEST_ASSERT_EQUAL(utb::invalid_delegate, _d.add(&record));
+    }
+    TEST_ASSERT_EQUAL(0, live);
+}
+
+static delegate_type removing;
+static utb::delegate_id victim, self;
+
+struct remover {
+    void operator()(int) const {
+        trace[trace_len++] = 100;
+        removing.remove(victim);
+        removing.remove(self);
+        TEST_ASSERT_EQUAL(utb::invalid_delegate, removing.add(&record));
+    }
+};
+
+void test_delegate_remove_while_running() {
+    trace_len = 0;
+    self = removing.add(remover());
+    victim = removing.add(&record);
+    removing.add(scaled{ 1 });
+
+    removing(3);
+    TEST_ASSERT_EQUAL(2, trace_len);        // the record callback was skipped
+    TEST_ASSERT_EQUAL(100, trace[0]);
+    TEST_ASSERT_EQUAL(3, trace[1]);
+    TEST_ASSERT_EQUAL(1, removing.size());
+    TEST_ASSERT_EQUAL(1, removing.groups());
+
+    trace_len = 0;
+    removing(4);
+    TEST_ASSERT_EQUAL(1, trace_len);
+    TEST_ASSERT_EQUAL(4, trace[0]);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_delegate_groups_by_type);
+    RUN_TEST(test_delegate_non_trivial_and_capacity);
+    RUN_TEST(test_delegate_remove_while_running);
+    return UNITY_END();
+}
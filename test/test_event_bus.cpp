@@ -0,0 +1,144 @@
+#include <unity.h>
+#include "utevent_bus.h"
+
+struct button_pressed { uint8_t pin; };
+struct frame_received { uint8_t length; uint8_t data[16]; };
+struct battery_low { uint16_t millivolt; };
+
+using bus_type = utb::basic_event_bus<3, 8, button_pressed, frame_received, battery_low>;
+
+static_assert(bus_type::id_of<button_pressed>() == 0, "ids follow the declaration");
+static_assert(bus_type::id_of<battery_low>() == 2, "ids follow the declaration");
+
+void test_event_bus_publish_in_order() {
+    static bus_type _bus;
+    static int _calls[4];
+    static int _n = 0;
+
+    _bus.subscribe<button_pressed>([](const button_pressed& e) { _calls[_n++] = e.pin; });
+    _bus.subscribe<button_pressed>([](const button_pressed& e) { _calls[_n++] = e.pin * 10; });
+    _bus.subscribe<battery_low>([](const battery_low&) { _calls[_n++] = -1; });
+
+    TEST_ASSERT_EQUAL(2, _bus.publish(button_pressed{ 3 }));
+    TEST_ASSERT_EQUAL(2, _n);
+    TEST_ASSERT_EQUAL(3, _calls[0]);
+    TEST_ASSERT_EQUAL(30, _calls[1]);
+    TEST_ASSERT_EQUAL(0, _bus.publish(frame_received()));
+}
+
+void test_event_bus_unsubscribe_and_reuse() {
+    bus_type _bus;
+    int _sum = 0;
+
+    utb::subscription_id _a = _bus.subscribe<battery_low>([&_sum](const battery_low& e) { _sum += e.millivolt; });
+    utb::subscription_id _b = _bus.subscribe<battery_low>([&_sum](const battery_low&) { _sum += 1; });
+    utb::subscription_id _c = _bus.subscribe<battery_low>([&_sum](const battery_low&) { _sum += 2; });
+    TEST_ASSERT_EQUAL(utb::invalid_subscription, _bus.subscribe<battery_low>([](const battery_low&) { }));
+
+    TEST_ASSERT_TRUE(_bus.unsubscribe(_b));
+    TEST_ASSERT_FALSE(_bus.unsubscribe(_b));
+    TEST_ASSERT_EQUAL(2, _bus.subscriber_count<battery_low>());
+    TEST_ASSERT_EQUAL(2, _bus.publish(battery_low{ 100 }));
+    TEST_ASSERT_EQUAL(102, _sum);
+
+    // the free slot is used again under a new id, the other handles stay valid
+    const utb::subscription_id _d = _bus.subscribe<battery_low>([&_sum](const battery_low&) { _sum += 1000; });
+    TEST_ASSERT_EQUAL(_b & 0xFFFF, _d & 0xFFFF);
+    TEST_ASSERT_TRUE(_b != _d);
+
+    // the stale id of the slot must not remove the new handler
+    TEST_ASSERT_FALSE(_bus.unsubscribe(_b));
+    TEST_ASSERT_EQUAL(3, _bus.subscriber_count<battery_low>());
+    TEST_ASSERT_TRUE(_bus.unsubscribe(_a));
+    TEST_ASSERT_TRUE(_bus.unsubscribe(_c));
+    _bus.publish(battery_low{ 100 });
+    TEST_ASSERT_EQUAL(1102, _sum);
+
+    TEST_ASSERT_TRUE(_bus.unsubscribe(_d));
+    TEST_ASSERT_FALSE(_bus.unsubscribe(_d));
+    TEST_ASSERT_EQUAL(0, _bus.subscriber_count<battery_low>());
+}
+
+void test_event_bus_deferred_dispatch() {
+    bus_type _bus;
+    int _length = 0, _pins = 0;
+
+    _bus.subscribe<frame_received>([&_length](const frame_received& e) { _length += e.length + e.data[e.length - 1]; });
+    _bus.subscribe<button_pressed>([&_pins](const button_pressed& e) { _pins += e.pin; });
+
+    frame_received _f = frame_received();
+    _f.length = 4;
+    _f.data[3] = 40;
+    TEST_ASSERT_TRUE(_bus.post(_f));
+    TEST_ASSERT_TRUE(_bus.post(button_pressed{ 7 }));
+    TEST_ASSERT_EQUAL(0, _length);
+    TEST_ASSERT_EQUAL(2, _bus.pending());
+
+    TEST_ASSERT_EQUAL(1, _bus.dispatch(1));
+    TEST_ASSERT_EQUAL(44, _length);
+    TEST_ASSERT_EQUAL(0, _pins);
+    TEST_ASSERT_EQUAL(1, _bus.dispatch());
+    TEST_ASSERT_EQUAL(7, _pins);
+
+    for (int i = 0; i < 8; ++i) TEST_ASSERT_TRUE(_bus.post(button_pressed{ 1 }));
+    TEST_ASSERT_FALSE(_bus.post(button_pressed{ 1 }));
+    TEST_ASSERT_EQUAL(8, _bus.dispatch());
+    TEST_ASSERT_EQUAL(15, _pins);
+}
+
+/// Unsubscribes itself when called, the destructor marks the object as gone.
+struct self_remover {
+    bus_type* bus;
+    utb::subscription_id* id;
+    int* calls;
+    bool alive;
+
+    self_remover(bus_type* b, utb::subscription_id* i, int* c) : bus(b), id(i), calls(c), alive(true) { }
+    self_remover(const self_remover& o) : bus(o.bus), id(o.id), calls(o.calls), alive(o.alive) { }
+    ~self_remover() { alive = false; }
+
+    void operator()(const battery_low&) const {
+        TEST_ASSERT_TRUE(bus->unsubscribe(*id));
+        TEST_ASSERT_FALSE(bus->unsubscribe(*id));
+        TEST_ASSERT_EQUAL(2, bus->subscriber_count<battery_low>());
+        // still running: the object must not have been destroyed by the unsubscribe
+        *calls += alive ? 1 : 100;
+    }
+};
+
+void test_event_bus_unsubscribe_while_publishing() {
+    bus_type _bus;
+    int _calls = 0, _later = 0;
+    bool _armed = true;
+    utb::subscription_id _self = utb::invalid_subscription, _last = utb::invalid_subscription;
+
+    _self = _bus.subscribe<battery_low>(self_remover(&_bus, &_self, &_calls));
+    // removes the handler behind it once, which is then skipped here and in the nested publish
+    _bus.subscribe<battery_low>([&_bus, &_last, &_armed](const battery_low&) {
+        if (!_armed) return;
+        _armed = false;
+        TEST_ASSERT_TRUE(_bus.unsubscribe(_last));
+        TEST_ASSERT_EQUAL(1, _bus.publish(battery_low{ 0 }));
+    });
+    _last = _bus.subscribe<battery_low>([&_later](const battery_low&) { ++_later; });
+
+    TEST_ASSERT_EQUAL(2, _bus.publish(battery_low{ 1 }));
+    TEST_ASSERT_EQUAL(1, _calls);
+    TEST_ASSERT_EQUAL(0, _later);
+    TEST_ASSERT_EQUAL(1, _bus.subscriber_count<battery_low>());
+
+    // both slots are free again once the publish returned
+    TEST_ASSERT_EQUAL(_self & 0xFFFF, _bus.subscribe<battery_low>([](const battery_low&) { }) & 0xFFFF);
+    TEST_ASSERT_EQUAL(_last & 0xFFFF, _bus.subscribe<battery_low>([](const battery_low&) { }) & 0xFFFF);
+    TEST_ASSERT_EQUAL(3, _bus.publish(battery_low{ 2 }));
+    TEST_ASSERT_EQUAL(1, _calls);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_event_bus_publish_in_order);
+    RUN_TEST(test_event_bus_unsubscribe_and_reuse);
+    RUN_TEST(test_event_bus_deferred_dispatch);
+    RUN_TEST(test_event_bus_unsubscribe_while_publishing);
+    return UNITY_END();
+}
@@ -0,0 +1,72 @@
+#include <unity.h>
+#include "utfast_addr.h"
+
+void test_fast_addr_transaction() {
+    volatile uint32_t reg = 0xF0;
+    {
+        utb::register_transaction<uint32_t> tx(&reg);
+        tx.set(0).clear(4).write_field(8, 4, 0xA).flip(31);
+
+        TEST_ASSERT_EQUAL_UINT32(0xF0, reg);    // nothing written before commit
+        TEST_ASSERT_EQUAL_UINT32(0xA, tx.read_field(8, 4));
+    }
+    TEST_ASSERT_EQUAL_UINT32(0x80000AE1, reg);
+
+    {
+        utb::register_transaction<uint32_t> tx(&reg);
+        tx.set(0);
+        TEST_ASSERT_FALSE(tx.commit());         // unchanged, no store
+    }
+    {
+        utb::register_transaction<uint32_t> tx(&reg);
+        tx.clear_mask(0xFFFFFFFF);
+        tx.discard();
+    }
+    TEST_ASSERT_EQUAL_UINT32(0x80000AE1, reg);
+}
+
+void test_fast_addr_write_only_transaction() {
+    // without a read the register content is unknown: always store, even when the value
+    // happens to equal the complement of initial or initial itself
+    volatile uint8_t reg = 0x5A;
+    {
+        utb::register_transaction<uint8_t> tx(&reg, 0x00);
+        tx.set_mask(0xFF);
+    }
+    TEST_ASSERT_EQUAL_UINT8(0xFF, reg);
+    {
+        utb::register_transaction<uint8_t> tx(&reg, 0x00);
+    }
+    TEST_ASSERT_EQUAL_UINT8(0x00, reg);
+
+    reg = 0x5A;
+    utb::register_transaction<uint8_t> tx(&reg, 0x0F);
+    TEST_ASSERT_TRUE(tx.commit());
+    TEST_ASSERT_FALSE(tx.commit());         // once only
+    TEST_ASSERT_EQUAL_UINT8(0x0F, reg);
+}
+
+void test_fast_addr_masks() {
+    uint32_t raw = 5;
+    utb::fuint32_t* view = utb::create_fast_view<uint32_t>(reinterpret_cast<uintptr_t>(&raw));
+
+    view->modify(1, 8);
+    TEST_ASSERT_EQUAL_UINT32(0xC, raw);
+    view->set_mask(0x100);
+    view->clear_mask(0x8);
+    TEST_ASSERT_EQUAL_UINT32(0x104, raw);
+
+    volatile uint32_t w1ts = 0, w1tc = 0;
+    utb::set_clear_register<uint32_t> gpio(reinterpret_cast<uintptr_t>(&w1ts), reinterpret_cast<uintptr_t>(&w1tc));
+    gpio.modify(0x3, 0x4);
+    TEST_ASSERT_EQUAL_UINT32(0x4, w1ts);
+    TEST_ASSERT_EQUAL_UINT32(0x3, w1tc);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_fast_addr_transaction);
+    RUN_TEST(test_fast_addr_write_only_transaction);
+    RUN_TEST(test_fast_addr_masks);
+    return UNITY_END();
+}
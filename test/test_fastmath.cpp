@@ -0,0 +1,177 @@
+#include <unity.h>
+#include <math.h>
+#include "utfastmath.h"
+#include "utquaternion.h"
+#include "utmath.h"
+
+using namespace utb::math;
+using utb::fixed16_16;
+
+static const double ulp16 = 1.0 / 65536.0;
+
+template <class TPolicy>
+static void check_float_policy() {
+    // max_error bounds |approx - exact| / max(1, |exact|)
+    const float _err = TPolicy::max_error;
+
+    for (float x = -50.0f; x < 50.0f; x += 0.0137f) {
+        float _s, _c;
+        fast_sincos<TPolicy>(x, _s, _c);
+        TEST_ASSERT_FLOAT_WITHIN(_err, ::sin(double(x)), _s);
+        TEST_ASSERT_FLOAT_WITHIN(_err, ::cos(double(x)), _c);
+    }
+    // the documented range of the reduction, |x| < 10^5
+    for (float x = -1e5f; x < 1e5f; x += 3.7013f) {
+        float _s, _c;
+        fast_sincos<TPolicy>(x, _s, _c);
+        TEST_ASSERT_FLOAT_WITHIN(_err, ::sin(double(x)), _s);
+        TEST_ASSERT_FLOAT_WITHIN(_err, ::cos(double(x)), _c);
+    }
+    for (float y = -3.0f; y <= 3.0f; y += 0.25f) {
+        for (float x = -3.0f; x <= 3.0f; x += 0.125f) {
+            TEST_ASSERT_FLOAT_WITHIN(_err, ::atan2(double(y), double(x)), fast_atan2<TPolicy>(y, x));
+        }
+    }
+    for (float x = -80.0f; x < 80.0f; x += 0.031f) {
+        TEST_ASSERT_FLOAT_WITHIN(_err, 1.0, fast_exp<TPolicy>(x) / ::exp(double(x)));
+    }
+    for (float x = 1e-6f; x < 1e6f; x *= 1.013f) {
+        const double _log = ::log(double(x));
+        TEST_ASSERT_FLOAT_WITHIN(_err * (::fabs(_log) > 1.0 ? ::fabs(_log) : 1.0), _log, fast_log<TPolicy>(x));
+        TEST_ASSERT_FLOAT_WITHIN(_err, 1.0, fast_sqrt<TPolicy>(x) / ::sqrt(double(x)));
+    }
+}
+
+void test_float_accuracy() {
+    check_float_policy<approx_fast>();
+    check_float_policy<approx_precise>();
+    check_float_policy<approx_full>();
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, fast_atan2(0.0f, 0.0f));
+    TEST_ASSERT_TRUE(fast_log(0.0f) < -1e30f);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, fast_sqrt(0.0f));
+}
+
+void test_fixed_accuracy() {
+    for (double x = -30.0; x < 30.0; x += 0.0113) {
+        const fixed16_16 _x(x);
+        const double _xd = double(_x);
+        fixed16_16 _s, _c;
+        fast_sincos<approx_full>(_x, _s, _c);
+        TEST_ASSERT_FLOAT_WITHIN(4 * ulp16, ::sin(_xd), double(_s));
+        TEST_ASSERT_FLOAT_WITHIN(4 * ulp16, ::cos(_xd), double(_c));
+        TEST_ASSERT_FLOAT_WITHIN(2e-3, ::sin(_xd), double(fast_sin<approx_fast>(_x)));
+    }
+    for (double y = -100.0; y <= 100.0; y += 6.25) {
+        for (double x = -100.0; x <= 100.0; x += 3.125) {
+            TEST_ASSERT_FLOAT_WITHIN(4 * ulp16, ::atan2(y, x), double(fast_atan2(fixed16_16(y), fixed16_16(x))));
+        }
+    }
+    // small negative operands are scaled up after the half-plane rotation
+    for (double y = -0.25; y <= 0.25; y += 0.05) {
+        for (double x = -0.25; x <= 0.25; x += 0.05) {
+            const double _xd = double(fixed16_16(x)), _yd = double(fixed16_16(y));
+            if (_xd == 0.0 && _yd == 0.0) continue;
+            TEST_ASSERT_FLOAT_WITHIN(4 * ulp16, ::atan2(_yd, _xd), double(fast_atan2(fixed16_16(y), fixed16_16(x))));
+        }
+    }
+    TEST_ASSERT_FLOAT_WITHIN(4 * ulp16, ::atan2(0.05, -0.05), double(fast_atan2(fixed16_16(0.05), fixed16_16(-0.05))));
+
+    for (double x = -10.0; x < 10.0; x += 0.0173) {
+        const fixed16_16 _x(x);
+        const double _e = ::exp(double(_x));
+        TEST_ASSERT_FLOAT_WITHIN(4 * ulp16 + 1e-5 * _e, _e, double(fast_exp<approx_full>(_x)));
+    }
+    for (double x = 0.001; x < 30000.0; x *= 1.021) {
+        const fixed16_16 _x(x);
+        TEST_ASSERT_FLOAT_WITHIN(4 * ulp16, ::log(double(_x)), double(fast_log<approx_full>(_x)));
+    }
+    TEST_ASSERT_EQUAL(utb::numeric_limits<fixed16_16>::max().raw(), fast_exp(fixed16_16(20)).raw());
+    TEST_ASSERT_EQUAL(0, fast_exp(fixed16_16(-20)).raw());
+}
+
+void test_batch_matches_scalar() {
+    // 37 values: vector bodies and a tail
+    float _x[37], _y[37], _out[37], _s[37], _c[37];
+    for (int i = 0; i < 37; ++i) { _x[i] = 0.37f * float(i) - 5.0f; _y[i] = 2.0f - 0.11f * float(i); }
+
+    sin_n<approx_fast>(_x, _out, 37);
+    for (int i = 0; i < 37; ++i) TEST_ASSERT_EQUAL_FLOAT(fast_sin<approx_fast>(_x[i]), _out[i]);
+    sincos_n(_x, _s, _c, 37);
+    for (int i = 0; i < 37; ++i) {
+        TEST_ASSERT_EQUAL_FLOAT(fast_sin(_x[i]), _s[i]);
+        TEST_ASSERT_EQUAL_FLOAT(fast_cos(_x[i]), _c[i]);
+    }
+    atan2_n(_y, _x, _out, 37);
+    for (int i = 0; i < 37; ++i) TEST_ASSERT_EQUAL_FLOAT(fast_atan2(_y[i], _x[i]), _out[i]);
+    exp_n<approx_full>(_x, _out, 37);
+    for (int i = 0; i < 37; ++i) TEST_ASSERT_EQUAL_FLOAT(fast_exp<approx_full>(_x[i]), _out[i]);
+
+    fixed16_16 _fx[37], _fout[37];
+    for (int i = 0; i < 37; ++i) _fx[i] = fixed16_16(0.25f * float(i) + 0.01f);
+    log_n(_fx, _fout, 37);
+    for (int i = 0; i < 37; ++i) TEST_ASSERT_EQUAL(fast_log(_fx[i]).raw(), _fout[i].raw());
+    sqrt_n(_fx, _fout, 37);
+    for (int i = 0; i < 37; ++i) TEST_ASSERT_EQUAL(fast_sqrt(_fx[i]).raw(), _fout[i].raw());
+}
+
+/// sin(q) by its Taylor series in double, long enough to be exact for |q| < 2.
+static quaternion<double> taylor_sin(const quaternion<double>& q) {
+    const quaternion<double> _q2 = q * q;
+    quaternion<double> _term = q, _sum = q;
+    for (int n = 1; n < 20; n++) {
+        _term = _term * _q2 / double(-(2 * n) * (2 * n + 1));
+        _sum += _term;
+    }
+    return _sum;
+}
+
+void test_quaternion_functions() {
+    const quatf _q(0.7f, -0.3f, 0.9f, 0.4f);
+    const quatf _s = sin(_q), _c = cos(_q);
+
+    const quatf _one = _s * _s + _c * _c;
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.0f, _one.s);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.0f, lenght(_one.v()));
+
+    const quaternion<double> _ref = taylor_sin(quaternion<double>(0.7, -0.3, 0.9, 0.4));
+    for (int i = 0; i < 4; ++i) TEST_ASSERT_FLOAT_WITHIN(1e-6f, _ref.qu[i], _s.qu[i]);
+
+    const quatf _t = tan(_q) * _c - _s;
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.0f, lenght(_t));
+
+    // a tiny vector part takes the series of sinh(l)/l
+    const quatf _small = sin(quatf(0.5f, 1e-3f, 0.0f, 0.0f));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, ::sin(0.5), _small.s);
+    TEST_ASSERT_FLOAT_WITHIN(1e-8f, 1e-3 * ::cos(0.5), _small.x);
+
+    const quaternion<fixed16_16> _qx(fixed16_16(0.7), fixed16_16(-0.3), fixed16_16(0.9), fixed16_16(0.4));
+    const quaternion<fixed16_16> _sx = sin(_qx), _cx = cos(_qx);
+    const quaternion<fixed16_16> _onex = _sx * _sx + _cx * _cx;
+    TEST_ASSERT_FLOAT_WITHIN(16 * ulp16, 1.0, double(_onex.s));
+    for (int i = 0; i < 4; ++i) TEST_ASSERT_FLOAT_WITHIN(16 * ulp16, _ref.qu[i], double(_sx.qu[i]));
+
+    const quatf _r = exp(log(normalize(_q)));
+    const quatf _n = normalize(_q);
+    for (int i = 0; i < 4; ++i) TEST_ASSERT_FLOAT_WITHIN(1e-5f, _n.qu[i], _r.qu[i]);
+}
+
+void test_factorial_and_radians() {
+    TEST_ASSERT_EQUAL(1, factorial(0));
+    TEST_ASSERT_EQUAL(120, factorial(5));
+    TEST_ASSERT_EQUAL(0, factorial(-3));
+    TEST_ASSERT_TRUE(factorial(uint64_t(20)) == 2432902008176640000ull);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, 1.0, factorial(22.0) / 1.1240007277776077e21);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 3.14159265f, radians(180.0f));
+    TEST_ASSERT_FLOAT_WITHIN(1e-9, 90.0, degrees(1.5707963267948966));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_float_accuracy);
+    RUN_TEST(test_fixed_accuracy);
+    RUN_TEST(test_batch_matches_scalar);
+    RUN_TEST(test_quaternion_functions);
+    RUN_TEST(test_factorial_and_radians);
+    return UNITY_END();
+}
@@ -0,0 +1,128 @@
+#include <unity.h>
+#include <math.h>
+#include "utfixed.h"
+#include "utvector3.h"
+#include "utquaternion.h"
+#include "utrectangle.h"
+
+using utb::fixed16_16;
+using utb::fixed8_8;
+using utb::fixed2_14;
+
+static const double ulp16 = 1.0 / 65536.0;
+
+void test_fixed_arithmetic() {
+    constexpr fixed16_16 _a(1.5), _b(-2.25);
+    static_assert(_a.raw() == 0x18000, "constexpr conversion");
+
+    TEST_ASSERT_FLOAT_WITHIN(ulp16, -0.75, double(_a + _b));
+    TEST_ASSERT_FLOAT_WITHIN(ulp16, 3.75, double(_a - _b));
+    TEST_ASSERT_FLOAT_WITHIN(ulp16, -3.375, double(_a * _b));
+    TEST_ASSERT_FLOAT_WITHIN(ulp16, -2.0 / 3.0, double(_a / _b));
+    TEST_ASSERT_FLOAT_WITHIN(ulp16, 4.5, double(_a * 3));
+    TEST_ASSERT_FLOAT_WITHIN(ulp16, 0.5, double(_a / 3));
+    TEST_ASSERT_EQUAL(-2, int(fixed16_16(-2.75)));
+
+    fixed16_16 _c = _a;
+    _c *= 2; _c += _b; _c /= fixed16_16(0.25);
+    TEST_ASSERT_FLOAT_WITHIN(ulp16, 3.0, double(_c));
+
+    TEST_ASSERT_TRUE(_b < _a);
+    TEST_ASSERT_TRUE(fixed16_16(0.5) == fixed16_16(1) / 2);
+    TEST_ASSERT_TRUE(-2 == int(floor(fixed16_16(-1.5))));
+    TEST_ASSERT_TRUE(-1 == int(ceil(fixed16_16(-1.5))));
+}
+
+void test_fixed_overflow_and_rounding() {
+    // saturate
+    const fixed8_8 _big(100);
+    TEST_ASSERT_EQUAL(INT16_MAX, (_big * _big).raw());
+    TEST_ASSERT_EQUAL(INT16_MIN, (-_big * _big).raw());
+    TEST_ASSERT_EQUAL(INT16_MAX, (_big / fixed8_8(0)).raw());
+    TEST_ASSERT_EQUAL(INT16_MAX, fixed8_8(1000.0).raw());
+    TEST_ASSERT_EQUAL(INT16_MIN, fixed8_8(-1000).raw());
+
+    // wrap
+    using wrap8_8 = utb::fixed<8, 8, utb::fixed_wrap>;
+    TEST_ASSERT_EQUAL(int16_t(0x8000), (wrap8_8(127) + wrap8_8(1)).raw());
+
+    // nearest and truncate: 1/3 in Q7.8 is 85.33, -1/3 is -85.33
+    using trunc8_8 = utb::fixed<8, 8, utb::fixed_saturate, utb::fixed_truncate>;
+    TEST_ASSERT_EQUAL(85, (fixed8_8(1) / fixed8_8(3)).raw());
+    TEST_ASSERT_EQUAL(171, (fixed8_8(2) / fixed8_8(3)).raw());
+    TEST_ASSERT_EQUAL(170, (trunc8_8(2) / trunc8_8(3)).raw());
+    TEST_ASSERT_EQUAL(-171, (fixed8_8(-2) / fixed8_8(3)).raw());
+    TEST_ASSERT_EQUAL(1, fixed8_8(0.003).raw());
+    TEST_ASSERT_EQUAL(0, trunc8_8(0.003).raw());
+    TEST_ASSERT_EQUAL(-1, trunc8_8(-0.003).raw());
+}
+
+void test_fixed_sqrt_sin_cos() {
+    for (double x = 0.0; x < 30000.0; x = x * 1.37 + 0.01) {
+        TEST_ASSERT_FLOAT_WITHIN(ulp16, ::sqrt(double(fixed16_16(x))), double(sqrt(fixed16_16(x))));
+    }
+    TEST_ASSERT_EQUAL(0, sqrt(fixed16_16(-4)).raw());
+
+    for (double x = -20.0; x < 20.0; x += 0.037) {
+        fixed16_16 _s, _c;
+        sincos(fixed16_16(x), _s, _c);
+        const double _x = double(fixed16_16(x));
+        TEST_ASSERT_FLOAT_WITHIN(8 * ulp16, ::sin(_x), double(_s));
+        TEST_ASSERT_FLOAT_WITHIN(8 * ulp16, ::cos(_x), double(_c));
+    }
+    for (double x = -1.9; x < 1.9; x += 0.1) {
+        TEST_ASSERT_FLOAT_WITHIN(4.0 / 16384.0, ::sin(x), double(sin(fixed2_14(x))));
+    }
+    // more fraction bits than the Q29 of the CORDIC
+    using fixed2_30 = utb::fixed<2, 30>;
+    for (double x = -1.9; x < 1.9; x += 0.1) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-7, ::sin(x), double(sin(fixed2_30(x))));
+    }
+}
+
+void test_fixed_numeric_limits() {
+    using limits = utb::numeric_limits<fixed16_16>;
+    TEST_ASSERT_FLOAT_WITHIN(ulp16, 32768.0, double(limits::max()));
+    TEST_ASSERT_EQUAL(-32768, int(limits::lowest()));
+    TEST_ASSERT_EQUAL(1, limits::epsilon().raw());
+    TEST_ASSERT_EQUAL(31, limits::digits);
+    TEST_ASSERT_TRUE(limits::is_exact && !limits::is_integer && !limits::is_modulo);
+    using wrap_limits = utb::numeric_limits<utb::fixed<16, 16, utb::fixed_wrap>>;
+    TEST_ASSERT_TRUE(wrap_limits::is_modulo);
+
+    TEST_ASSERT_EQUAL(INT16_MAX, utb::numeric_limits<int16_t>::max());
+    TEST_ASSERT_EQUAL(INT32_MIN, utb::numeric_limits<int32_t>::min());
+}
+
+void test_fixed_math_types() {
+    using namespace utb::math;
+
+    const vector3<fixed16_16> _v(fixed16_16(3), fixed16_16(0), fixed16_16(-4));
+    TEST_ASSERT_FLOAT_WITHIN(ulp16, 5.0, double(lenght(_v)));
+    TEST_ASSERT_FLOAT_WITHIN(4 * ulp16, 1.0, double(lenght(normalize(_v))));
+
+    // 90 degrees about z
+    const quaternion<fixed16_16> _q = quaternion_fromaxis(fixed16_16(-1.5707963), vector3<fixed16_16>(fixed16_16(0), fixed16_16(0), fixed16_16(2)));
+    const quaternion<fixed16_16> _p(fixed16_16(0), fixed16_16(1), fixed16_16(0), fixed16_16(0));
+    const quaternion<fixed16_16> _r = _q * _p * conjugate(_q);
+    TEST_ASSERT_FLOAT_WITHIN(8 * ulp16, 0.0, double(_r.x));
+    TEST_ASSERT_FLOAT_WITHIN(8 * ulp16, 1.0, double(_r.y));
+    TEST_ASSERT_FLOAT_WITHIN(8 * ulp16, 1.0, double(lenght(_q * invert(_q))));
+
+    const rectangle<fixed16_16> _a(fixed16_16(0.5), fixed16_16(0), fixed16_16(2), fixed16_16(2));
+    const rectangle<fixed16_16> _b(fixed16_16(1.5), fixed16_16(1), fixed16_16(2), fixed16_16(2));
+    const rectangle<fixed16_16> _i = _a.intersect(_a, _b);
+    TEST_ASSERT_TRUE(_a.intersects(_b));
+    TEST_ASSERT_FLOAT_WITHIN(ulp16, 1.0, double(_i.width));
+    TEST_ASSERT_FLOAT_WITHIN(ulp16, 2.0, double(_i.center().x));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_fixed_arithmetic);
+    RUN_TEST(test_fixed_overflow_and_rounding);
+    RUN_TEST(test_fixed_sqrt_sin_cos);
+    RUN_TEST(test_fixed_numeric_limits);
+    RUN_TEST(test_fixed_math_types);
+    return UNITY_END();
+}
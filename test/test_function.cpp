@@ -0,0 +1,79 @@
+#include <unity.h>
+#include "utfunction.h"
+
+static int live;
+
+struct counted {
+    int value;
+    explicit counted(int v) : value(v) { ++live; }
+    counted(const counted& o) : value(o.value) { ++live; }
+    counted(counted&& o) : value(o.value) { o.value = -1; ++live; }
+    ~counted() { --live; }
+    int operator()(int x) const { return value + x; }
+};
+
+static int twice(int x) { return 2 * x; }
+
+void test_function_copies_non_trivial_callables() {
+    live = 0;
+    {
+        utb::function<int(int)> _f = counted(10);
+        TEST_ASSERT_EQUAL(1, live);
+
+        utb::function<int(int)> _g = _f;             // a real copy, not the bytes
+        TEST_ASSERT_EQUAL(2, live);
+        TEST_ASSERT_EQUAL(11, _g(1));
+
+        utb::function<int(int)> _h = utb::move(_f);  // the source is empty afterwards
+        TEST_ASSERT_FALSE(_f);
+        TEST_ASSERT_EQUAL(2, live);
+        TEST_ASSERT_EQUAL(12, _h(2));
+
+        _g = _g;
+        TEST_ASSERT_EQUAL(11, _g(1));
+        _g = _h;
+        TEST_ASSERT_EQUAL(2, live);
+
+        _h.reset();
+        TEST_ASSERT_EQUAL(1, live);
+        TEST_ASSERT_TRUE(_h == nullptr);
+    }
+    TEST_ASSERT_EQUAL(0, live);
+}
+
+void test_function_trivial_callables() {
+    int _base = 5;
+    utb::function<int(int)> _f = [&_base](int x) { return _base * x; };
+    utb::function<int(int)> _p = &twice;
+    utb::function<int(int)> _copy = _f;
+
+    _base = 7;
+    TEST_ASSERT_EQUAL(21, _copy(3));
+    TEST_ASSERT_EQUAL(8, _p(4));
+}
+
+static int apply(utb::function_ref<int(int)> fn, int x) { return fn(x); }
+
+void test_function_ref() {
+    counted _c(100);
+    int _offset = 3;
+    auto _lambda = [&_offset](int x) { return x + _offset; };
+
+    TEST_ASSERT_EQUAL(101, apply(_c, 1));
+    TEST_ASSERT_EQUAL(13, apply(_lambda, 10));
+    TEST_ASSERT_EQUAL(20, apply(twice, 10));
+    TEST_ASSERT_EQUAL(9, apply([](int x) { return x * x; }, 3));
+
+    utb::function_ref<int(int)> _ref = _lambda;
+    _offset = 4;
+    TEST_ASSERT_EQUAL(5, _ref(1));                    // refers, does not copy
+    TEST_ASSERT_EQUAL(2 * sizeof(void*), sizeof(_ref));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_function_copies_non_trivial_callables);
+    RUN_TEST(test_function_trivial_callables);
+    RUN_TEST(test_function_ref);
+    return UNITY_END();
+}
@@ -0,0 +1,96 @@
+#include <unity.h>
+#include "uthash.h"
+#include "uthash_table.h"
+
+using namespace utb;
+
+static const char* quick = "The quick brown fox jumps over the lazy dog, again and again and again.";
+
+void test_hash_reference_vectors() {
+    TEST_ASSERT_EQUAL_HEX32(0xe40c292cU, hash_bytes<hash_algorithm::fnv1a32>("a", 1, 0));
+    TEST_ASSERT_EQUAL_HEX32(0x248bfa47U, hash_bytes<hash_algorithm::murmur3_32>("hello", 5, 0));
+    TEST_ASSERT_EQUAL_HEX32(0x248bfa47U, internal::mmh3_x86("hello", 5, 0));
+
+    const hash128 _h = hash_bytes<hash_algorithm::murmur3_128>("hello", 5, 0);
+    TEST_ASSERT_TRUE(_h.low == 0xcbd8a7b341bd9b02ULL);
+    TEST_ASSERT_TRUE(_h.high == 0x5b1e906a48ae1d19ULL);
+
+    TEST_ASSERT_TRUE(hash_bytes<hash_algorithm::xxh64>("", 0, 0) == 0xEF46DB3751D8E999ULL);
+    TEST_ASSERT_TRUE(hash_bytes<hash_algorithm::xxh64>("a", 1, 0) == 0xD24EC4F1A98C6E5BULL);
+}
+
+template <class TAlgorithm>
+static void check_stream_matches_oneshot() {
+    const utb::size_t _len = strlen(quick);
+    const typename TAlgorithm::result_type _expected = hash_bytes<TAlgorithm>(quick, _len, 7);
+
+    for (utb::size_t chunk = 1; chunk <= 40; chunk += 3) {
+        basic_hash_stream<TAlgorithm> _stream(7);
+        for (utb::size_t i = 0; i < _len; i += chunk)
+            _stream.update(quick + i, min(chunk, _len - i));
+
+        TEST_ASSERT_TRUE(uint64_t(_stream.finalize()) == uint64_t(_expected));
+    }
+}
+
+void test_hash_stream_matches_oneshot() {
+    check_stream_matches_oneshot<hash_algorithm::fnv1a32>();
+    check_stream_matches_oneshot<hash_algorithm::murmur3_32>();
+    check_stream_matches_oneshot<hash_algorithm::murmur3_128>();
+    check_stream_matches_oneshot<hash_algorithm::xxh64>();
+}
+
+void test_hash_integer_mixers_spread_low_bits() {
+    // sequential keys must fill all 16 buckets of the low four bits evenly
+    unsigned _buckets[16] = { 0 };
+    for (uint32_t i = 0; i < 1600; ++i) ++_buckets[hash<uint32_t>()(i << 4) & 15];
+
+    for (int b = 0; b < 16; ++b) TEST_ASSERT_UINT32_WITHIN(40, 100, _buckets[b]);
+
+    TEST_ASSERT_NOT_EQUAL(hash<int*>()(reinterpret_cast<int*>(0x1000)), hash<int*>()(reinterpret_cast<int*>(0x1008)));
+}
+
+void test_hash_string_table() {
+    basic_hash_table<const char*, int, 16, string_hash_function<hash_algorithm::fnv1a32>, utb::equal_to<const char*> > _table;
+    static const char* keys[] = { "temp", "humidity", "pressure", "lux", "co2" };
+
+    for (int i = 0; i < 5; ++i) _table.insert(keys[i], i);
+    for (int i = 0; i < 5; ++i) TEST_ASSERT_EQUAL(1, _table.count(keys[i]));
+    TEST_ASSERT_EQUAL(5, _table.size());
+
+    TEST_ASSERT_TRUE(hash<const char*>()("abc") == hash<char*>()(const_cast<char*>("abc")));
+}
+
+void test_hash_reduce_in_range() {
+    static const utb::size_t sizes[] = { 1, 7, 16, 100, 128, 1000 };
+
+    for (utb::size_t n : sizes) {
+        unsigned _used = 0;
+        bool _seen[1000] = { false };
+
+        for (uint32_t i = 0; i < 4000; ++i) {
+            const hash_type _h = hash<uint32_t>()(i);
+            const hash_type _auto = hash_function<uint32_t>()(i, n);
+
+            TEST_ASSERT_TRUE(hash_reduce::modulo::reduce(_h, n) < n);
+            TEST_ASSERT_TRUE(hash_reduce::fastrange::reduce(_h, n) < n);
+            TEST_ASSERT_TRUE(_auto < n);
+            if (!_seen[_auto]) { _seen[_auto] = true; ++_used; }
+        }
+        // 4000 mixed keys reach nearly every bucket
+        TEST_ASSERT_TRUE(_used * 100 >= n * 95);
+    }
+    TEST_ASSERT_EQUAL(hash_reduce::mask::reduce(0x1234, 16), hash_reduce::automatic::reduce(0x1234, 16));
+    TEST_ASSERT_EQUAL(0, hash_reduce::fastrange::reduce(0, 100));
+    TEST_ASSERT_EQUAL(99, hash_reduce::fastrange::reduce(hash_type(sizeof(hash_type) <= 2 ? 0xFFFFU : 0xFFFFFFFFU), 100));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_hash_reference_vectors);
+    RUN_TEST(test_hash_stream_matches_oneshot);
+    RUN_TEST(test_hash_integer_mixers_spread_low_bits);
+    RUN_TEST(test_hash_string_table);
+    RUN_TEST(test_hash_reduce_in_range);
+    return UNITY_END();
+}
@@ -0,0 +1,113 @@
+#include <unity.h>
+#include <math.h>
+#include "uthistory.h"
+
+static uint32_t g_seed = 12345;
+
+static uint32_t next_random() {
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return g_seed >> 8;
+}
+
+/// Pushes random samples low + k * step, k < range, and compares every window statistic against a brute-force scan.
+template <class THistory, class T>
+static void check_window(THistory& h, utb::size_t window, T low, uint32_t range, T step, double ema_tolerance) {
+    const utb::size_t count = 40 * window + 3;
+    T _samples[40 * 16 + 3];
+
+    const uint8_t _shift = 3;
+    const double _alpha = 1.0 / double(1 << _shift);
+    double _ema = 0;
+    h.set_ema_shift(_shift);
+
+    for (utb::size_t n = 0; n < count; ++n) {
+        _samples[n] = T(low + T(next_random() % range) * step);
+        h.push(_samples[n]);
+        _ema = (n == 0) ? double(_samples[n]) : _ema + _alpha * (double(_samples[n]) - _ema);
+
+        const utb::size_t _size = (n + 1 < window) ? n + 1 : window;
+        const T* _first = _samples + n + 1 - _size;
+
+        double _sum = 0;
+        T _min = _first[0], _max = _first[0];
+        for (utb::size_t i = 0; i < _size; ++i) {
+            _sum += double(_first[i]);
+            if (_first[i] < _min) _min = _first[i];
+            if (_max < _first[i]) _max = _first[i];
+        }
+        const double _mean = _sum / double(_size);
+        double _var = 0;
+        for (utb::size_t i = 0; i < _size; ++i) _var += (double(_first[i]) - _mean) * (double(_first[i]) - _mean);
+        _var /= double(_size);
+
+        TEST_ASSERT_EQUAL_UINT(_size, h.size());
+        TEST_ASSERT_TRUE(_samples[n] == h.current());
+        TEST_ASSERT_TRUE(_first[0] == h.oldest());
+        for (utb::size_t i = 0; i < _size; ++i) TEST_ASSERT_TRUE(_samples[n - i] == h[i]);
+
+        TEST_ASSERT_TRUE(_min == h.min());
+        TEST_ASSERT_TRUE(_max == h.max());
+        TEST_ASSERT_FLOAT_WITHIN(1e-3 * (fabs(_sum) + 1.0), _sum, double(h.sum()));
+        TEST_ASSERT_FLOAT_WITHIN(1e-3 * (_var + 1.0), _var, double(h.variance()));
+        TEST_ASSERT_FLOAT_WITHIN(ema_tolerance, _ema, double(h.ema()));
+    }
+}
+
+void test_history_integral_window() {
+    utb::history<int16_t, 7, true, true> _h7;
+    check_window(_h7, 7, int16_t(-1000), 2000, int16_t(1), 2.0);
+
+    utb::history<uint8_t, 16, true, true> _h16;
+    check_window(_h16, 16, uint8_t(0), 256, uint8_t(1), 2.0);
+
+    // average() truncates like the integer division of the sum
+    utb::history<int32_t, 4, true, true> _h4;
+    check_window(_h4, 4, int32_t(0), 100000, int32_t(1), 2.0);
+    TEST_ASSERT_EQUAL_INT(int32_t(_h4.sum() / 4), _h4.average());
+
+    _h4.clear();
+    TEST_ASSERT_TRUE(_h4.empty());
+    TEST_ASSERT_EQUAL_INT(0, _h4.sum());
+    check_window(_h4, 4, int32_t(-50), 100, int32_t(1), 2.0);
+}
+
+void test_history_float_window() {
+    utb::history<float, 7, true, true> _h7;
+    check_window(_h7, 7, -50.0f, 1000, 0.1f, 1e-3);
+
+    utb::history<double, 16, true, true> _h16;
+    check_window(_h16, 16, 0.0, 10000, 0.01, 1e-6);
+}
+
+void test_history_float_variance_large_offset() {
+    // 1000 + U(0, 1): E[x^2] - mean^2 of the raw floats cancels completely
+    const utb::size_t window = 64;
+    utb::history<float, window, true, true> _h;
+    float _last[window];
+    double _worst = 0;
+
+    for (utb::size_t n = 0; n < 100000; ++n) {
+        const float _x = 1000.0f + float(next_random() % 65536) / 65536.0f;
+        _h.push(_x);
+        _last[n % window] = _x;
+        if (n + 1 < window || n % 97 != 0) continue;
+
+        double _mean = 0, _var = 0;
+        for (utb::size_t i = 0; i < window; ++i) _mean += _last[i];
+        _mean /= double(window);
+        for (utb::size_t i = 0; i < window; ++i) _var += (_last[i] - _mean) * (_last[i] - _mean);
+        _var /= double(window);
+
+        const double _err = fabs(_var - double(_h.variance())) / _var;
+        if (_err > _worst) _worst = _err;
+    }
+    TEST_ASSERT_FLOAT_WITHIN(1e-2, 0.0, _worst);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_history_integral_window);
+    RUN_TEST(test_history_float_window);
+    RUN_TEST(test_history_float_variance_large_offset);
+    return UNITY_END();
+}
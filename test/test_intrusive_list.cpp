@@ -0,0 +1,153 @@
+#include <unity.h>
+#include "utintrusive_list.h"
+#include "utnode.h"
+
+struct job : utb::intrusive_list_hook {
+    int id;
+    explicit job(int i) : id(i) { }
+};
+
+struct timer {
+    uint32_t due;
+    utb::intrusive_list_hook pending;
+    utb::intrusive_list_hook all;
+    explicit timer(uint32_t d) : due(d) { }
+};
+
+// not standard-layout: the member hook sits behind a vtable pointer and a base
+struct sensor_base { virtual ~sensor_base() { } char kind = 's'; };
+struct sensor : sensor_base {
+    double value;
+    utb::intrusive_list_hook hook;
+    explicit sensor(double v) : value(v) { }
+};
+
+using job_list = utb::intrusive_list<job>;
+using pending_list = utb::intrusive_list<timer, &timer::pending>;
+using all_list = utb::intrusive_list<timer, &timer::all>;
+using sensor_list = utb::intrusive_list<sensor, &sensor::hook>;
+
+static int ids(job_list& list, int* out) {
+    int n = 0;
+    for (job& j : list) out[n++] = j.id;
+    return n;
+}
+
+void test_intrusive_list_push_pop() {
+    job _a(1), _b(2), _c(3);
+    job_list _list;
+
+    _list.push_back(_b);
+    _list.push_front(_a);
+    _list.push_back(_c);
+    TEST_ASSERT_EQUAL(3, _list.size());
+    TEST_ASSERT_EQUAL(1, _list.front().id);
+    TEST_ASSERT_EQUAL(3, _list.back().id);
+
+    int _out[3];
+    TEST_ASSERT_EQUAL(3, ids(_list, _out));
+    TEST_ASSERT_EQUAL(2, _out[1]);
+
+    _list.erase(_b);
+    TEST_ASSERT_FALSE(_b.is_linked());
+    TEST_ASSERT_EQUAL(2, _list.size());
+
+    _list.pop_front();
+    _list.pop_back();
+    TEST_ASSERT_TRUE(_list.empty());
+    TEST_ASSERT_TRUE(_list.begin() == _list.end());
+}
+
+void test_intrusive_list_member_hooks() {
+    timer _t[4] = { timer(40), timer(10), timer(30), timer(20) };
+    pending_list _pending;
+    all_list _all;
+
+    for (timer& t : _t) _all.push_back(t);
+    _pending.push_back(_t[1]);
+    _pending.push_back(_t[3]);
+
+    TEST_ASSERT_EQUAL(4, _all.size());
+    TEST_ASSERT_EQUAL(10u, _pending.front().due);
+    TEST_ASSERT_EQUAL(20u, _pending.back().due);
+    TEST_ASSERT_TRUE(&*pending_list::iterator_to(_t[3]) == &_t[3]);
+
+    _pending.clear();
+    _all.clear();
+
+    sensor _a(1.5), _b(2.5);
+    sensor_list _sensors;
+    _sensors.push_back(_a);
+    _sensors.push_back(_b);
+    TEST_ASSERT_TRUE(&_sensors.front() == &_a);
+    TEST_ASSERT_TRUE(&_sensors.back() == &_b);
+    TEST_ASSERT_EQUAL('s', _sensors.back().kind);
+    _sensors.clear();
+}
+
+void test_intrusive_list_splice() {
+    job _j[6] = { job(0), job(1), job(2), job(3), job(4), job(5) };
+    job_list _a, _b;
+
+    for (int i = 0; i < 3; ++i) _a.push_back(_j[i]);
+    for (int i = 3; i < 6; ++i) _b.push_back(_j[i]);
+
+    _a.splice(++_a.begin(), _b);
+    TEST_ASSERT_TRUE(_b.empty());
+    TEST_ASSERT_EQUAL(6, _a.size());
+
+    int _out[6];
+    ids(_a, _out);
+    const int _expected[6] = { 0, 3, 4, 5, 1, 2 };
+    for (int i = 0; i < 6; ++i) TEST_ASSERT_EQUAL(_expected[i], _out[i]);
+
+    _b.splice(_b.end(), _a, job_list::iterator_to(_j[4]));
+    TEST_ASSERT_EQUAL(5, _a.size());
+    TEST_ASSERT_EQUAL(4, _b.front().id);
+
+    int _reverse = 0;
+    for (job_list::iterator it = --_a.end(); it != _a.end(); --it) ++_reverse;
+    TEST_ASSERT_EQUAL(5, _reverse);
+
+    // moving an element before itself or before its successor changes nothing
+    _a.splice(_a.begin(), _a, _a.begin());
+    _a.splice(++_a.begin(), _a, _a.begin());
+    _a.splice(_a.end(), _a, --_a.end());
+    ids(_a, _out);
+    const int _unchanged[5] = { 0, 3, 5, 1, 2 };
+    for (int i = 0; i < 5; ++i) TEST_ASSERT_EQUAL(_unchanged[i], _out[i]);
+    TEST_ASSERT_EQUAL(5, _a.size());
+
+    // within the list: the front to the back
+    _a.splice(_a.end(), _a, _a.begin());
+    ids(_a, _out);
+    const int _rotated[5] = { 3, 5, 1, 2, 0 };
+    for (int i = 0; i < 5; ++i) TEST_ASSERT_EQUAL(_rotated[i], _out[i]);
+    TEST_ASSERT_EQUAL(5, _a.size());
+
+    _a.clear();
+    _b.clear();
+}
+
+void test_node_root_last_iterative() {
+    // a long chain, walked without recursion
+    alignas(utb::node<int>) static unsigned char _raw[10000 * sizeof(utb::node<int>)];
+    utb::node<int>* _nodes = reinterpret_cast<utb::node<int>*>(_raw);
+
+    for (int i = 0; i < 10000; ++i) {
+        new (&_nodes[i]) utb::node<int>(i);
+        _nodes[i].Prev = i > 0 ? &_nodes[i - 1] : 0;
+        _nodes[i].Next = i < 9999 ? &_nodes[i + 1] : 0;
+    }
+    TEST_ASSERT_TRUE(_nodes[5000].root() == &_nodes[0]);
+    TEST_ASSERT_TRUE(_nodes[5000].last() == &_nodes[9999]);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_intrusive_list_push_pop);
+    RUN_TEST(test_intrusive_list_member_hooks);
+    RUN_TEST(test_intrusive_list_splice);
+    RUN_TEST(test_node_root_last_iterative);
+    return UNITY_END();
+}
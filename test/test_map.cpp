@@ -0,0 +1,109 @@
+#include <unity.h>
+#include "utmap.h"
+#include "utvector.h"
+
+void test_map_insert_find() {
+    utb::light_map<int, int, 32> m;
+
+    for (int i = 0; i < 32; ++i)
+        TEST_ASSERT_TRUE(m.insert(i * 7, i));
+
+    TEST_ASSERT_FALSE(m.insert(1000, 1));   // full
+    TEST_ASSERT_FALSE(m.insert(7, 99));     // duplicate
+
+    for (int i = 0; i < 32; ++i) {
+        TEST_ASSERT_NOT_NULL(m.find(i * 7));
+        TEST_ASSERT_EQUAL_INT(i, *m.find(i * 7));
+    }
+    TEST_ASSERT_NULL(m.find(3));
+}
+
+void test_map_erase_keeps_chains() {
+    utb::light_map<int, int, 16> m;
+
+    for (int i = 0; i < 16; ++i) m.insert(i * 16, i);
+    for (int i = 0; i < 16; i += 2) TEST_ASSERT_EQUAL_UINT(1, m.erase(i * 16));
+
+    TEST_ASSERT_EQUAL_UINT(8, m.size());
+    for (int i = 1; i < 16; i += 2) TEST_ASSERT_EQUAL_INT(i, *m.find(i * 16));
+    for (int i = 0; i < 16; i += 2) TEST_ASSERT_NULL(m.find(i * 16));
+}
+
+/// Home slot = key % capacity, so the tests can place chains and wraps by hand.
+struct slot_hash {
+    utb::size_t operator()(int key, utb::size_t capacity) const { return utb::size_t(key) % capacity; }
+};
+using slot_map = utb::light_map<int, int, 8, utb::basic_hash_table<int, int, 8, slot_hash> >;
+
+void test_map_erase_iterator() {
+    slot_map m;
+
+    // 3, 11, 19 share home 3; 4 is pushed behind them
+    m.insert(3, 0); m.insert(11, 1); m.insert(19, 2); m.insert(4, 3);
+
+    // the follower is shifted into the erased slot and returned
+    slot_map::iterator _it = m.erase(m.find(3));
+    TEST_ASSERT_EQUAL_PTR(m.find(11), _it);
+    TEST_ASSERT_EQUAL_UINT(3, m.size());
+
+    _it = m.erase(m.find(4));
+    TEST_ASSERT_NULL(_it);
+    TEST_ASSERT_NULL(m.erase(m.find(4)));
+    TEST_ASSERT_EQUAL_INT(2, *m.find(19));
+}
+
+void test_map_erase_range() {
+    slot_map m;
+
+    // 6, 14, 22, 30 share home 6 and wrap into slots 0 and 1, which pushes 1 to slot 2
+    m.insert(6, 0); m.insert(14, 1); m.insert(22, 2); m.insert(30, 3);
+    m.insert(1, 4); m.insert(3, 5);
+
+    // slots 6 and 7 hold 6 and 14, the wrapped 22 and 30 must move in and survive
+    slot_map::const_iterator _base = m.find(6);
+    slot_map::iterator _it = m.erase(_base, _base + 2);
+    TEST_ASSERT_EQUAL_UINT(4, m.size());
+    TEST_ASSERT_NULL(m.find(6));
+    TEST_ASSERT_NULL(m.find(14));
+    TEST_ASSERT_EQUAL_INT(2, *m.find(22));
+    TEST_ASSERT_EQUAL_INT(3, *m.find(30));
+    TEST_ASSERT_EQUAL_INT(4, *m.find(1));
+    TEST_ASSERT_EQUAL_INT(5, *m.find(3));
+    TEST_ASSERT_EQUAL_PTR(m.find(22), _it);
+
+    // the whole table
+    const int* _first = m.find(1) - 1;
+    TEST_ASSERT_NULL(m.erase(_first, _first + 8));
+    TEST_ASSERT_TRUE(m.empty());
+}
+
+void test_map_insert_moves() {
+    utb::light_map<int, utb::vector<int, 4>, 8> m;
+    utb::vector<int, 4> _v;
+    _v.push_back(7);
+
+    TEST_ASSERT_TRUE(m.insert(1, utb::move(_v)));
+    TEST_ASSERT_EQUAL_INT(7, (*m.find(1))[0]);
+    TEST_ASSERT_FALSE(m.insert(1, utb::vector<int, 4>()));
+    TEST_ASSERT_EQUAL_UINT(1, m.find(1)->size());
+}
+
+void test_map_assign() {
+    utb::light_map<int, int, 8> m;
+
+    TEST_ASSERT_FALSE(m.assign(1, 5).second());
+    m.insert_or_assign(1, 5);
+    TEST_ASSERT_TRUE(m.assign(1, 6).second());
+    TEST_ASSERT_EQUAL_INT(6, *m[1]);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_map_insert_find);
+    RUN_TEST(test_map_erase_keeps_chains);
+    RUN_TEST(test_map_erase_iterator);
+    RUN_TEST(test_map_erase_range);
+    RUN_TEST(test_map_insert_moves);
+    RUN_TEST(test_map_assign);
+    return UNITY_END();
+}
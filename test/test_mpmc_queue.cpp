@@ -0,0 +1,86 @@
+#include <unity.h>
+#include <thread>
+#include <atomic>
+#include "utmpmc_queue.h"
+
+static const uint32_t producers = 4;
+static const uint32_t consumers = 4;
+static const uint32_t per_producer = 100000;
+
+static utb::mpmc_queue<uint32_t, 64> g_queue;
+static std::atomic<uint8_t> g_seen[producers * per_producer];
+
+void test_mpmc_single_thread() {
+    utb::mpmc_queue<int, 4> q;
+    int v = 0;
+
+    TEST_ASSERT_FALSE(q.try_pop(v));
+    TEST_ASSERT_TRUE(q.empty_approx());
+
+    // several turns over the slots: the sequence numbers must keep up with the positions
+    for (int turn = 0; turn < 3; ++turn) {
+        for (int i = 0; i < 4; ++i) TEST_ASSERT_TRUE(q.try_push(turn * 10 + i));
+        TEST_ASSERT_FALSE(q.try_push(99));
+        TEST_ASSERT_EQUAL_UINT(4, q.size_approx());
+
+        TEST_ASSERT_TRUE(q.try_pop(v));
+        TEST_ASSERT_EQUAL_INT(turn * 10, v);
+        TEST_ASSERT_TRUE(q.try_push(turn * 10 + 4));
+        TEST_ASSERT_FALSE(q.try_push(99));
+
+        for (int i = 1; i <= 4; ++i) {
+            TEST_ASSERT_TRUE(q.try_pop(v));
+            TEST_ASSERT_EQUAL_INT(turn * 10 + i, v);
+        }
+        TEST_ASSERT_FALSE(q.try_pop(v));
+        TEST_ASSERT_EQUAL_UINT(0, q.size_approx());
+    }
+}
+
+void test_mpmc_stress() {
+    std::atomic<uint32_t> _popped(0), _errors(0);
+    std::thread _threads[producers + consumers];
+
+    for (uint32_t p = 0; p < producers; ++p) {
+        _threads[p] = std::thread([p]() {
+            for (uint32_t i = 0; i < per_producer; ++i) {
+                while (!g_queue.try_push(p * per_producer + i)) std::this_thread::yield();
+            }
+        });
+    }
+    for (uint32_t c = 0; c < consumers; ++c) {
+        _threads[producers + c] = std::thread([&_popped, &_errors]() {
+            // a single consumer sees the items of one producer in push order
+            uint32_t _last[producers];
+            for (uint32_t p = 0; p < producers; ++p) _last[p] = 0;
+
+            uint32_t v;
+            while (_popped.load() < producers * per_producer) {
+                if (!g_queue.try_pop(v)) { std::this_thread::yield(); continue; }
+                _popped.fetch_add(1);
+
+                const uint32_t _p = v / per_producer, _i = v % per_producer + 1;
+                if (_p >= producers || _i <= _last[_p]) { _errors.fetch_add(1); continue; }
+                _last[_p] = _i;
+                g_seen[v].fetch_add(1);
+            }
+        });
+    }
+    for (uint32_t t = 0; t < producers + consumers; ++t) _threads[t].join();
+
+    TEST_ASSERT_EQUAL_UINT(0, _errors.load());
+    TEST_ASSERT_EQUAL_UINT(producers * per_producer, _popped.load());
+
+    uint32_t _missing = 0;
+    for (uint32_t i = 0; i < producers * per_producer; ++i)
+        if (g_seen[i].load() != 1) ++_missing;
+    TEST_ASSERT_EQUAL_UINT(0, _missing);
+    TEST_ASSERT_TRUE(g_queue.empty_approx());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_mpmc_single_thread);
+    RUN_TEST(test_mpmc_stress);
+    return UNITY_END();
+}
@@ -0,0 +1,66 @@
+#include <unity.h>
+#include "utperfect_hash.h"
+
+using namespace utb::literals;
+
+enum class command : uint8_t { led, reset, status, read, write, erase, baud, help, ping, echo, time, date,
+                               temp, hum, press, mode, gain, offset, start, stop, pause, resume, dump, save };
+
+static constexpr utb::perfect_hash_entry<command> commands[] = {
+    { "led", command::led },       { "reset", command::reset },   { "status", command::status },
+    { "read", command::read },     { "write", command::write },   { "erase", command::erase },
+    { "baud", command::baud },     { "help", command::help },     { "ping", command::ping },
+    { "echo", command::echo },     { "time", command::time },     { "date", command::date },
+    { "temp", command::temp },     { "hum", command::hum },       { "press", command::press },
+    { "mode", command::mode },     { "gain", command::gain },     { "offset", command::offset },
+    { "start", command::start },   { "stop", command::stop },     { "pause", command::pause },
+    { "resume", command::resume }, { "dump", command::dump },     { "save", command::save },
+};
+
+static constexpr auto table = utb::make_perfect_hash(commands);
+static_assert(table.valid(), "no perfect hash for the command set");
+static_assert(*table.find("stop") == command::stop, "compile-time lookup");
+static_assert(table.find("stopp") == nullptr, "compile-time miss");
+
+void test_perfect_hash_literal_matches_runtime() {
+    TEST_ASSERT_EQUAL_HEX32(utb::hash_bytes<utb::hash_algorithm::fnv1a32>("reset", 5, 0), "reset"_hash);
+    TEST_ASSERT_EQUAL_HEX32(utb::hash_literal("reset"), "reset"_hash);
+    TEST_ASSERT_EQUAL_HEX32(utb::hash_literal("reset;", 5, 0), "reset"_hash);
+
+    static_assert("led"_hash != "reset"_hash, "literal hashes usable as case labels");
+}
+
+void test_perfect_hash_finds_every_key() {
+    for (utb::size_t i = 0; i < table.size(); ++i) {
+        const command* _c = table.find(commands[i].key);
+        TEST_ASSERT_NOT_NULL(_c);
+        TEST_ASSERT_TRUE(*_c == commands[i].value);
+        TEST_ASSERT_EQUAL(i, table.index_of(commands[i].key));
+    }
+}
+
+void test_perfect_hash_rejects_unknown_keys() {
+    static const char* unknown[] = { "", "le", "leds", "RESET", "sav", "saved", "x", "pingpong" };
+    for (const char* key : unknown) TEST_ASSERT_NULL(table.find(key));
+
+    // tokens out of a line buffer, not zero terminated
+    const char* line = "baud 115200";
+    TEST_ASSERT_TRUE(*table.find(line, 4) == command::baud);
+    TEST_ASSERT_NULL(table.find(line, 3));
+    TEST_ASSERT_NULL(table.find(line, 5));
+}
+
+void test_perfect_hash_detects_duplicates() {
+    static constexpr utb::perfect_hash_entry<int> dup[] = { { "a", 1 }, { "b", 2 }, { "a", 3 } };
+    constexpr auto _table = utb::make_perfect_hash(dup);
+    TEST_ASSERT_FALSE(_table.valid());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_perfect_hash_literal_matches_runtime);
+    RUN_TEST(test_perfect_hash_finds_every_key);
+    RUN_TEST(test_perfect_hash_rejects_unknown_keys);
+    RUN_TEST(test_perfect_hash_detects_duplicates);
+    return UNITY_END();
+}
@@ -0,0 +1,188 @@
+#include <unity.h>
+#include <thread>
+#include "utpool.h"
+#include "utnode.h"
+#include "utshared_ptr.h"
+
+struct tracked {
+    static int alive;
+    int value;
+
+    explicit tracked(int v) : value(v) { ++alive; }
+    ~tracked() { --alive; }
+};
+int tracked::alive = 0;
+
+void test_pool_allocate_until_full() {
+    static utb::pool<uint32_t, 8> _pool;
+    void* _blocks[8];
+
+    for (int i = 0; i < 8; ++i) {
+        _blocks[i] = _pool.allocate();
+        TEST_ASSERT_NOT_NULL(_blocks[i]);
+        TEST_ASSERT_TRUE(_pool.owns(_blocks[i]));
+    }
+    TEST_ASSERT_TRUE(_pool.full());
+    TEST_ASSERT_NULL(_pool.allocate());
+
+    _pool.deallocate(_blocks[3]);
+    _pool.deallocate(_blocks[5]);
+    TEST_ASSERT_EQUAL(6, _pool.size());
+    TEST_ASSERT_EQUAL(8, _pool.high_watermark());
+
+    // freed blocks come back last in, first out
+    TEST_ASSERT_TRUE(_pool.allocate() == _blocks[5]);
+    TEST_ASSERT_TRUE(_pool.allocate() == _blocks[3]);
+
+    uint32_t _outside;
+    TEST_ASSERT_FALSE(_pool.owns(&_outside));
+    TEST_ASSERT_FALSE(_pool.owns(static_cast<char*>(_blocks[0]) + 1));
+}
+
+void test_pool_create_destroy() {
+    utb::pool<tracked, 4> _pool;
+
+    tracked* _a = _pool.create(1);
+    tracked* _b = _pool.create(2);
+    TEST_ASSERT_EQUAL(2, tracked::alive);
+    TEST_ASSERT_EQUAL(2, _b->value);
+
+    _pool.destroy(_a);
+    _pool.destroy(_b);
+    TEST_ASSERT_EQUAL(0, tracked::alive);
+    TEST_ASSERT_TRUE(_pool.empty());
+    TEST_ASSERT_EQUAL(2, _pool.high_watermark());
+}
+
+void test_pool_nodes_and_shared_ptr() {
+    utb::pool<utb::node<int>, 4> _nodes;
+    utb::node<int>* _head = utb::node<int>::create(_nodes, 1);
+    utb::node<int>* _second = utb::node<int>::create(_nodes, 2);
+
+    _second->insert(_head);
+    TEST_ASSERT_EQUAL(2, _nodes.size());
+    _second->destroy(_nodes);
+    TEST_ASSERT_TRUE(_head->Next == _head);
+    _head->destroy(_nodes);
+    TEST_ASSERT_TRUE(_nodes.empty());
+
+    utb::pool<utb::shared_block<tracked>, 2> _objects;
+    {
+        auto _p = utb::make_pooled<tracked>(_objects, 42);
+        TEST_ASSERT_EQUAL(42, _p->value);
+        TEST_ASSERT_EQUAL(1, _objects.size());
+    }
+    TEST_ASSERT_EQUAL(0, tracked::alive);
+    TEST_ASSERT_TRUE(_objects.empty());
+}
+
+void test_pooled_shared_ptr_copy_and_assign() {
+    utb::pool<utb::shared_block<tracked>, 2> _objects;
+    {
+        auto _a = utb::make_pooled<tracked>(_objects, 7);
+        {
+            auto _b = _a;
+            TEST_ASSERT_EQUAL(2, _a.use_count());
+            TEST_ASSERT_TRUE(_b.get() == _a.get());
+        }
+        TEST_ASSERT_EQUAL(1, _a.use_count());
+        TEST_ASSERT_EQUAL(1, tracked::alive);
+        TEST_ASSERT_EQUAL(1, _objects.size());
+
+        auto _c = utb::make_pooled<tracked>(_objects, 8);
+        TEST_ASSERT_TRUE(_objects.full());
+        TEST_ASSERT_FALSE(bool(utb::make_pooled<tracked>(_objects, 9)));
+
+        // the old object of _c goes back to the pool, _a and _c share the first one
+        _c = _a;
+        TEST_ASSERT_EQUAL(1, _objects.size());
+        TEST_ASSERT_EQUAL(2, _c.use_count());
+        TEST_ASSERT_EQUAL(7, _c->value);
+
+        _a = _a;
+        TEST_ASSERT_EQUAL(2, _a.use_count());
+
+        auto _d = utb::move(_c);
+        TEST_ASSERT_EQUAL(0, _c.use_count());
+        TEST_ASSERT_EQUAL(2, _d.use_count());
+        _a.reset();
+        TEST_ASSERT_EQUAL(1, _d.use_count());
+        TEST_ASSERT_EQUAL(1, tracked::alive);
+    }
+    TEST_ASSERT_EQUAL(0, tracked::alive);
+    TEST_ASSERT_TRUE(_objects.empty());
+
+    // heap objects share one counter as well
+    {
+        utb::basic_shared_ptr<tracked, utb::size_t> _h(new tracked(1));
+        utb::basic_shared_ptr<tracked, utb::size_t> _g = _h;
+        TEST_ASSERT_EQUAL(2, _g.use_count());
+    }
+    TEST_ASSERT_EQUAL(0, tracked::alive);
+}
+
+void test_pooled_shared_ptr_reset() {
+    utb::pool<utb::shared_block<tracked>, 2> _objects;
+    {
+        auto _a = utb::make_pooled<tracked>(_objects, 1);
+        auto _b = _a;
+        TEST_ASSERT_EQUAL(1, _objects.size());
+
+        // the block stays with _b, the heap object gets its own counter
+        _a.reset(new tracked(2));
+        TEST_ASSERT_EQUAL(1, _objects.size());
+        TEST_ASSERT_EQUAL(1, _a.use_count());
+        TEST_ASSERT_EQUAL(1, _b.use_count());
+        TEST_ASSERT_EQUAL(2, _a->value);
+
+        _b.reset(new tracked(3));
+        TEST_ASSERT_EQUAL(0, _objects.size());
+        TEST_ASSERT_EQUAL(2, tracked::alive);
+
+        _a.reset();
+        TEST_ASSERT_EQUAL(1, tracked::alive);
+    }
+    TEST_ASSERT_EQUAL(0, tracked::alive);
+    TEST_ASSERT_EQUAL(0, _objects.size());
+    TEST_ASSERT_EQUAL(2, _objects.available());
+}
+
+void test_atomic_pool_threads() {
+    static utb::atomic_pool<uint64_t, 64> _pool;
+    static volatile int _errors = 0;
+
+    auto _worker = [](uint64_t id) {
+        for (int round = 0; round < 20000; ++round) {
+            uint64_t* _p = static_cast<uint64_t*>(_pool.allocate());
+            if (_p == nullptr) continue;
+
+            *_p = id;
+            for (int spin = 0; spin < 4; ++spin) if (*_p != id) _errors = _errors + 1;
+            _pool.deallocate(_p);
+        }
+    };
+
+    std::thread _threads[4] = { std::thread(_worker, 1), std::thread(_worker, 2),
+                                std::thread(_worker, 3), std::thread(_worker, 4) };
+    for (std::thread& t : _threads) t.join();
+
+    TEST_ASSERT_EQUAL(0, _errors);
+    TEST_ASSERT_TRUE(_pool.empty());
+    TEST_ASSERT_TRUE(_pool.high_watermark() >= 1 && _pool.high_watermark() <= 4);
+
+    void* _all[64];
+    for (int i = 0; i < 64; ++i) TEST_ASSERT_NOT_NULL(_all[i] = _pool.allocate());
+    TEST_ASSERT_NULL(_pool.allocate());
+    for (int i = 0; i < 64; ++i) _pool.deallocate(_all[i]);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_pool_allocate_until_full);
+    RUN_TEST(test_pool_create_destroy);
+    RUN_TEST(test_pool_nodes_and_shared_ptr);
+    RUN_TEST(test_pooled_shared_ptr_copy_and_assign);
+    RUN_TEST(test_pooled_shared_ptr_reset);
+    RUN_TEST(test_atomic_pool_threads);
+    return UNITY_END();
+}
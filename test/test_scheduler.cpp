@@ -0,0 +1,130 @@
+#include <unity.h>
+#include "utscheduler.h"
+
+using sched_type = utb::scheduler<8, 4>;
+
+static char order[16];
+static int order_len;
+
+void test_scheduler_priority_and_fifo() {
+    static sched_type _sched;
+    order_len = 0;
+
+    utb::task_id _low = _sched.create(0, []() { order[order_len++] = 'l'; });
+    utb::task_id _a = _sched.create(2, []() { order[order_len++] = 'a'; });
+    utb::task_id _b = _sched.create(2, []() { order[order_len++] = 'b'; });
+    utb::task_id _high = _sched.create(3, []() { order[order_len++] = 'h'; });
+
+    _sched.post(_low);
+    _sched.post(_b);
+    _sched.post(_a);
+    TEST_ASSERT_FALSE(_sched.post(_a));   // coalesced
+    _sched.post(_high);
+
+    TEST_ASSERT_EQUAL(4, _sched.run());
+    TEST_ASSERT_EQUAL_STRING_LEN("hbal", order, 4);
+    TEST_ASSERT_TRUE(_sched.idle());
+    TEST_ASSERT_EQUAL(1, _sched.stats(_a).runs);
+}
+
+void test_scheduler_self_post_and_current() {
+    static sched_type _sched;
+    static int _count = 0;
+
+    _sched.create(1, []() {
+        if (++_count < 5) _sched.post(_sched.current());
+    });
+    _sched.post(0);
+    TEST_ASSERT_EQUAL(5, _sched.run());
+    TEST_ASSERT_EQUAL(5, _sched.stats(0).runs);
+    TEST_ASSERT_EQUAL(utb::invalid_task, _sched.current());
+}
+
+void test_scheduler_defer() {
+    sched_type _sched;
+    int _runs = 0;
+
+    utb::task_id _t = _sched.create(1, [&_runs]() { ++_runs; });
+    _sched.defer(_t, 10);
+    utb::timer_id _cancelled = _sched.defer(_t, 20);
+
+    _sched.tick(9);
+    TEST_ASSERT_EQUAL(0, _sched.run());
+    _sched.tick();
+    TEST_ASSERT_EQUAL(1, _sched.run());
+
+    TEST_ASSERT_TRUE(_sched.cancel_deferred(_cancelled));
+    _sched.tick(50);
+    TEST_ASSERT_EQUAL(0, _sched.run());
+    TEST_ASSERT_EQUAL(1, _runs);
+}
+
+#if UTB_CONFIG_ENABLE_ATOMIC == UTB_YES
+void test_scheduler_post_from_isr() {
+    utb::scheduler<40, 2> _sched;
+    int _runs = 0;
+
+    for (int i = 0; i < 40; ++i) _sched.create(uint8_t(i & 1), [&_runs]() { ++_runs; });
+    _sched.post_from_isr(3);
+    _sched.post_from_isr(3);
+    _sched.post_from_isr(35);
+    TEST_ASSERT_TRUE(_sched.idle());
+
+    TEST_ASSERT_EQUAL(2, _sched.run());
+    TEST_ASSERT_EQUAL(2, _runs);
+}
+#endif
+
+void test_scheduler_capacity() {
+    utb::scheduler<2> _sched;
+    TEST_ASSERT_NOT_EQUAL(utb::invalid_task, _sched.create(0, []() { }));
+    TEST_ASSERT_NOT_EQUAL(utb::invalid_task, _sched.create(0, []() { }));
+    TEST_ASSERT_EQUAL(utb::invalid_task, _sched.create(0, []() { }));
+}
+
+/// A clock that advances by the time the running task sets, init() must be called first.
+struct fake_clock {
+    using value_type = uint32_t;
+    static bool ready;
+    static value_type time, step;
+
+    static void init()                      { ready = true; time = 0; }
+    static value_type now()                 { TEST_ASSERT_TRUE(ready); return time; }
+};
+bool fake_clock::ready = false;
+fake_clock::value_type fake_clock::time = 0;
+fake_clock::value_type fake_clock::step = 0;
+
+void test_scheduler_runtime_stats() {
+    utb::basic_scheduler<4, 2, fake_clock> _sched;
+    TEST_ASSERT_TRUE(fake_clock::ready);
+
+    const utb::task_id _id = _sched.create(1, []() { fake_clock::time += fake_clock::step; });
+    const fake_clock::value_type _steps[3] = { 30, 70, 20 };
+    for (int i = 0; i < 3; ++i) {
+        fake_clock::step = _steps[i];
+        _sched.post(_id);
+        _sched.run();
+    }
+
+    TEST_ASSERT_EQUAL(3, _sched.stats(_id).runs);
+    TEST_ASSERT_EQUAL(120, _sched.stats(_id).total);
+    TEST_ASSERT_EQUAL(70, _sched.stats(_id).max);
+    TEST_ASSERT_EQUAL(40, _sched.stats(_id).average());
+
+    _sched.reset_stats(_id);
+    TEST_ASSERT_EQUAL(0, _sched.stats(_id).max);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_scheduler_priority_and_fifo);
+    RUN_TEST(test_scheduler_self_post_and_current);
+    RUN_TEST(test_scheduler_defer);
+#if UTB_CONFIG_ENABLE_ATOMIC == UTB_YES
+    RUN_TEST(test_scheduler_post_from_isr);
+#endif
+    RUN_TEST(test_scheduler_capacity);
+    RUN_TEST(test_scheduler_runtime_stats);
+    return UNITY_END();
+}
@@ -0,0 +1,98 @@
+#include <unity.h>
+#include <string.h>
+#include "utsimd.h"
+
+using namespace utb::internal;
+
+// Every size class (tiny, small, large) at every alignment, with guard bytes on both sides
+static const utb::size_t max_bytes = 600;
+static const utb::size_t max_offset = 32;
+static const utb::size_t guard = 64;
+
+static uint8_t g_dst[guard + max_offset + max_bytes + guard];
+static uint8_t g_ref[sizeof(g_dst)];
+static uint8_t g_src[sizeof(g_dst)];
+
+static void reset() {
+    for (utb::size_t i = 0; i < sizeof(g_dst); ++i) {
+        g_dst[i] = g_ref[i] = uint8_t(0xA5 ^ i);
+        g_src[i] = uint8_t(i * 7 + 3);
+    }
+}
+
+static void check_equal() {
+    TEST_ASSERT_EQUAL_INT(0, memcmp(g_ref, g_dst, sizeof(g_dst)));
+}
+
+void test_simd_path() {
+#if UTB_CONFIG_ENABLE_SIMD == UTB_YES && (defined(__SSE2__) || defined(__AVX2__))
+    TEST_ASSERT_EQUAL_INT(1, UTB_SIMD_SSE2);
+#else
+    TEST_ASSERT_EQUAL_INT(0, UTB_SIMD_SSE2);
+#endif
+}
+
+void test_simd_fill() {
+    const uint8_t _value[8] = { 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88 };
+
+    for (utb::size_t size = 1; size <= 8; size *= 2) {
+        const uint64_t _pattern = simd::widen_pattern(_value, size);
+
+        // the destination is aligned to the element size
+        for (utb::size_t offset = 0; offset < max_offset; offset += size) {
+            for (utb::size_t bytes = 0; bytes <= max_bytes; bytes += size) {
+                reset();
+                uint8_t* _at = g_ref + guard + offset;
+                for (utb::size_t i = 0; i < bytes; ++i) _at[i] = _value[i % size];
+
+                simd::fill_pattern(g_dst + guard + offset, bytes, _pattern);
+                check_equal();
+            }
+        }
+    }
+}
+
+void test_simd_copy() {
+    for (utb::size_t offset = 0; offset < max_offset; ++offset) {
+        for (utb::size_t bytes = 0; bytes <= max_bytes; ++bytes) {
+            // the source runs at a different alignment than the destination
+            const uint8_t* _src = g_src + guard + (offset * 5) % max_offset;
+
+            reset();
+            for (utb::size_t i = 0; i < bytes; ++i) g_ref[guard + offset + i] = _src[i];
+
+            simd::copy_bytes(g_dst + guard + offset, _src, bytes);
+            check_equal();
+        }
+    }
+}
+
+void test_simd_move_overlapping() {
+    static const long shifts[] = { -40, -33, -17, -8, -1, 1, 3, 16, 31, 45 };
+
+    for (utb::size_t s = 0; s < sizeof(shifts) / sizeof(shifts[0]); ++s) {
+        for (utb::size_t offset = 0; offset < max_offset; offset += 3) {
+            for (utb::size_t bytes = 0; bytes <= max_bytes - 2 * guard; ++bytes) {
+                uint8_t* _from = g_dst + 2 * guard + offset;
+                uint8_t* _ref = g_ref + 2 * guard + offset;
+
+                reset();
+                uint8_t _tmp[max_bytes];
+                for (utb::size_t i = 0; i < bytes; ++i) _tmp[i] = _ref[i];
+                for (utb::size_t i = 0; i < bytes; ++i) _ref[shifts[s] + long(i)] = _tmp[i];
+
+                simd::move_bytes(_from + shifts[s], _from, bytes);
+                check_equal();
+            }
+        }
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_simd_path);
+    RUN_TEST(test_simd_fill);
+    RUN_TEST(test_simd_copy);
+    RUN_TEST(test_simd_move_overlapping);
+    return UNITY_END();
+}
@@ -0,0 +1,3 @@
+// test_simd.cpp on the word/C library fallback, the path of targets without SSE2 or AVX2
+#define UTB_CONFIG_ENABLE_SIMD UTB_NO
+#include "test_simd.cpp"
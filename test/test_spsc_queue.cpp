@@ -0,0 +1,65 @@
+#include <unity.h>
+#include <thread>
+#include "utspsc_queue.h"
+
+static utb::spsc_queue<uint32_t, 256> g_queue;
+
+void test_spsc_single_thread() {
+    utb::spsc_queue<int, 4> q;
+    int v = 0;
+
+    TEST_ASSERT_FALSE(q.try_pop(v));
+    for (int i = 0; i < 4; ++i) TEST_ASSERT_TRUE(q.try_push(i));
+    TEST_ASSERT_FALSE(q.try_push(4));
+    TEST_ASSERT_TRUE(q.full());
+
+    TEST_ASSERT_TRUE(q.try_pop(v));
+    TEST_ASSERT_EQUAL_INT(0, v);
+
+    int in[3] = { 10, 11, 12 };
+    TEST_ASSERT_EQUAL_UINT(1, q.push_n(in, 3));
+
+    int out[8];
+    TEST_ASSERT_EQUAL_UINT(4, q.pop_n(out, 8));
+    TEST_ASSERT_EQUAL_INT(1, out[0]);
+    TEST_ASSERT_EQUAL_INT(10, out[3]);
+    TEST_ASSERT_TRUE(q.empty());
+}
+
+void test_spsc_two_thread_stress() {
+    const uint32_t count = 200000;
+
+    std::thread producer([count]() {
+        uint32_t next = 0, batch[7];
+        while (next < count) {
+            if (next % 3 == 0) {
+                if (g_queue.try_push(next)) ++next;
+                else std::this_thread::yield();
+            } else {
+                uint32_t n = 0, pushed;
+                while (n < 7 && next + n < count) { batch[n] = next + n; ++n; }
+                next += (pushed = g_queue.push_n(batch, n));
+                if (pushed == 0) std::this_thread::yield();
+            }
+        }
+    });
+
+    uint32_t expected = 0, errors = 0, batch[11];
+    while (expected < count) {
+        uint32_t n = g_queue.pop_n(batch, 11);
+        if (n == 0) std::this_thread::yield();
+        for (uint32_t i = 0; i < n; ++i)
+            if (batch[i] != expected++) ++errors;
+    }
+    producer.join();
+
+    TEST_ASSERT_EQUAL_UINT(0, errors);
+    TEST_ASSERT_TRUE(g_queue.empty());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_spsc_single_thread);
+    RUN_TEST(test_spsc_two_thread_stress);
+    return UNITY_END();
+}
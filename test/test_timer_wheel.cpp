@@ -0,0 +1,84 @@
+#include <unity.h>
+#include "uttimer_wheel.h"
+
+using wheel_type = utb::basic_timer_wheel<64>;
+
+static uint32_t fired_at[8];
+static int fired_count;
+
+void test_timer_wheel_fires_on_time() {
+    static wheel_type _wheel;
+    fired_count = 0;
+
+    // across level boundaries and beyond the range of the top level
+    static const uint32_t _delays[8] = { 1, 63, 64, 65, 4095, 4096, 300000, wheel_type::max_delay + 1000 };
+    for (int i = 0; i < 8; ++i) {
+        const int _i = i;
+        TEST_ASSERT_NOT_EQUAL(utb::invalid_timer, _wheel.schedule(_delays[i], [_i]() {
+            fired_at[_i] = _wheel.now();
+            ++fired_count;
+        }));
+    }
+    TEST_ASSERT_EQUAL(8, _wheel.size());
+
+    _wheel.advance(wheel_type::max_delay + 1000);
+    TEST_ASSERT_EQUAL(8, fired_count);
+    for (int i = 0; i < 8; ++i) TEST_ASSERT_EQUAL_UINT32(_delays[i], fired_at[i]);
+    TEST_ASSERT_TRUE(_wheel.empty());
+}
+
+void test_timer_wheel_cancel() {
+    wheel_type _wheel;
+    int _count = 0;
+
+    utb::timer_id _a = _wheel.schedule(10, [&_count]() { ++_count; });
+    utb::timer_id _b = _wheel.schedule(200, [&_count]() { _count += 10; });
+    TEST_ASSERT_EQUAL_UINT32(200, _wheel.remaining(_b));
+
+    TEST_ASSERT_TRUE(_wheel.cancel(_b));
+    TEST_ASSERT_FALSE(_wheel.cancel(_b));
+    TEST_ASSERT_FALSE(_wheel.pending(_b));
+
+    _wheel.advance(300);
+    TEST_ASSERT_EQUAL(1, _count);
+    // a handle of a fired timer stays invalid when its slot is reused
+    utb::timer_id _c = _wheel.schedule(5, [&_count]() { ++_count; });
+    TEST_ASSERT_FALSE(_wheel.cancel(_a));
+    TEST_ASSERT_TRUE(_wheel.pending(_c));
+}
+
+void test_timer_wheel_reschedule_from_callback() {
+    wheel_type _wheel;
+    int _count = 0;
+    utb::timer_id _other = _wheel.schedule(30, [&_count]() { _count += 100; });
+
+    struct periodic {
+        wheel_type* wheel; int* count; utb::timer_id other;
+        void operator()() const {
+            if (++*count == 3) wheel->cancel(other);
+            if (*count < 5) wheel->schedule(7, *this);
+        }
+    };
+    _wheel.schedule(7, periodic{ &_wheel, &_count, _other });
+
+    TEST_ASSERT_EQUAL(5, _wheel.advance(100));
+    TEST_ASSERT_EQUAL(5, _count);
+    TEST_ASSERT_TRUE(_wheel.empty());
+}
+
+void test_timer_wheel_capacity() {
+    utb::basic_timer_wheel<4> _wheel;
+    for (int i = 0; i < 4; ++i) TEST_ASSERT_NOT_EQUAL(utb::invalid_timer, _wheel.schedule(1 + i, []() { }));
+    TEST_ASSERT_EQUAL(utb::invalid_timer, _wheel.schedule(1, []() { }));
+    TEST_ASSERT_EQUAL(1, _wheel.tick());
+    TEST_ASSERT_NOT_EQUAL(utb::invalid_timer, _wheel.schedule(1, []() { }));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_timer_wheel_fires_on_time);
+    RUN_TEST(test_timer_wheel_cancel);
+    RUN_TEST(test_timer_wheel_reschedule_from_callback);
+    RUN_TEST(test_timer_wheel_capacity);
+    return UNITY_END();
+}
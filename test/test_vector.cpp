@@ -0,0 +1,108 @@
+#include <unity.h>
+#include "utvector.h"
+
+/// Counts copies and moves, a moved-from value is -1.
+struct counted {
+    static int copies, moves, alive;
+    int value;
+
+    explicit counted(int v = 0) : value(v)              { ++alive; }
+    counted(const counted& o) : value(o.value)          { ++copies; ++alive; }
+    counted(counted&& o) : value(o.value)               { o.value = -1; ++moves; ++alive; }
+    ~counted()                                          { --alive; }
+
+    counted& operator=(const counted& o)                { value = o.value; ++copies; return *this; }
+    counted& operator=(counted&& o)                     { value = o.value; o.value = -1; ++moves; return *this; }
+
+    static void reset()                                 { copies = moves = 0; }
+};
+int counted::copies = 0;
+int counted::moves = 0;
+int counted::alive = 0;
+
+using counted_vector = utb::vector<counted, 8>;
+
+static void expect(const counted_vector& v, const int* values, utb::size_t n) {
+    TEST_ASSERT_EQUAL(n, v.size());
+    for (utb::size_t i = 0; i < n; ++i) TEST_ASSERT_EQUAL(values[i], v[i].value);
+}
+
+void test_vector_push_back_moves() {
+    {
+        counted_vector _v;
+        counted _c(5);
+        counted::reset();
+
+        _v.push_back(utb::move(_c));
+        TEST_ASSERT_EQUAL(0, counted::copies);
+        TEST_ASSERT_EQUAL(1, counted::moves);
+        TEST_ASSERT_EQUAL(-1, _c.value);
+        TEST_ASSERT_EQUAL(5, _v.back().value);
+
+        _v.push_back(counted(6));
+        TEST_ASSERT_EQUAL(0, counted::copies);
+        TEST_ASSERT_EQUAL(2, _v.size());
+    }
+    TEST_ASSERT_EQUAL(0, counted::alive);
+}
+
+void test_vector_insert_n() {
+    {
+        counted_vector _v;
+        for (int i = 0; i < 4; ++i) _v.push_back(counted(i));
+
+        // the tail partly lands in raw slots, partly on live elements
+        _v.insert(_v.begin() + 1, 2, counted(9));
+        const int _a[6] = { 0, 9, 9, 1, 2, 3 };
+        expect(_v, _a, 6);
+
+        // at the end
+        _v.insert(_v.end(), 1, counted(7));
+        const int _b[7] = { 0, 9, 9, 1, 2, 3, 7 };
+        expect(_v, _b, 7);
+
+        // more than fits: only one slot is left; val is an element of the vector
+        _v.insert(_v.begin(), 5, _v[3]);
+        const int _c[8] = { 1, 0, 9, 9, 1, 2, 3, 7 };
+        expect(_v, _c, 8);
+
+        _v.insert(_v.begin(), 1, counted(4));
+        expect(_v, _c, 8);
+    }
+    TEST_ASSERT_EQUAL(0, counted::alive);
+}
+
+void test_vector_swap_does_not_copy() {
+    {
+        counted_vector _a, _b;
+        for (int i = 0; i < 5; ++i) _a.push_back(counted(i));
+        for (int i = 0; i < 2; ++i) _b.push_back(counted(10 + i));
+        counted::reset();
+
+        _a.swap(_b);
+        TEST_ASSERT_EQUAL(0, counted::copies);
+
+        const int _short[2] = { 10, 11 };
+        const int _long[5] = { 0, 1, 2, 3, 4 };
+        expect(_a, _short, 2);
+        expect(_b, _long, 5);
+        TEST_ASSERT_EQUAL(7, counted::alive);
+
+        _a.swap(_b);
+        expect(_a, _long, 5);
+        expect(_b, _short, 2);
+        TEST_ASSERT_EQUAL(0, counted::copies);
+
+        _a.swap(_a);
+        expect(_a, _long, 5);
+    }
+    TEST_ASSERT_EQUAL(0, counted::alive);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_vector_push_back_moves);
+    RUN_TEST(test_vector_insert_n);
+    RUN_TEST(test_vector_swap_does_not_copy);
+    return UNITY_END();
+}
@@ -0,0 +1,137 @@
+#include <unity.h>
+#include "utvector_batch.h"
+
+using namespace utb::math;
+
+// 11 vectors: two full SIMD batches and a scalar tail
+static const utb::size_t count = 11;
+
+static vector3<float> make3(utb::size_t i) {
+    return vector3<float>(float(i) - 4.5f, 0.25f * float(i * i) - 3.0f, 2.0f - 0.5f * float(i));
+}
+
+void test_batch_matches_scalar() {
+    vector3<float> _a[count], _b[count], _cross[count];
+    float _dot[count], _len[count];
+    for (utb::size_t i = 0; i < count; ++i) { _a[i] = make3(i); _b[i] = make3(count - i); }
+
+    dot_n(_a, _b, _dot, count);
+    cross_n(_a, _b, _cross, count);
+    length_n(_a, _len, count);
+
+    for (utb::size_t i = 0; i < count; ++i) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, dot(_a[i], _b[i]), _dot[i]);
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, lenght(_a[i]), _len[i]);
+
+        const vector3<float> _c = cross(_a[i], _b[i]);
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, _c.x, _cross[i].x);
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, _c.y, _cross[i].y);
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, _c.z, _cross[i].z);
+    }
+
+    vector2<float> _v2[count];
+    vector4<float> _v4[count];
+    float _dot2[count], _dot4[count];
+    for (utb::size_t i = 0; i < count; ++i) {
+        _v2[i] = vector2<float>(float(i), 1.0f - float(i));
+        _v4[i] = vector4<float>(float(i), 2.0f, -float(i), 0.5f);
+    }
+    dot_n(_v2, _v2, _dot2, count);
+    dot_n(_v4, _v4, _dot4, count);
+    for (utb::size_t i = 0; i < count; ++i) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, dot(_v2[i], _v2[i]), _dot2[i]);
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, dot(_v4[i], _v4[i]), _dot4[i]);
+    }
+}
+
+template <class TPolicy>
+static void check_normalize() {
+    vector3<float> _v[count];
+    for (utb::size_t i = 0; i < count; ++i) _v[i] = make3(i) * (i % 2 ? 1e-3f : 1e3f);
+    _v[5] = vector3<float>(0.0f);
+
+    normalize_n<TPolicy>(_v, _v, count);
+
+    for (utb::size_t i = 0; i < count; ++i) {
+        if (i == 5) {
+            TEST_ASSERT_TRUE(_v[i].x == 0.0f && _v[i].y == 0.0f && _v[i].z == 0.0f);
+            continue;
+        }
+        TEST_ASSERT_FLOAT_WITHIN(2.0f * TPolicy::max_error, 1.0f, lenght(_v[i]));
+    }
+}
+
+void test_batch_normalize_policies() {
+    check_normalize<rsqrt_exact>();
+    check_normalize<rsqrt_precise>();
+    check_normalize<rsqrt_fast>();
+
+    for (float x = 1e-6f; x < 1e6f; x *= 1.7f) {
+        const double _exact = 1.0 / ::sqrt(double(x));
+        TEST_ASSERT_FLOAT_WITHIN(rsqrt_precise::max_error * _exact, _exact, rsqrt<rsqrt_precise>(x));
+        TEST_ASSERT_FLOAT_WITHIN(rsqrt_fast::max_error * _exact, _exact, rsqrt<rsqrt_fast>(x));
+    }
+
+    float _len[count];
+    vector4<float> _v4[count];
+    for (utb::size_t i = 0; i < count; ++i) _v4[i] = vector4<float>(float(i), 3.0f, 0.0f, 4.0f);
+    length_n<rsqrt_fast>(_v4, _len, count);
+    for (utb::size_t i = 0; i < count; ++i) TEST_ASSERT_FLOAT_WITHIN(0.1f, lenght(_v4[i]), _len[i]);
+}
+
+void test_batch_rotate() {
+    // 90 degrees about z: x -> y, y -> -x
+    const float _h = 0.70710678f;
+    const vector4<float> _q(0.0f, 0.0f, _h, _h);
+
+    vector3<float> _v[count];
+    for (utb::size_t i = 0; i < count; ++i) _v[i] = make3(i);
+    vector3<float> _r[count];
+    rotate_n(_q, _v, _r, count);
+
+    for (utb::size_t i = 0; i < count; ++i) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, -_v[i].y, _r[i].x);
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, _v[i].x, _r[i].y);
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, _v[i].z, _r[i].z);
+    }
+
+    // the generic path for double
+    vector3<double> _d[3] = { vector3<double>(1, 0, 0), vector3<double>(0, 1, 0), vector3<double>(0, 0, 1) };
+    rotate_n(vector4<double>(0, 0, _h, _h), _d, _d, 3);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, 1.0, _d[0].y);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, -1.0, _d[1].x);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, 1.0, _d[2].z);
+}
+
+void test_batch_soa() {
+    vector3<float> _v[count];
+    for (utb::size_t i = 0; i < count; ++i) _v[i] = make3(i);
+
+    static soa_array3<float, 16> _soa;
+    TEST_ASSERT_EQUAL(count, _soa.assign(_v, count));
+
+    float _dot[count];
+    dot_n(_soa.view(), _soa.view(), _dot);
+    for (utb::size_t i = 0; i < count; ++i) TEST_ASSERT_FLOAT_WITHIN(1e-4f, dot(_v[i], _v[i]), _dot[i]);
+
+    normalize_n<rsqrt_precise>(_soa.view(), _soa.view());
+    rotate_n(vector4<float>(0.0f, 0.0f, 0.0f, 1.0f), _soa.view(), _soa.view());
+
+    vector3<float> _back[count];
+    _soa.copy_to(_back);
+    for (utb::size_t i = 0; i < count; ++i) {
+        const vector3<float> _n = normalize(_v[i]);
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, _n.x, _back[i].x);
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, _n.y, _back[i].y);
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, _n.z, _back[i].z);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_batch_matches_scalar);
+    RUN_TEST(test_batch_normalize_policies);
+    RUN_TEST(test_batch_rotate);
+    RUN_TEST(test_batch_soa);
+    return UNITY_END();
+}